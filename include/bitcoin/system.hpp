@@ -34,13 +34,16 @@
 #include <bitcoin/system/warnings.hpp>
 #include <bitcoin/system/chain/annex.hpp>
 #include <bitcoin/system/chain/block.hpp>
+#include <bitcoin/system/chain/block_file.hpp>
 #include <bitcoin/system/chain/chain.hpp>
 #include <bitcoin/system/chain/chain_state.hpp>
 #include <bitcoin/system/chain/checkpoint.hpp>
 #include <bitcoin/system/chain/compact.hpp>
 #include <bitcoin/system/chain/context.hpp>
+#include <bitcoin/system/chain/gather.hpp>
 #include <bitcoin/system/chain/header.hpp>
 #include <bitcoin/system/chain/input.hpp>
+#include <bitcoin/system/chain/json.hpp>
 #include <bitcoin/system/chain/operation.hpp>
 #include <bitcoin/system/chain/output.hpp>
 #include <bitcoin/system/chain/point.hpp>
@@ -91,6 +94,7 @@
 #include <bitcoin/system/crypto/ring_signature.hpp>
 #include <bitcoin/system/crypto/secp256k1.hpp>
 #include <bitcoin/system/data/array_cast.hpp>
+#include <bitcoin/system/data/buffer_pool.hpp>
 #include <bitcoin/system/data/byte_cast.hpp>
 #include <bitcoin/system/data/collection.hpp>
 #include <bitcoin/system/data/data.hpp>
@@ -134,6 +138,7 @@
 #include <bitcoin/system/hash/functions.hpp>
 #include <bitcoin/system/hash/hash.hpp>
 #include <bitcoin/system/hash/hmac.hpp>
+#include <bitcoin/system/hash/merkle_tree.hpp>
 #include <bitcoin/system/hash/pbkd.hpp>
 #include <bitcoin/system/hash/scrypt.hpp>
 #include <bitcoin/system/hash/siphash.hpp>
@@ -142,6 +147,7 @@
 #include <bitcoin/system/hash/rmd/rmd128.hpp>
 #include <bitcoin/system/hash/rmd/rmd160.hpp>
 #include <bitcoin/system/hash/sha/algorithm.hpp>
+#include <bitcoin/system/hash/sha/dispatch.hpp>
 #include <bitcoin/system/hash/sha/sha.hpp>
 #include <bitcoin/system/hash/sha/sha160.hpp>
 #include <bitcoin/system/hash/sha/sha256.hpp>
@@ -203,6 +209,7 @@
 #include <bitcoin/system/stream/device.hpp>
 #include <bitcoin/system/stream/make_stream.hpp>
 #include <bitcoin/system/stream/make_streamer.hpp>
+#include <bitcoin/system/stream/mapped_file.hpp>
 #include <bitcoin/system/stream/stream.hpp>
 #include <bitcoin/system/stream/stream_result.hpp>
 #include <bitcoin/system/stream/streamers.hpp>
@@ -244,12 +251,19 @@
 #include <bitcoin/system/unicode/utf8_everywhere/unicode_ostream.hpp>
 #include <bitcoin/system/unicode/utf8_everywhere/unicode_streambuf.hpp>
 #include <bitcoin/system/unicode/utf8_everywhere/utf8_everywhere.hpp>
+#include <bitcoin/system/utreexo/forest.hpp>
+#include <bitcoin/system/utreexo/pollard.hpp>
+#include <bitcoin/system/utreexo/proof.hpp>
+#include <bitcoin/system/utreexo/stump.hpp>
+#include <bitcoin/system/utreexo/utreexo.hpp>
 #include <bitcoin/system/wallet/context.hpp>
 #include <bitcoin/system/wallet/message.hpp>
 #include <bitcoin/system/wallet/neutrino.hpp>
 #include <bitcoin/system/wallet/point_value.hpp>
 #include <bitcoin/system/wallet/points_value.hpp>
+#include <bitcoin/system/wallet/scanner.hpp>
 #include <bitcoin/system/wallet/wallet.hpp>
+#include <bitcoin/system/wallet/addresses/address_batch.hpp>
 #include <bitcoin/system/wallet/addresses/bitcoin_uri.hpp>
 #include <bitcoin/system/wallet/addresses/checked.hpp>
 #include <bitcoin/system/wallet/addresses/payment_address.hpp>
@@ -280,6 +294,8 @@
 #include <bitcoin/system/words/dictionary.hpp>
 #include <bitcoin/system/words/language.hpp>
 #include <bitcoin/system/words/languages.hpp>
+#include <bitcoin/system/words/perfect_hash.hpp>
+#include <bitcoin/system/words/perfect_hashes.hpp>
 #include <bitcoin/system/words/words.hpp>
 #include <bitcoin/system/words/catalogs/electrum.hpp>
 #include <bitcoin/system/words/catalogs/electrum_v1.hpp>
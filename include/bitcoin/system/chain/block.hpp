@@ -19,6 +19,7 @@
 #ifndef LIBBITCOIN_SYSTEM_CHAIN_BLOCK_HPP
 #define LIBBITCOIN_SYSTEM_CHAIN_BLOCK_HPP
 
+#include <functional>
 #include <memory>
 #include <bitcoin/system/chain/context.hpp>
 #include <bitcoin/system/chain/header.hpp>
@@ -41,8 +42,26 @@ public:
 
     typedef std::shared_ptr<const block> cptr;
 
+    /// Handler for each transaction as it is deserialized and checked.
+    /// Returning other than success aborts deserialization with the code.
+    typedef std::function<code(const transaction::cptr&)> handler;
+
     static bool is_malleable64(const transaction_cptrs& txs) NOEXCEPT;
 
+    /// Streaming deserialization.
+    /// -----------------------------------------------------------------------
+
+    /// Deserialize and check (context free), aborting on first failure.
+    /// Size, coinbase placement and transaction checks are performed, and
+    /// transaction hashes (merkle leaves) are cached, as each transaction is
+    /// read. Remaining checks follow the last transaction. If more than one
+    /// check fails the first detected is returned, which may differ from
+    /// check(). Malleation is resolved as by check(). Out is set on success.
+    static code deserialize(cptr& out, std::istream& stream, bool witness,
+        const handler& handler={}) NOEXCEPT;
+    static code deserialize(cptr& out, reader& source, bool witness,
+        const handler& handler={}) NOEXCEPT;
+
     /// Constructors.
     /// -----------------------------------------------------------------------
 
@@ -70,6 +89,7 @@ public:
     /// -----------------------------------------------------------------------
 
     data_chunk to_data(bool witness) const NOEXCEPT;
+    void to_data(data_chunk& data, bool witness) const NOEXCEPT;
     void to_data(std::ostream& stream, bool witness) const NOEXCEPT;
     void to_data(writer& sink, bool witness) const NOEXCEPT;
 
@@ -206,11 +226,15 @@ private:
     uint64_t reward(size_t height, uint64_t subsidy_interval,
         uint64_t initial_block_subsidy_satoshi, bool bip42) const NOEXCEPT;
 
+    // streamed
+    code check_streamed() const NOEXCEPT;
+
     // delegated
     code check_transactions() const NOEXCEPT;
     code check_transactions(const context& ctx) const NOEXCEPT;
     code accept_transactions(const context& ctx) const NOEXCEPT;
     code connect_transactions(const context& ctx) const NOEXCEPT;
+    std_vector<bool> verify_commitments(const context& ctx) const NOEXCEPT;
     code confirm_transactions(const context& ctx) const NOEXCEPT;
 
     // Block should be stored as shared (adds 16 bytes).
@@ -0,0 +1,76 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_CHAIN_BLOCK_FILE_HPP
+#define LIBBITCOIN_SYSTEM_CHAIN_BLOCK_FILE_HPP
+
+#include <functional>
+#include <bitcoin/system/chain/block.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+/// Reader of block files, a sequence of [magic:4][size:4][block:size] records
+/// (little-endian, as written by the satoshi client), terminated by the end of
+/// the data or by zero padding. Records are sliced in place (zero-copy), so
+/// the data (e.g. a mapped_file) must outlive the slices. Decoded blocks own
+/// their data and may outlive the file.
+class BC_API block_file final
+{
+public:
+    typedef std::function<bool(const block::cptr&)> handler;
+
+    /// Records per decode batch, bounding memory ahead of the handler.
+    static constexpr size_t default_read_ahead = 64;
+
+    /// The magic is the network message start (e.g. 0xd9b4bef9 for mainnet).
+    block_file(const data_slice& data, uint32_t magic) NOEXCEPT;
+
+    /// False if reading stopped on a malformed record.
+    bool is_valid() const NOEXCEPT;
+
+    /// Offset of the next record.
+    size_t position() const NOEXCEPT;
+
+    /// Slice the next serialized block, false at end or malformed record.
+    bool next(data_slice& out) NOEXCEPT;
+
+    /// Decode remaining blocks concurrently, read_ahead records at a time,
+    /// delivering each in file order until the handler returns false. Blocks
+    /// are delivered whether or not valid (see block::is_valid). Returns false
+    /// if stopped by the handler or on a malformed record.
+    bool decode(const handler& handler, bool witness,
+        size_t read_ahead=default_read_ahead) NOEXCEPT;
+
+private:
+    static constexpr size_t record_header = 2u * sizeof(uint32_t);
+
+    data_slice data_;
+    uint32_t magic_;
+    size_t position_{};
+    bool valid_{ true };
+};
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
+
+#endif
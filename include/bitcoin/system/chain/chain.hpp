@@ -21,6 +21,7 @@
 
 #include <bitcoin/system/chain/annex.hpp>
 #include <bitcoin/system/chain/block.hpp>
+#include <bitcoin/system/chain/block_file.hpp>
 #include <bitcoin/system/chain/chain.hpp>
 #include <bitcoin/system/chain/chain_state.hpp>
 #include <bitcoin/system/chain/checkpoint.hpp>
@@ -37,8 +38,10 @@
 #include <bitcoin/system/chain/enums/selection.hpp>
 #include <bitcoin/system/chain/enums/script_pattern.hpp>
 #include <bitcoin/system/chain/enums/script_version.hpp>
+#include <bitcoin/system/chain/gather.hpp>
 #include <bitcoin/system/chain/header.hpp>
 #include <bitcoin/system/chain/input.hpp>
+#include <bitcoin/system/chain/json.hpp>
 #include <bitcoin/system/chain/operation.hpp>
 #include <bitcoin/system/chain/output.hpp>
 #include <bitcoin/system/chain/point.hpp>
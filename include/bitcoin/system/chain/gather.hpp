@@ -0,0 +1,94 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_CHAIN_GATHER_HPP
+#define LIBBITCOIN_SYSTEM_CHAIN_GATHER_HPP
+
+#include <bitcoin/system/chain/block.hpp>
+#include <bitcoin/system/chain/header.hpp>
+#include <bitcoin/system/chain/input.hpp>
+#include <bitcoin/system/chain/output.hpp>
+#include <bitcoin/system/chain/script.hpp>
+#include <bitcoin/system/chain/transaction.hpp>
+#include <bitcoin/system/chain/witness.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+/// Scatter/gather (iovec-style) wire serialization of a block or transaction.
+/// Fixed width fields and size prefixes are written (non-virtually) to an
+/// owned buffer, while deserialized script bytes and witness elements of at
+/// least minimum_reference bytes are referenced in place, not copied.
+/// Segments are valid for the lifetime of both this and the serialized object
+/// (which must not be modified, including script offset metadata).
+class BC_API gather final
+{
+public:
+    typedef std_vector<data_slice> segments;
+    DELETE_COPY_MOVE(gather);
+
+    /// Smaller data is copied, as a segment costs more than a small copy.
+    static constexpr size_t minimum_reference = 64;
+
+    gather(const block& block, bool witness) NOEXCEPT;
+    gather(const transaction& tx, bool witness) NOEXCEPT;
+
+    /// The serialized size (sum of segment sizes), computed up front.
+    size_t size() const NOEXCEPT;
+
+    /// The ordered segments of the serialization.
+    const segments& parts() const NOEXCEPT;
+
+    /// Copy the serialization into a preallocated buffer of exactly size().
+    bool copy(const data_slab& out) const NOEXCEPT;
+
+private:
+    uint8_t* allocate(size_t size) NOEXCEPT;
+    void reference(const data_slice& data) NOEXCEPT;
+
+    void write_byte(uint8_t value) NOEXCEPT;
+    void write_bytes(const data_slice& data) NOEXCEPT;
+    void write_variable(uint64_t value) NOEXCEPT;
+
+    template <typename Integer>
+    void write_little_endian(Integer value) NOEXCEPT;
+
+    void write(const block& block, bool witness) NOEXCEPT;
+    void write(const header& header) NOEXCEPT;
+    void write(const transaction& tx, bool witness) NOEXCEPT;
+    void write(const input& input) NOEXCEPT;
+    void write(const output& output) NOEXCEPT;
+    void write(const script& script) NOEXCEPT;
+    void write(const witness& witness) NOEXCEPT;
+
+    // Owned bytes never exceed size_, so the buffer is reserved once and
+    // owned segments reference it directly (it is never reallocated).
+    const size_t size_;
+    data_chunk buffer_{};
+    segments segments_{};
+    bool owned_{};
+};
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
+
+#endif
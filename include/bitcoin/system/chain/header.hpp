@@ -80,6 +80,7 @@ public:
     /// -----------------------------------------------------------------------
 
     data_chunk to_data() const NOEXCEPT;
+    void to_data(data_chunk& data) const NOEXCEPT;
     void to_data(std::ostream& stream) const NOEXCEPT;
     void to_data(writer& sink) const NOEXCEPT;
 
@@ -0,0 +1,58 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_CHAIN_JSON_HPP
+#define LIBBITCOIN_SYSTEM_CHAIN_JSON_HPP
+
+#include <string>
+#include <bitcoin/system/chain/block.hpp>
+#include <bitcoin/system/chain/header.hpp>
+#include <bitcoin/system/chain/input.hpp>
+#include <bitcoin/system/chain/output.hpp>
+#include <bitcoin/system/chain/point.hpp>
+#include <bitcoin/system/chain/script.hpp>
+#include <bitcoin/system/chain/transaction.hpp>
+#include <bitcoin/system/chain/witness.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/stream/stream.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+/// Streaming json serialization, in one pass to the sink (e.g. a caller's
+/// buffer or std::ostream) without an intermediate boost::json::value.
+/// Output is identical to boost::json::serialize(boost::json::value_from()).
+BC_API void to_json(writer& sink, const block& block) NOEXCEPT;
+BC_API void to_json(writer& sink, const header& header) NOEXCEPT;
+BC_API void to_json(writer& sink, const transaction& tx) NOEXCEPT;
+BC_API void to_json(writer& sink, const input& input) NOEXCEPT;
+BC_API void to_json(writer& sink, const output& output) NOEXCEPT;
+BC_API void to_json(writer& sink, const point& point) NOEXCEPT;
+BC_API void to_json(writer& sink, const script& script) NOEXCEPT;
+BC_API void to_json(writer& sink, const witness& witness) NOEXCEPT;
+
+/// Streaming json serialization to a string.
+BC_API std::string to_json(const block& block) NOEXCEPT;
+BC_API std::string to_json(const transaction& tx) NOEXCEPT;
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -135,6 +135,7 @@ public:
 
     // TODO: move to config serialization wrapper.
     std::string to_string(uint32_t active_flags) const NOEXCEPT;
+    void to_string(writer& sink, uint32_t active_flags) const NOEXCEPT;
 
     /// Properties.
     /// -----------------------------------------------------------------------
@@ -19,6 +19,7 @@
 #ifndef LIBBITCOIN_SYSTEM_CHAIN_SCRIPT_HPP
 #define LIBBITCOIN_SYSTEM_CHAIN_SCRIPT_HPP
 
+#include <atomic>
 #include <memory>
 #include <bitcoin/system/chain/enums/flags.hpp>
 #include <bitcoin/system/chain/enums/script_version.hpp>
@@ -64,6 +65,14 @@ public:
     static constexpr bool is_sign_script_hash_pattern(const operations& ops) NOEXCEPT;
     static bool is_coinbase_pattern(const operations& ops, size_t height) NOEXCEPT;
 
+    /// Serialized patterns (script bytes without size prefix, not parsed).
+    static constexpr bool is_witness_program_pattern(const data_slice& script) NOEXCEPT;
+    static constexpr bool is_pay_key_hash_pattern(const data_slice& script) NOEXCEPT;
+    static constexpr bool is_pay_script_hash_pattern(const data_slice& script) NOEXCEPT;
+    static constexpr bool is_pay_witness_key_hash_pattern(const data_slice& script) NOEXCEPT;
+    static constexpr bool is_pay_witness_script_hash_pattern(const data_slice& script) NOEXCEPT;
+    static constexpr bool is_pay_taproot_pattern(const data_slice& script) NOEXCEPT;
+
     static inline operations to_pay_null_data_pattern(
         const data_slice& data) NOEXCEPT;
     static inline operations to_pay_public_key_pattern(
@@ -85,7 +94,7 @@ public:
     static inline operations to_pay_witness_script_hash_pattern(
         const hash_digest& hash) NOEXCEPT;
 
-    /// Pattern optimizations.
+    /// Pattern optimizations (from serialized bytes when deserialized).
     inline bool is_pay_to_witness(uint32_t active_flags) const NOEXCEPT;
     inline bool is_pay_to_script_hash(uint32_t active_flags) const NOEXCEPT;
 
@@ -126,6 +135,7 @@ public:
     /// -----------------------------------------------------------------------
 
     data_chunk to_data(bool prefix) const NOEXCEPT;
+    void to_data(data_chunk& data, bool prefix) const NOEXCEPT;
     void to_data(std::ostream& stream, bool prefix) const NOEXCEPT;
     void to_data(writer& sink, bool prefix) const NOEXCEPT;
 
@@ -145,9 +155,18 @@ public:
     bool is_underflow() const NOEXCEPT;
     bool is_oversized() const NOEXCEPT;
     bool is_unspendable() const NOEXCEPT;
+
+    /// Deserialized scripts retain serialized bytes and defer parsing of
+    /// operations (and derived roller/prefail/prevalid) until first access.
+    /// Materialization is thread safe, but offset metadata is not.
+    bool is_parsed() const NOEXCEPT;
     const operations& ops() const NOEXCEPT;
     size_t serialized_size(bool prefix) const NOEXCEPT;
 
+    /// Retained serialized bytes (without prefix), empty if not deserialized
+    /// or if serialization is affected by offset metadata.
+    data_slice retained() const NOEXCEPT;
+
     /// Single sha256 hash, as used for Electrum indexation (not cached).
     hash_digest hash() const NOEXCEPT;
 
@@ -171,6 +190,8 @@ protected:
         bool roller, size_t size) NOEXCEPT;
 
 private:
+    enum class state : uint8_t { unparsed, parsing, parsed };
+    script(const script& other, bool parsed) NOEXCEPT;
     static inline size_t op_size(size_t total, const operation& op) NOEXCEPT;
     static script from_operations(operations&& ops) NOEXCEPT;
     static script from_operations(const operations& ops) NOEXCEPT;
@@ -178,15 +199,21 @@ private:
     static size_t op_count(reader& source) NOEXCEPT;
     static size_t serialized_size(const operations& ops) NOEXCEPT;
     void assign_data(reader& source, bool prefix) NOEXCEPT;
+    void materialize() const NOEXCEPT;
+    bool is_offset() const NOEXCEPT;
+
+    // Serialized bytes, retained only when deserialized.
+    data_chunk bytes_;
 
     // Script should be stored as shared.
-    operations ops_;
+    mutable operations ops_;
+    mutable std::atomic<state> state_;
 
-    // Cache, computed at construction.
+    // Cache, computed at construction (or materialization).
     bool valid_;
-    bool easier_;
-    bool failer_;
-    bool roller_;
+    mutable bool easier_;
+    mutable bool failer_;
+    mutable bool roller_;
     size_t size_;
 
 public:
@@ -33,12 +33,41 @@ namespace chain {
 class BC_API taproot
 {
 public:
+    /// A script tree leaf, weighted relative to the other leaves of its tree.
+    typedef struct
+    {
+        uint8_t version;
+        chain::script script;
+        uint64_t weight;
+    } leaf;
+    typedef std_vector<leaf> leaves;
+
+    /// The commitment of a script tree to an internal key, with the leaf hash
+    /// and control block of each leaf (in leaf order).
+    typedef struct
+    {
+        hash_digest root;
+        hash_digest tweak;
+        ec_xonly output_key;
+        bool parity;
+        hashes leaf_hashes;
+        data_stack controls;
+    } commitment;
+
     static hash_digest leaf_hash(uint8_t version,
         const script& script) NOEXCEPT;
     static bool drop_annex(chunk_cptrs& stack) NOEXCEPT;
     static bool verify_commit(const tapscript& control,
         const ec_xonly& out_key, const hash_digest& leaf) NOEXCEPT;
 
+    /// Build a weighted (huffman) script tree of the leaves and commit it to
+    /// the internal key. A leaf is never deeper than one of lesser weight.
+    /// Without leaves the key is committed alone (null root, no controls).
+    /// False if a leaf version is odd, the tree is deeper than a control
+    /// block allows, or the internal key is invalid (out is then reset).
+    static bool commit(commitment& out, const ec_xonly& internal_key,
+        const leaves& leaves) NOEXCEPT;
+
 protected:
     static hash_digest merkle_root(const tapscript::keys_t& keys,
         size_t count, const hash_digest& tapleaf_hash) NOEXCEPT;
@@ -46,6 +75,7 @@ protected:
         const hash_digest& right) NOEXCEPT;
     static hash_digest branch_hash(const hash_digest& first,
         const hash_digest& second) NOEXCEPT;
+    static hash_digest tweak_hash(const ec_xonly& key) NOEXCEPT;
     static hash_digest tweak_hash(const ec_xonly& key,
         const hash_digest& merkle) NOEXCEPT;
 };
@@ -45,6 +45,18 @@ public:
     typedef std::shared_ptr<const transaction> cptr;
     typedef input_cptrs::const_iterator input_iterator;
 
+    /// Endorsement parameters for the input at index.
+    typedef struct
+    {
+        uint32_t index;
+        ec_secret secret;
+        chain::script subscript;
+        uint64_t value;
+        uint8_t sighash_flags;
+        script_version version;
+    } signer;
+    typedef std_vector<signer> signers;
+
     /// Relative locktime also requires activation of bip68.
     static bool is_relative_locktime_applied(bool coinbase, uint32_t version,
         uint32_t sequence) NOEXCEPT;
@@ -87,6 +99,7 @@ public:
     /// -----------------------------------------------------------------------
 
     data_chunk to_data(bool witness) const NOEXCEPT;
+    void to_data(data_chunk& data, bool witness) const NOEXCEPT;
     void to_data(std::ostream& stream, bool witness) const NOEXCEPT;
     void to_data(writer& sink, bool witness) const NOEXCEPT;
 
@@ -156,6 +169,13 @@ public:
         uint8_t sighash_flags, script_version version,
         uint32_t flags) const NOEXCEPT;
 
+    /// Not used internally.
+    /// Signature hash caches are set once and endorsements are then created
+    /// concurrently, each as by create_endorsement (in order of signers).
+    /// Not thread safe, as signature hash caches are set.
+    bool create_endorsements(endorsements& out, const signers& signers,
+        uint32_t flags) const NOEXCEPT;
+
     /// Guards (for tx pool without compact blocks).
     /// -----------------------------------------------------------------------
 
@@ -172,6 +192,11 @@ public:
     code connect(const context& ctx) const NOEXCEPT;
     code confirm(const context& ctx) const NOEXCEPT;
 
+    /// Connect with taproot script path commitments preverified, where
+    /// committed is empty or has one element per input.
+    code connect(const context& ctx,
+        const std_vector<bool>& committed) const NOEXCEPT;
+
 protected:
     transaction(uint32_t version, const inputs_cptr& inputs,
         const outputs_cptr& outputs, uint32_t locktime, bool segregated,
@@ -259,8 +284,8 @@ private:
     chain::points points() const NOEXCEPT;
 
     // delegated
-    code connect_input(const context& ctx,
-        const input_iterator& it) const NOEXCEPT;
+    code connect_input(const context& ctx, const input_iterator& it,
+        bool committed) const NOEXCEPT;
 
     // Patterns.
     // ------------------------------------------------------------------------
@@ -275,6 +300,8 @@ private:
     void set_x1_base_hash() const NOEXCEPT;
     void set_x2_base_hash() const NOEXCEPT;
     void set_v1_only_hash() const NOEXCEPT;
+    void set_signature_hashes(const signers& signers,
+        uint32_t flags) const NOEXCEPT;
 
     hash_digest x1_base_hash_points() const NOEXCEPT;
     hash_digest x1_base_hash_sequences() const NOEXCEPT;
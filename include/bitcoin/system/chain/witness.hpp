@@ -19,6 +19,7 @@
 #ifndef LIBBITCOIN_SYSTEM_CHAIN_WITNESS_HPP
 #define LIBBITCOIN_SYSTEM_CHAIN_WITNESS_HPP
 
+#include <atomic>
 #include <memory>
 #include <bitcoin/system/chain/annex.hpp>
 #include <bitcoin/system/chain/operation.hpp>
@@ -35,8 +36,6 @@ namespace chain {
 class BC_API witness
 {
 public:
-    DEFAULT_COPY_MOVE_DESTRUCT(witness);
-
     typedef std::shared_ptr<const witness> cptr;
 
     /// serialized_size(..., true) returns one for an empty witness stack.
@@ -48,6 +47,11 @@ public:
 
     /// Default witness is an invalid empty stack object.
     witness() NOEXCEPT;
+    ~witness() NOEXCEPT;
+
+    /// An unstacked witness is copied/moved as unstacked (contiguous only).
+    witness(witness&& other) NOEXCEPT;
+    witness(const witness& other) NOEXCEPT;
 
     witness(data_stack&& stack) NOEXCEPT;
     witness(const data_stack& stack) NOEXCEPT;
@@ -68,6 +72,9 @@ public:
     /// Operators.
     /// -----------------------------------------------------------------------
 
+    witness& operator=(witness&& other) NOEXCEPT;
+    witness& operator=(const witness& other) NOEXCEPT;
+
     bool operator==(const witness& other) const NOEXCEPT;
     bool operator!=(const witness& other) const NOEXCEPT;
 
@@ -78,6 +85,7 @@ public:
     static void skip(reader& source, bool prefix) NOEXCEPT;
 
     data_chunk to_data(bool prefix) const NOEXCEPT;
+    void to_data(data_chunk& data, bool prefix) const NOEXCEPT;
     void to_data(std::ostream& stream, bool prefix) const NOEXCEPT;
     void to_data(writer& sink, bool prefix) const NOEXCEPT;
 
@@ -89,9 +97,19 @@ public:
 
     /// Native properties.
     bool is_valid() const NOEXCEPT;
+
+    /// Deserialized witnesses retain element data in one contiguous buffer
+    /// with an offset table, deferring the creation of shared stack elements
+    /// until first access. Materialization is thread safe. The annex does not
+    /// require materialization.
+    bool is_stacked() const NOEXCEPT;
     const chunk_cptrs& stack() const NOEXCEPT;
     const chain::annex& annex() const NOEXCEPT;
 
+    /// Element accessors, these do not materialize the stack.
+    size_t stack_size() const NOEXCEPT;
+    data_slice element(size_t index) const NOEXCEPT;
+
     /// Computed properties.
     /// serialized_size(true) returns one for an empty witness stack.
     size_t serialized_size(bool prefix) const NOEXCEPT;
@@ -106,6 +124,10 @@ public:
     static constexpr bool is_reserved_pattern(
         const chunk_cptrs& stack) NOEXCEPT;
 
+    /// Above patterns over element accessors (does not materialize stack).
+    bool is_push_size() const NOEXCEPT;
+    bool is_reserved_pattern() const NOEXCEPT;
+
     /// Script extractors.
     /// -----------------------------------------------------------------------
 
@@ -119,18 +141,43 @@ public:
     code extract_taproot(hash_cptr& out_leaf, script::cptr& out_script,
         chunk_cptrs_ptr& out_stack, const script& program_script) const NOEXCEPT;
 
+    /// As above, skipping the commitment check if committed (preverified by
+    /// is_committed against the same program).
+    code extract_taproot(hash_cptr& out_leaf, script::cptr& out_script,
+        chunk_cptrs_ptr& out_stack, const script& program_script,
+        bool committed) const NOEXCEPT;
+
+    /// True if a taproot script path spend commits to the program, as
+    /// verified by extract_taproot (false for any other witness or program).
+    bool is_committed(const script& program_script) const NOEXCEPT;
+
 protected:
     witness(chunk_cptrs&& stack, bool valid) NOEXCEPT;
     witness(const chunk_cptrs& stack, bool valid) NOEXCEPT;
     witness(const chunk_cptrs& stack, bool valid, size_t size) NOEXCEPT;
 
 private:
+    enum class state : uint8_t { unstacked, stacking, stacked };
+    witness(const witness& other, bool stacked) NOEXCEPT;
+
     // TODO: move to config serialization wrapper.
     static witness from_string(const std::string& mnemonic) NOEXCEPT;
+    static size_t data_size(reader& source, bool prefix,
+        size_t& count) NOEXCEPT;
     void assign_data(reader& source, bool prefix) NOEXCEPT;
+    void materialize() const NOEXCEPT;
+    void push_elements(chunk_cptrs& out, size_t count) const NOEXCEPT;
+    chunk_cptrs_ptr to_stack(size_t count) const NOEXCEPT;
+    bool is_contiguous() const NOEXCEPT;
+    bool is_annexed() const NOEXCEPT;
+
+    // Element data and offsets (count + 1), retained only when deserialized.
+    data_chunk bytes_;
+    std_vector<size_t> offsets_;
 
     // Witness should be stored as shared.
-    chunk_cptrs stack_;
+    mutable chunk_cptrs stack_;
+    mutable std::atomic<state> state_;
 
     // Cache/alias.
     bool valid_;
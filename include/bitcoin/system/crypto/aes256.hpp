@@ -40,6 +40,21 @@ typedef data_array<secret_size> secret;
 void encrypt(block& bytes, const secret& key) NOEXCEPT;
 void decrypt(block& bytes, const secret& key) NOEXCEPT;
 
+/// Perform aes256 ecb encryption/decryption on a sequence of data blocks.
+/// The key is expanded once for all blocks, which are pipelined when native
+/// (AES-NI or ARMv8 crypto) instructions are available. False if the size is
+/// not a multiple of block_size, in which case the bytes are not modified.
+bool encrypt_ecb(const data_slab& bytes, const secret& key) NOEXCEPT;
+bool decrypt_ecb(const data_slab& bytes, const secret& key) NOEXCEPT;
+
+/// True if native instructions are compiled, available on this cpu and not
+/// deselected. The native implementation is constant time (no table lookups).
+bool have_native() NOEXCEPT;
+
+/// Deselect (or reselect) native instructions, returns have_native().
+/// Selection is process-wide, for testing and benchmarking.
+bool select_native(bool enable) NOEXCEPT;
+
 } // namespace aes256
 } // namespace system
 } // namespace libbitcoin
@@ -108,6 +108,11 @@ BC_API bool ec_add(ec_compressed& left, const ec_uncompressed& right) NOEXCEPT;
 /// Compute the sum of compressed point values.
 BC_API bool ec_sum(ec_compressed& out, const compressed_list& values) NOEXCEPT;
 
+/// Compute the sums out[n] = point + G * scalars[n].
+/// The point is parsed (decompressed) once for the full set of scalars.
+BC_API bool ec_add(compressed_list& out, const ec_compressed& point,
+    const secret_list& scalars) NOEXCEPT;
+
 /// Multiply EC values
 /// ---------------------------------------------------------------------------
 
@@ -153,6 +158,16 @@ BC_API bool secret_to_public(ec_compressed& out,
 BC_API bool secret_to_public(ec_uncompressed& out,
     const ec_secret& secret) NOEXCEPT;
 
+/// Convert secrets to compressed points, out[n] = G * secrets[n].
+/// Points are generated concurrently, false if any secret is invalid.
+BC_API bool secret_to_public(compressed_list& out,
+    const secret_list& secrets) NOEXCEPT;
+
+/// Convert secrets to compressed points and their bitcoin short hashes.
+/// Points are generated concurrently, false if any secret is invalid.
+BC_API bool secret_to_public(compressed_list& out,
+    std_vector<short_hash>& hashes, const secret_list& secrets) NOEXCEPT;
+
 /// Verify keys
 /// ---------------------------------------------------------------------------
 
@@ -249,6 +264,10 @@ BC_API bool verify_commitment(const ec_xonly& internal_key,
     const hash_digest& tweak, const ec_xonly& tweaked_key,
     bool tweaked_key_parity) NOEXCEPT;
 
+/// Create Schnorr commitment of key to hash, the tweaked x-only point/parity.
+BC_API bool create_commitment(ec_xonly& tweaked_key, bool& tweaked_key_parity,
+    const ec_xonly& internal_key, const hash_digest& tweak) NOEXCEPT;
+
 } // namespace schnorr
 } // namespace system
 } // namespace libbitcoin
@@ -0,0 +1,106 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_DATA_BUFFER_POOL_HPP
+#define LIBBITCOIN_SYSTEM_DATA_BUFFER_POOL_HPP
+
+#include <bitcoin/system/data/data_chunk.hpp>
+#include <bitcoin/system/define.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+/// Thread-local pool of byte buffers, for reuse of serialization and hashing
+/// scratch space (e.g. to_data(data_chunk&) overloads). Buffers are retained
+/// by power of two capacity class, so a buffer obtained for a given size is
+/// reused for any size in its class. Buffers of other arenas, and those above
+/// maximum_size, are not retained. Buffers are released to the pool of the
+/// releasing thread, so may be passed between threads.
+class BC_API buffer_pool final
+{
+public:
+    DELETE_COPY_MOVE(buffer_pool);
+
+    /// Capacity classes, and retention limits per class and per thread.
+    static constexpr size_t minimum_size = 64;
+    static constexpr size_t maximum_size = 4u * 1024u * 1024u;
+    static constexpr size_t class_depth = 16;
+    static constexpr size_t maximum_retained = 16u * 1024u * 1024u;
+
+    /// Scoped buffer, released to the pool on destruction.
+    class BC_API buffer final
+    {
+    public:
+        DELETE_COPY(buffer);
+        buffer(buffer&& other) NOEXCEPT;
+        buffer& operator=(buffer&& other) NOEXCEPT;
+
+        buffer(data_chunk&& chunk) NOEXCEPT;
+        ~buffer() NOEXCEPT;
+
+        data_chunk& operator*() NOEXCEPT;
+        data_chunk* operator->() NOEXCEPT;
+
+    private:
+        data_chunk chunk_;
+    };
+
+    /// The pool of the calling thread.
+    static buffer_pool& local() NOEXCEPT;
+
+    /// Obtain an empty buffer with capacity of at least size.
+    buffer get(size_t size) NOEXCEPT;
+    data_chunk acquire(size_t size) NOEXCEPT;
+
+    /// Return buffers to the pool (contents are discarded).
+    void release(data_chunk&& chunk) NOEXCEPT;
+    void release(data_stack&& chunks) NOEXCEPT;
+
+    /// Release all retained buffers and reset counters.
+    void clear() NOEXCEPT;
+
+    /// Acquisitions satisfied by a retained buffer (hits) or not (misses).
+    size_t hits() const NOEXCEPT;
+    size_t misses() const NOEXCEPT;
+
+    /// Count and total capacity of retained buffers.
+    size_t retained() const NOEXCEPT;
+    size_t retained_bytes() const NOEXCEPT;
+
+private:
+    // Classes are log2 of capacity, from minimum_size to maximum_size.
+    static constexpr size_t minimum_class = 6;
+    static constexpr size_t maximum_class = 22;
+    static constexpr size_t classes = maximum_class - minimum_class + 1u;
+    static_assert(minimum_size == (size_t{ 1 } << minimum_class));
+    static_assert(maximum_size == (size_t{ 1 } << maximum_class));
+
+    buffer_pool() NOEXCEPT;
+
+    // Not thread safe (thread-local).
+    std_array<data_stack, classes> free_;
+    size_t hits_{};
+    size_t misses_{};
+    size_t retained_{};
+    size_t retained_bytes_{};
+};
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -20,6 +20,7 @@
 #define LIBBITCOIN_SYSTEM_DATA_DATA_HPP
 
 #include <bitcoin/system/data/array_cast.hpp>
+#include <bitcoin/system/data/buffer_pool.hpp>
 #include <bitcoin/system/data/byte_cast.hpp>
 #include <bitcoin/system/data/collection.hpp>
 #include <bitcoin/system/data/data_array.hpp>
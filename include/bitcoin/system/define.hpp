@@ -93,6 +93,12 @@ namespace libbitcoin
     constexpr auto have_sha = false;
 #endif
 
+#if defined(HAVE_AES)
+    constexpr auto have_aes = true;
+#else
+    constexpr auto have_aes = false;
+#endif
+
 } // namespace libbitcoin
 
 /// Create bc namespace alias.
@@ -69,6 +69,9 @@ enum block_error_t : uint8_t
     // confirm block
     unspent_coinbase_collision,
 
+    // deserialize block
+    malformed_block,
+
     // not currently used
     block_error_last
 };
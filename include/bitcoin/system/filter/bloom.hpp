@@ -47,6 +47,17 @@ public:
     /// Add fingerprint to bloom.
     static constexpr type screen(type value, uint64_t entropy) NOEXCEPT;
 
+    /// Batch is_screened, out[n] = is_screened(values[n], entropies[n]).
+    template <size_t Count>
+    static constexpr void is_screened(std_array<bool, Count>& out,
+        const std_array<type, Count>& values,
+        const std_array<uint64_t, Count>& entropies) NOEXCEPT;
+
+    /// Batch screen, values[n] = screen(values[n], entropies[n]).
+    template <size_t Count>
+    static constexpr void screen(std_array<type, Count>& values,
+        const std_array<uint64_t, Count>& entropies) NOEXCEPT;
+
 protected:
     /// Effectively sentinel values.
     static constexpr type saturated = 0;
@@ -62,6 +73,9 @@ protected:
     /// Return the k bit selection for the entropy.
     static constexpr size_t get_bit(size_t k, uint64_t entropy) NOEXCEPT;
 
+    /// Return the mask of all k bit selections for the entropy.
+    static constexpr type get_mask(uint64_t entropy) NOEXCEPT;
+
     /// Is sentinel value for empty filter.
     static constexpr bool is_empty(type value) NOEXCEPT;
 
@@ -41,6 +41,12 @@ public:
         uint8_t bits, const siphash_key& entropy,
         uint64_t target_false_positive_rate) NOEXCEPT;
 
+    /// Items are slices, such as into a single contiguous buffer.
+    static void construct(bitwriter& writer,
+        const std_vector<data_slice>& items, uint8_t bits,
+        const siphash_key& entropy,
+        uint64_t target_false_positive_rate) NOEXCEPT;
+
     static data_chunk construct(const data_stack& items,
         uint8_t bits, const siphash_key& entropy,
         uint64_t target_false_positive_rate) NOEXCEPT;
@@ -92,7 +98,11 @@ private:
         uint8_t modulo_exponent) NOEXCEPT;
     static uint64_t hash_to_range(const data_slice& item,
         uint64_t bound, const siphash_key& key) NOEXCEPT;
-    static std::vector<uint64_t> hashed_set_construct(const data_stack& items,
+    static void encode_set(bitwriter& writer,
+        const std::vector<uint64_t>& set, uint8_t bits) NOEXCEPT;
+
+    template <typename Items>
+    static std::vector<uint64_t> hashed_set_construct(const Items& items,
         uint64_t set_size, uint64_t target_false_positive_rate,
         const siphash_key& key) NOEXCEPT;
 };
@@ -54,6 +54,17 @@ public:
     /// return != value && return != saturated: value added to sieve.
     static constexpr type screen(type value, uint64_t entropy) NOEXCEPT;
 
+    /// Batch is_screened, out[n] = is_screened(values[n], entropies[n]).
+    template <size_t Count>
+    static constexpr void is_screened(std_array<bool, Count>& out,
+        const std_array<type, Count>& values,
+        const std_array<uint64_t, Count>& entropies) NOEXCEPT;
+
+    /// Batch screen, values[n] = screen(values[n], entropies[n]).
+    template <size_t Count>
+    static constexpr void screen(std_array<type, Count>& values,
+        const std_array<uint64_t, Count>& entropies) NOEXCEPT;
+
 protected:
     static constexpr auto screen_bits = SieveBits - SelectBits;
     static constexpr auto screens = power2(SelectBits);
@@ -83,6 +94,9 @@ protected:
 
     /// Is sentinel value for saturated filter.
     static constexpr bool is_saturated(type value) NOEXCEPT;
+
+    /// Branchless is_screened, evaluates all masks of the selected screen.
+    static constexpr bool is_matched(type value, uint64_t entropy) NOEXCEPT;
 };
 
 } // namespace system
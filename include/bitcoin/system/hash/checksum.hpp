@@ -19,6 +19,7 @@
 #ifndef LIBBITCOIN_SYSTEM_HASH_CHECKSUM_HPP
 #define LIBBITCOIN_SYSTEM_HASH_CHECKSUM_HPP
 
+#include <string_view>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/radix/radix.hpp>
@@ -87,6 +88,56 @@ BC_API bool bech32_verify_checked(uint8_t& out_version,
     data_chunk& out_program, const std::string& prefix,
     const base32_chunk& checked) NOEXCEPT;
 
+// bech32 codec, used by witness_address.
+// ----------------------------------------------------------------------------
+
+/// These combine the above with base32 encoding, writing to fixed buffers
+/// without intermediate allocation. Results are identical to the composition
+/// of bech32_build_checked with encode_base32, and of decode_base32 with
+/// bech32_verify_checked, within the BIP173 length limit.
+
+/// BIP173 string length limit, and the largest program within it (given a
+/// prefix, which is required to decode).
+static constexpr size_t bech32_maximum_length = 90;
+static constexpr size_t bech32_program_maximum = 50;
+
+typedef std_array<char, bech32_maximum_length> bech32_chars;
+typedef data_array<bech32_program_maximum> bech32_bytes;
+
+/// Encoded text, size is zero if not encoded.
+struct bech32_text
+{
+    size_t size;
+    bech32_chars chars;
+};
+
+/// Witness version and program (referenced), for batch encoding.
+struct bech32_witness
+{
+    uint8_t version;
+    data_slice program;
+};
+
+/// Write [prefix][1][version][program][checksum] to out, returns the number
+/// of characters written. Zero if version exceeds 5 bits or the result would
+/// exceed bech32_maximum_length. The prefix is written as given (lower case
+/// is required for witness addresses), but checksummed as lower case.
+BC_API size_t bech32_encode(bech32_chars& out, uint8_t version,
+    const data_slice& program, const std::string_view& prefix) NOEXCEPT;
+
+/// Encode witness programs of a common prefix concurrently, in order. The
+/// prefix is checksummed once for all programs.
+BC_API void bech32_encode(std_vector<bech32_text>& out,
+    const std_vector<bech32_witness>& programs,
+    const std::string_view& prefix) NOEXCEPT;
+
+/// Decode and verify the payload (following the separator) of a bech32 string,
+/// extracting witness version and program (out_size bytes of out_program).
+/// False if the payload exceeds (bech32_maximum_length - 2) characters.
+BC_API bool bech32_decode(uint8_t& out_version, size_t& out_size,
+    bech32_bytes& out_program, const std::string_view& prefix,
+    const std::string_view& payload) NOEXCEPT;
+
 } // namespace system
 } // namespace libbitcoin
 
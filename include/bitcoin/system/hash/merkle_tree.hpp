@@ -0,0 +1,72 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_HASH_MERKLE_TREE_HPP
+#define LIBBITCOIN_SYSTEM_HASH_MERKLE_TREE_HPP
+
+#include <vector>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/functions.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+/// Incremental merkle tree of bitcoin_hash leaves [chain].
+/// Each level retains the hashes of its complete pairs, so an append or a
+/// replacement rehashes at most one path (log n) and the root is obtained by
+/// hashing only the partial right edge (log n). The root is that of
+/// merkle_root(leaves), including duplication of the last of an odd level.
+class BC_API merkle_tree
+{
+public:
+    /// Empty tree (null_hash root).
+    merkle_tree() NOEXCEPT;
+
+    /// Tree of leaves, as by append(leaves).
+    merkle_tree(hashes&& leaves) NOEXCEPT;
+
+    /// The number of leaves.
+    size_t size() const NOEXCEPT;
+
+    /// Equivalent to merkle_root(leaves).
+    hash_digest root() const NOEXCEPT;
+
+    /// Append a leaf, hashing each pair that it completes.
+    void append(const hash_digest& leaf) NOEXCEPT;
+
+    /// Append leaves, hashing completed pairs level by level as vectorized
+    /// batches, with the pairs of large levels divided for concurrency.
+    void append(hashes&& leaves) NOEXCEPT;
+
+    /// Replace the leaf at index and rehash its path, false if not found.
+    bool replace(size_t index, const hash_digest& leaf) NOEXCEPT;
+
+private:
+    // Pairs per concurrent batch (subtree reduction of large levels).
+    static constexpr size_t batch = 2048;
+
+    static void reduce(hashes& to, const hashes& from) NOEXCEPT;
+
+    // levels_[0] is leaves, each level has a hash for each pair of the last.
+    std::vector<hashes> levels_;
+};
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -27,6 +27,7 @@
 #include <bitcoin/system/math/math.hpp>
 
 // algorithm.hpp file is the common include for sha.
+#include <bitcoin/system/hash/sha/dispatch.hpp>
 #include <bitcoin/system/hash/sha/sha.hpp>
 #include <bitcoin/system/hash/sha/sha160.hpp>
 #include <bitcoin/system/hash/sha/sha256.hpp>
@@ -161,6 +162,30 @@ public:
     static constexpr digests_t& merkle_hash(digests_t& digests) NOEXCEPT;
     static constexpr digest_t merkle_root(digests_t&& digests) NOEXCEPT;
 
+    /// Runtime kernels (see dispatch.hpp).
+    /// -----------------------------------------------------------------------
+
+    /// Public entry points of a kernel unit, installed once (on first use).
+    /// Null entries (no unit installed) use the compiled (baseline) paths.
+    struct kernels_t
+    {
+        digest_t(*hash_blocks)(iblocks_t&&) NOEXCEPT;
+        digest_t(*hash_block)(const block_t&) NOEXCEPT;
+        digest_t(*hash_half)(const half_t&) NOEXCEPT;
+        digest_t(*hash_halves)(const half_t&, const half_t&) NOEXCEPT;
+        digest_t(*hash_quarts)(const quart_t&, const quart_t&) NOEXCEPT;
+        digest_t(*double_hash_blocks)(iblocks_t&&) NOEXCEPT;
+        digest_t(*double_hash_block)(const block_t&) NOEXCEPT;
+        digest_t(*double_hash_half)(const half_t&) NOEXCEPT;
+        digest_t(*double_hash_halves)(const half_t&, const half_t&) NOEXCEPT;
+        void(*accumulate_blocks)(state_t&, iblocks_t&&) NOEXCEPT;
+        void(*accumulate_block)(state_t&, const block_t&) NOEXCEPT;
+        digest_t(*finalize)(state_t&, size_t) NOEXCEPT;
+        digest_t(*finalize_second)(const state_t&) NOEXCEPT;
+        digest_t(*finalize_double)(state_t&, size_t) NOEXCEPT;
+        digests_t&(*merkle_hash)(digests_t&) NOEXCEPT;
+    };
+
 protected:
     /// Intrinsics constants.
     /// -----------------------------------------------------------------------
@@ -179,6 +204,20 @@ protected:
             (use_256 ? bytes<256> :
                 (use_512 ? bytes<512> : 0))) / SHA::word_bytes;
 
+    /// Runtime kernel selection (compiled kernels only, see dispatch.hpp).
+    /// -----------------------------------------------------------------------
+
+    /// Selected kernels (detected upon first call).
+    INLINE static uint8_t selected() NOEXCEPT;
+
+    /// Installed kernel table entry (sha256/sha512 aliases only, or null).
+    template <typename Kernel>
+    INLINE static Kernel dispatch(Kernel kernels_t::* kernel) NOEXCEPT;
+    INLINE static bool have_native() NOEXCEPT;
+    INLINE static bool have_vector() NOEXCEPT;
+    template <typename xWord>
+    INLINE static bool have_kernel() NOEXCEPT;
+
     /// Intrinsics types.
     /// -----------------------------------------------------------------------
 
@@ -463,6 +502,10 @@ public:
     static constexpr auto vector = (use_128 || use_256 || use_512);
 };
 
+/// Kernel tables of the dispatched algorithms (installed on first use).
+extern BC_API algorithm<h256<>>::kernels_t sha256_kernels;
+extern BC_API algorithm<h512<>>::kernels_t sha512_kernels;
+
 } // namespace sha
 } // namespace system
 } // namespace libbitcoin
@@ -479,6 +522,7 @@ BC_PUSH_WARNING(NO_ARRAY_INDEXING)
 
 #include <bitcoin/system/impl/hash/sha/algorithm_compress.ipp>
 #include <bitcoin/system/impl/hash/sha/algorithm_konstant.ipp>
+#include <bitcoin/system/impl/hash/sha/algorithm_dispatch.ipp>
 #include <bitcoin/system/impl/hash/sha/algorithm_double.ipp>
 #include <bitcoin/system/impl/hash/sha/algorithm_functions.ipp>
 #include <bitcoin/system/impl/hash/sha/algorithm_iterate.ipp>
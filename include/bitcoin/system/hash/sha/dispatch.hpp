@@ -0,0 +1,84 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_HASH_SHA_DISPATCH_HPP
+#define LIBBITCOIN_SYSTEM_HASH_SHA_DISPATCH_HPP
+
+#include <atomic>
+#include <bitcoin/system/define.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace sha {
+
+/// Runtime selection of sha kernels.
+/// Kernels are compiled in according to build configuration (have_sha and
+/// have_128/256/512) and, on x86/x64, also into kernel units that are each
+/// compiled with the flags of one vector width (sse4.1, avx2, avx512bw), so
+/// that a baseline build carries all kernels. Detection is performed once, on
+/// first use, and the widest supported kernel unit is installed into the
+/// sha256 and sha512 kernel tables (see algorithm.hpp). Each kernel is used
+/// only if supported by the executing cpu. The selection may be narrowed
+/// (never widened) for testing and benchmarking.
+enum kernel : uint8_t
+{
+    none = 0,
+
+    /// sse4.1 or neon (4 x 32 bit lanes).
+    vector128 = 0x01,
+
+    /// avx2 (8 x 32 bit lanes).
+    vector256 = 0x02,
+
+    /// avx512bw (16 x 32 bit lanes).
+    vector512 = 0x04,
+
+    /// sha-ni or arm crypto (sha256 only).
+    native = 0x08,
+
+    all = vector128 | vector256 | vector512 | native,
+
+    /// Selection prior to detection (not a kernel).
+    unresolved = 0x80
+};
+
+/// Kernels currently selected, read inline by sha::algorithm.
+/// This is kernel::unresolved until first use (of any of the functions below
+/// or of the sha256/sha512 dispatched entry points), then the detected kernels
+/// unless narrowed.
+extern BC_API std::atomic<uint8_t> kernel_selection;
+
+/// Kernels compiled into this build (including kernel units).
+BC_API uint8_t compiled_kernels() NOEXCEPT;
+
+/// Compiled kernels supported by the executing cpu.
+BC_API uint8_t detected_kernels() NOEXCEPT;
+
+/// Kernels currently selected (detected kernels, unless narrowed).
+BC_API uint8_t selected_kernels() NOEXCEPT;
+
+/// Narrow selection to the given kernels (within detected), returns result.
+/// Use kernel::all to restore detected selection, kernel::none for normal.
+/// Selection is process-wide and should not be changed while hashing.
+BC_API uint8_t select_kernels(uint8_t kernels) NOEXCEPT;
+
+} // namespace sha
+} // namespace system
+} // namespace libbitcoin
+
+#endif
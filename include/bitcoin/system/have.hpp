@@ -150,6 +150,12 @@
         #define HAVE_SHANI
         #define HAVE_SHA
     #endif
+    // -maes
+    // vc++: AESNI not independently configurable (aes256 uses cpuid).
+    #if defined(__AES__)
+        #define HAVE_AESNI
+        #define HAVE_AES
+    #endif
     // -mavx512bw
     // vc++: Advanced Vector Extensions 512 (X86/X64) (/arch:AVX512)
     #if defined(__AVX512BW__)
@@ -178,6 +184,7 @@
     #if defined(__ARM_FEATURE_CRYPTO)
         #define HAVE_CRYPTO
         #define HAVE_SHA
+        #define HAVE_AES
     #endif
     // -march=armv8-a+sve
     // Requires 64 bit build.
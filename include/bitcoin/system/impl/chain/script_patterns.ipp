@@ -390,6 +390,91 @@ inline operations script::to_pay_witness_script_hash_pattern(
     };
 }
 
+// Serialized patterns.
+// ----------------------------------------------------------------------------
+// These match the corresponding operations patterns exactly, but operate on
+// the serialized script (without prefix), avoiding operation parsing.
+
+constexpr bool script::is_witness_program_pattern(
+    const data_slice& script) NOEXCEPT
+{
+    // Any minimal push of 2..40 bytes is a single byte push_size_n opcode.
+    const auto size = script.size();
+    return size >= add1(add1(min_witness_program))
+        && size <= add1(add1(max_witness_program))
+        && operation::is_nonnegative(static_cast<opcode>(script[0]))
+        && script[1] == sub1(sub1(size));
+}
+
+constexpr bool script::is_pay_key_hash_pattern(
+    const data_slice& script) NOEXCEPT
+{
+    // The hash push is not required to be minimally encoded, so sizes are
+    // 25 (direct), 26 (one byte size), 27 (two byte size), 29 (four byte size).
+    constexpr auto hash = static_cast<uint8_t>(short_hash_size);
+    constexpr auto dup = static_cast<uint8_t>(opcode::dup);
+    constexpr auto hash160 = static_cast<uint8_t>(opcode::hash160);
+    constexpr auto equalverify = static_cast<uint8_t>(opcode::equalverify);
+    constexpr auto checksig = static_cast<uint8_t>(opcode::checksig);
+    constexpr auto push1 = static_cast<uint8_t>(opcode::push_one_size);
+    constexpr auto push2 = static_cast<uint8_t>(opcode::push_two_size);
+    constexpr auto push4 = static_cast<uint8_t>(opcode::push_four_size);
+
+    const auto size = script.size();
+    if (size < 25u || size > 29u ||
+        script[0] != dup || script[1] != hash160 ||
+        script[size - 2u] != equalverify || script[size - 1u] != checksig)
+        return false;
+
+    switch (size)
+    {
+        case 25u:
+            return script[2] == hash;
+        case 26u:
+            return script[2] == push1 && script[3] == hash;
+        case 27u:
+            return script[2] == push2 && script[3] == hash && is_zero(script[4]);
+        case 29u:
+            return script[2] == push4 && script[3] == hash && is_zero(script[4])
+                && is_zero(script[5]) && is_zero(script[6]);
+        default:
+            return false;
+    }
+}
+
+constexpr bool script::is_pay_script_hash_pattern(
+    const data_slice& script) NOEXCEPT
+{
+    return script.size() == 23u
+        && script[0] == static_cast<uint8_t>(opcode::hash160)
+        && script[1] == static_cast<uint8_t>(opcode::push_size_20)
+        && script[22] == static_cast<uint8_t>(opcode::equal);
+}
+
+constexpr bool script::is_pay_witness_key_hash_pattern(
+    const data_slice& script) NOEXCEPT
+{
+    return script.size() == 22u
+        && script[0] == static_cast<uint8_t>(opcode::push_size_0)
+        && script[1] == static_cast<uint8_t>(opcode::push_size_20);
+}
+
+constexpr bool script::is_pay_witness_script_hash_pattern(
+    const data_slice& script) NOEXCEPT
+{
+    return script.size() == 34u
+        && script[0] == static_cast<uint8_t>(opcode::push_size_0)
+        && script[1] == static_cast<uint8_t>(opcode::push_size_32);
+}
+
+constexpr bool script::is_pay_taproot_pattern(
+    const data_slice& script) NOEXCEPT
+{
+    return script.size() == 34u
+        && script[0] == static_cast<uint8_t>(opcode::push_positive_1)
+        && script[1] == static_cast<uint8_t>(opcode::push_size_32);
+}
+
 // private
 inline size_t script::op_size(size_t total, const operation& op) NOEXCEPT
 {
@@ -399,15 +484,17 @@ inline size_t script::op_size(size_t total, const operation& op) NOEXCEPT
 // This is an optimization over using script::pattern.
 inline bool script::is_pay_to_witness(uint32_t active_flags) const NOEXCEPT
 {
-    return is_enabled(active_flags, flags::bip141_rule) &&
-        is_witness_program_pattern(ops());
+    return is_enabled(active_flags, flags::bip141_rule) && (bytes_.empty() ?
+        is_witness_program_pattern(ops()) :
+        is_witness_program_pattern(bytes_));
 }
 
 // This is an optimization over using script::pattern.
 inline bool script::is_pay_to_script_hash(uint32_t active_flags) const NOEXCEPT
 {
-    return is_enabled(active_flags, flags::bip16_rule) &&
-        is_pay_script_hash_pattern(ops());
+    return is_enabled(active_flags, flags::bip16_rule) && (bytes_.empty() ?
+        is_pay_script_hash_pattern(ops()) :
+        is_pay_script_hash_pattern(bytes_));
 }
 
 BC_POP_WARNING()
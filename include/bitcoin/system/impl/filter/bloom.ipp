@@ -69,6 +69,47 @@ constexpr CLASS::type CLASS::screen(type value, uint64_t entropy) NOEXCEPT
     }
 }
 
+// Batch screening over arrays of fingerprints, for bulk ingestion. Each
+// entropy is reduced to a single mask of its K bits, making both operations
+// branchless and therefore vectorizable across elements.
+
+BC_PUSH_WARNING(NO_DYNAMIC_ARRAY_INDEXING)
+
+TEMPLATE
+template <size_t Count>
+constexpr void CLASS::is_screened(std_array<bool, Count>& out,
+    const std_array<type, Count>& values,
+    const std_array<uint64_t, Count>& entropies) NOEXCEPT
+{
+    if constexpr (disabled)
+    {
+        out.fill(true);
+    }
+    else
+    {
+        // All selected bits are set (to zero, default is one).
+        for (size_t index{}; index < Count; ++index)
+            out[index] = !is_empty(values[index]) &&
+                is_zero(bit_and(values[index], get_mask(entropies[index])));
+    }
+}
+
+TEMPLATE
+template <size_t Count>
+constexpr void CLASS::screen(std_array<type, Count>& values,
+    const std_array<uint64_t, Count>& entropies) NOEXCEPT
+{
+    if constexpr (!disabled)
+    {
+        // Saturated is zero, so is unchanged by the mask.
+        for (size_t index{}; index < Count; ++index)
+            values[index] = bit_and(values[index],
+                bit_not(get_mask(entropies[index])));
+    }
+}
+
+BC_POP_WARNING()
+
 // protected
 // ----------------------------------------------------------------------------
 
@@ -102,6 +143,16 @@ constexpr size_t CLASS::get_bit(size_t k, uint64_t entropy) NOEXCEPT
     }
 }
 
+TEMPLATE
+constexpr CLASS::type CLASS::get_mask(uint64_t entropy) NOEXCEPT
+{
+    type mask{};
+    for (auto k = zero; k < K; ++k)
+        mask = bit_or(mask, bit_right<type>(get_bit(k, entropy)));
+
+    return mask;
+}
+
 } // namespace system
 } // namespace libbitcoin
 
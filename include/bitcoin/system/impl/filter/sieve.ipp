@@ -146,9 +146,66 @@ constexpr CLASS::type CLASS::screen(type value, uint64_t entropy) NOEXCEPT
     }
 }
 
+// Batch screening over arrays of fingerprints, for bulk ingestion. The
+// is_screened loop is free of data-dependent branches, so that the compiler
+// can vectorize the mask table lookup across elements (gather/compare).
+// Screening mutates each value based on its own state, so it is not
+// vectorized, but it is only required for values that are not screened.
+
+TEMPLATE
+template <size_t Count>
+constexpr void CLASS::is_screened(std_array<bool, Count>& out,
+    const std_array<type, Count>& values,
+    const std_array<uint64_t, Count>& entropies) NOEXCEPT
+{
+    if constexpr (disabled)
+    {
+        out.fill(true);
+    }
+    else
+    {
+        for (size_t index{}; index < Count; ++index)
+            out[index] = is_matched(values[index], entropies[index]);
+    }
+}
+
+TEMPLATE
+template <size_t Count>
+constexpr void CLASS::screen(std_array<type, Count>& values,
+    const std_array<uint64_t, Count>& entropies) NOEXCEPT
+{
+    if constexpr (!disabled)
+    {
+        std_array<bool, Count> screened{};
+        is_screened(screened, values, entropies);
+
+        for (size_t index{}; index < Count; ++index)
+            if (!screened[index])
+                values[index] = screen(values[index], entropies[index]);
+    }
+}
+
 // protected
 // ----------------------------------------------------------------------------
 
+TEMPLATE
+constexpr bool CLASS::is_matched(type value, uint64_t entropy) NOEXCEPT
+{
+    // Empty and saturated sentinels both select the limit screen.
+    const auto row = shift_right(value, screen_bits);
+    const auto difference = bit_xor(value, possible_narrow_cast<type>(entropy));
+
+    auto matched = false;
+    for (size_t column{}; column < screens; ++column)
+    {
+        const auto active = column <= row;
+        const auto mask = masks(row, active ? column : row);
+        matched |= active && is_zero(bit_and(difference, mask));
+    }
+
+    return is_saturated(value) || (!is_empty(value) && matched);
+}
+
 TEMPLATE
 constexpr bool CLASS::is_empty(type value) NOEXCEPT
 {
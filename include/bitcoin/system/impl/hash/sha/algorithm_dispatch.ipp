@@ -0,0 +1,120 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_HASH_SHA_ALGORITHM_DISPATCH_IPP
+#define LIBBITCOIN_SYSTEM_HASH_SHA_ALGORITHM_DISPATCH_IPP
+
+// Runtime dispatch
+// ============================================================================
+// Kernels not compiled in are excluded at compile time (constexpr false), so
+// there is no runtime cost for them. Compiled kernels are gated on the cpu
+// (detected once, on first use) and any narrowing of the selection by
+// sha::select_kernels, which is read inline from sha::kernel_selection. The
+// sha256/sha512 public entry points first branch on the kernel table entry
+// installed upon detection, which is a kernel unit compiled for the widest
+// vector width supported by the cpu (null if none, or if none selected).
+
+// protected
+// ----------------------------------------------------------------------------
+
+namespace libbitcoin {
+namespace system {
+namespace sha {
+
+TEMPLATE
+INLINE uint8_t CLASS::
+selected() NOEXCEPT
+{
+    // Acquire, as kernel tables are installed before selection is released.
+    const auto selected = kernel_selection.load(std::memory_order_acquire);
+    return selected == kernel::unresolved ? selected_kernels() : selected;
+}
+
+TEMPLATE
+template <typename Kernel>
+INLINE Kernel CLASS::
+dispatch(Kernel kernels_t::* kernel) NOEXCEPT
+{
+    if constexpr (is_same_type<CLASS, algorithm<h256<>>>)
+        return is_zero(selected()) ? nullptr : sha256_kernels.*kernel;
+    else if constexpr (is_same_type<CLASS, algorithm<h512<>>>)
+        return is_zero(selected()) ? nullptr : sha512_kernels.*kernel;
+    else
+        return nullptr;
+}
+
+TEMPLATE
+INLINE bool CLASS::
+have_native() NOEXCEPT
+{
+    if constexpr (native)
+    {
+        return !is_zero(bit_and<uint8_t>(selected(), kernel::native));
+    }
+    else
+    {
+        return false;
+    }
+}
+
+TEMPLATE
+INLINE bool CLASS::
+have_vector() NOEXCEPT
+{
+    if constexpr (vector)
+    {
+        constexpr auto vectors = bit_or<uint8_t>(
+            bit_or<uint8_t>(
+                use_128 ? kernel::vector128 : kernel::none,
+                use_256 ? kernel::vector256 : kernel::none),
+            use_512 ? kernel::vector512 : kernel::none);
+
+        return !is_zero(bit_and<uint8_t>(selected(), vectors));
+    }
+    else
+    {
+        return false;
+    }
+}
+
+TEMPLATE
+template <typename xWord>
+INLINE bool CLASS::
+have_kernel() NOEXCEPT
+{
+    constexpr auto width =
+        (is_same_type<xWord, xint512_t> && use_512) ? kernel::vector512 :
+        (is_same_type<xWord, xint256_t> && use_256) ? kernel::vector256 :
+        (is_same_type<xWord, xint128_t> && use_128) ? kernel::vector128 :
+            kernel::none;
+
+    if constexpr (width != kernel::none)
+    {
+        return !is_zero(bit_and<uint8_t>(selected(), width));
+    }
+    else
+    {
+        return false;
+    }
+}
+
+} // namespace sha
+} // namespace system
+} // namespace libbitcoin
+
+#endif
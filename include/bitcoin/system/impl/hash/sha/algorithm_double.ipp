@@ -39,6 +39,12 @@ double_hash(const ablocks_t<Size>& blocks) NOEXCEPT
 {
     static_assert(is_same_type<state_t, chunk_t>);
 
+    if (!std::is_constant_evaluated())
+    {
+        if (const auto kernel = dispatch(&kernels_t::double_hash_blocks))
+            return kernel(iblocks_t{ array_cast<byte_t>(blocks) });
+    }
+
     auto state = H::get;
     iterate(state, blocks);
 
@@ -48,12 +54,11 @@ double_hash(const ablocks_t<Size>& blocks) NOEXCEPT
     }
     else if constexpr (native)
     {
-        return native_finalize_double(state, Size);
-    }
-    else
-    {
-        return finalize_double(state, Size);
+        if (have_native())
+            return native_finalize_double(state, Size);
     }
+
+    return finalize_double(state, Size);
 }
 
 TEMPLATE
@@ -62,6 +67,9 @@ double_hash(iblocks_t&& blocks) NOEXCEPT
 {
     static_assert(is_same_type<state_t, chunk_t>);
 
+    if (const auto kernel = dispatch(&kernels_t::double_hash_blocks))
+        return kernel(std::move(blocks));
+
     // Save block count, as iterable decrements.
     const auto count = blocks.size();
 
@@ -70,12 +78,11 @@ double_hash(iblocks_t&& blocks) NOEXCEPT
 
     if constexpr (native)
     {
-        return native_finalize_double(state, count);
-    }
-    else
-    {
-        return finalize_double(state, count);
+        if (have_native())
+            return native_finalize_double(state, count);
     }
+
+    return finalize_double(state, count);
 }
 
 TEMPLATE
@@ -108,14 +115,17 @@ double_hash(const block_t& block) NOEXCEPT
     {
         return hasher(block);
     }
-    else if constexpr (native)
+    else if (const auto kernel = dispatch(&kernels_t::double_hash_block))
     {
-        return native_double_hash(block);
+        return kernel(block);
     }
-    else
+    else if constexpr (native)
     {
-        return hasher(block);
+        if (have_native())
+            return native_double_hash(block);
     }
+
+    return hasher(block);
 }
 
 TEMPLATE
@@ -147,14 +157,17 @@ double_hash(const half_t& half) NOEXCEPT
     {
         return hasher(half);
     }
-    else if constexpr (native)
+    else if (const auto kernel = dispatch(&kernels_t::double_hash_half))
     {
-        return native_double_hash(half);
+        return kernel(half);
     }
-    else
+    else if constexpr (native)
     {
-        return hasher(half);
+        if (have_native())
+            return native_double_hash(half);
     }
+
+    return hasher(half);
 }
 
 TEMPLATE
@@ -188,14 +201,17 @@ double_hash(const half_t& left, const half_t& right) NOEXCEPT
     {
         return hasher(left, right);
     }
-    else if constexpr (native)
+    else if (const auto kernel = dispatch(&kernels_t::double_hash_halves))
     {
-        return native_double_hash(left, right);
+        return kernel(left, right);
     }
-    else
+    else if constexpr (native)
     {
-        return hasher(left, right);
+        if (have_native())
+            return native_double_hash(left, right);
     }
+
+    return hasher(left, right);
 }
 
 } // namespace sha
@@ -208,11 +208,14 @@ iterate_vector(state_t& state, iblocks_t& blocks) NOEXCEPT
     {
         // Schedule iteration vector dispatch.
         if constexpr (use_512)
-            vector_schedule_sequential_compress<xint512_t>(state, blocks);
+            if (have_kernel<xint512_t>())
+                vector_schedule_sequential_compress<xint512_t>(state, blocks);
         if constexpr (use_256)
-            vector_schedule_sequential_compress<xint256_t>(state, blocks);
+            if (have_kernel<xint256_t>())
+                vector_schedule_sequential_compress<xint256_t>(state, blocks);
         if constexpr (use_128)
-            vector_schedule_sequential_compress<xint128_t>(state, blocks);
+            if (have_kernel<xint128_t>())
+                vector_schedule_sequential_compress<xint128_t>(state, blocks);
     }
 
     // Complete rounds using normal form.
@@ -299,14 +302,16 @@ iterate(state_t& state, const ablocks_t<Size>& blocks) NOEXCEPT
     {
         iterate_(state, blocks);
     }
-    else if constexpr (native)
+    else if (have_native())
     {
-        iterate_native(state, blocks);
+        if constexpr (native)
+            iterate_native(state, blocks);
     }
-    else if constexpr (vector)
+    else if (have_vector())
     {
         // Multiple block vectorized message scheduling optimization.
-        iterate_vector(state, blocks);
+        if constexpr (vector)
+            iterate_vector(state, blocks);
     }
     else
     {
@@ -318,14 +323,16 @@ TEMPLATE
 INLINE void CLASS::
 iterate(state_t& state, iblocks_t& blocks) NOEXCEPT
 {
-    if constexpr (native)
+    if (have_native())
     {
-        iterate_native(state, blocks);
+        if constexpr (native)
+            iterate_native(state, blocks);
     }
-    else if constexpr (vector)
+    else if (have_vector())
     {
         // Multiple block vectorized message scheduling optimization.
-        iterate_vector(state, blocks);
+        if constexpr (vector)
+            iterate_vector(state, blocks);
     }
     else
     {
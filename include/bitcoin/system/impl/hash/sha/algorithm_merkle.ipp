@@ -402,15 +402,18 @@ merkle_hash_vector(digests_t& digests) NOEXCEPT
 
         // Always use if available.
         if constexpr (use_512)
-            merkle_hash_vector<xint512_t>(idigests, iblocks);
+            if (have_kernel<xint512_t>())
+                merkle_hash_vector<xint512_t>(idigests, iblocks);
 
         // Only use if shani is not available.
-        if constexpr (use_256 && !native)
-            merkle_hash_vector<xint256_t>(idigests, iblocks);
+        if constexpr (use_256)
+            if (!have_native() && have_kernel<xint256_t>())
+                merkle_hash_vector<xint256_t>(idigests, iblocks);
 
         // Only use if shani is not available.
-        if constexpr (use_128 && !native)
-            merkle_hash_vector<xint128_t>(idigests, iblocks);
+        if constexpr (use_128)
+            if (!have_native() && have_kernel<xint128_t>())
+                merkle_hash_vector<xint128_t>(idigests, iblocks);
 
         // iblocks.size() is reduced by vectorization.
         next = start - iblocks.size();
@@ -458,11 +461,16 @@ merkle_hash(digests_t& digests) NOEXCEPT
     {
         merkle_hash_(digests);
     }
-    else if constexpr (vector)
+    else if (const auto kernel = dispatch(&kernels_t::merkle_hash))
+    {
+        return kernel(digests);
+    }
+    else if (have_vector())
     {
         // Merkle block vectorization is applied at 16/8/4 lanes (as available)
         // and falls back to native/normal (as available) for 3/2/1 lanes.
-        merkle_hash_vector(digests);
+        if constexpr (vector)
+            merkle_hash_vector(digests);
     }
     else
     {
@@ -137,10 +137,11 @@ schedule(buffer_t& buffer) NOEXCEPT
     {
         schedule_(buffer);
     }
-    else if constexpr (vector)
+    else if (have_vector())
     {
         // Single block (without shani) message scheduling optimization.
-        schedule_sigma(buffer);
+        if constexpr (vector)
+            schedule_sigma(buffer);
     }
     else
     {
@@ -97,6 +97,12 @@ schedule_sigma(buffer_t& buffer) NOEXCEPT
 {
     if constexpr (SHA::strength != 160 && have_lanes<word_t, 8>)
     {
+        if (!have_kernel<to_extended<word_t, 8>>())
+        {
+            schedule_(buffer);
+            return;
+        }
+
         prepare_8<16>(buffer);
         prepare_8<24>(buffer);
         prepare_8<32>(buffer);
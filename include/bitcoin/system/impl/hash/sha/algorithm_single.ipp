@@ -34,6 +34,12 @@ template <size_t Size>
 constexpr typename CLASS::digest_t CLASS::
 hash(const ablocks_t<Size>& blocks) NOEXCEPT
 {
+    if (!std::is_constant_evaluated())
+    {
+        if (const auto kernel = dispatch(&kernels_t::hash_blocks))
+            return kernel(iblocks_t{ array_cast<byte_t>(blocks) });
+    }
+
     auto state = H::get;
     iterate(state, blocks);
     return finalize<Size>(state);
@@ -43,6 +49,9 @@ TEMPLATE
 typename CLASS::digest_t CLASS::
 hash(iblocks_t&& blocks) NOEXCEPT
 {
+    if (const auto kernel = dispatch(&kernels_t::hash_blocks))
+        return kernel(std::move(blocks));
+
     // Save block count, as iterable decrements.
     const auto count = blocks.size();
     auto state = H::get;
@@ -59,16 +68,19 @@ hash(const block_t& block) NOEXCEPT
         // As an array of 1 arrays is same as the array, this compiles away.
         return hash(ablocks_t<one>{ block });
     }
-    else if constexpr (native)
+    else if (const auto kernel = dispatch(&kernels_t::hash_block))
     {
-        // Native hash() does not have an optimal array override.
-        return native_hash(block);
+        return kernel(block);
     }
-    else
+    else if constexpr (native)
     {
-        // As an array of 1 arrays is same as the array, this compiles away.
-        return hash(ablocks_t<one>{ block });
+        // Native hash() does not have an optimal array override.
+        if (have_native())
+            return native_hash(block);
     }
+
+    // As an array of 1 arrays is same as the array, this compiles away.
+    return hash(ablocks_t<one>{ block });
 }
 
 TEMPLATE
@@ -90,14 +102,17 @@ hash(const half_t& half) NOEXCEPT
     {
         return hasher(half);
     }
-    else if constexpr (native)
+    else if (const auto kernel = dispatch(&kernels_t::hash_half))
     {
-        return native_hash(half);
+        return kernel(half);
     }
-    else
+    else if constexpr (native)
     {
-        return hasher(half);
+        if (have_native())
+            return native_hash(half);
     }
+
+    return hasher(half);
 }
 
 TEMPLATE
@@ -121,14 +136,17 @@ hash(const half_t& left, const half_t& right) NOEXCEPT
     {
         return hasher(left, right);
     }
-    else if constexpr (native)
+    else if (const auto kernel = dispatch(&kernels_t::hash_halves))
     {
-        return native_hash(left, right);
+        return kernel(left, right);
     }
-    else
+    else if constexpr (native)
     {
-        return hasher(left, right);
+        if (have_native())
+            return native_hash(left, right);
     }
+
+    return hasher(left, right);
 }
 
 TEMPLATE
@@ -165,14 +183,17 @@ hash(const quart_t& left, const quart_t& right) NOEXCEPT
     {
         return hasher(left, right);
     }
-    else if constexpr (native)
+    else if (const auto kernel = dispatch(&kernels_t::hash_quarts))
     {
-        return native_hash(left, right);
+        return kernel(left, right);
     }
-    else
+    else if constexpr (native)
     {
-        return hasher(left, right);
+        if (have_native())
+            return native_hash(left, right);
     }
+
+    return hasher(left, right);
 }
 
 TEMPLATE
@@ -33,6 +33,9 @@ TEMPLATE
 void CLASS::
 accumulate(state_t& state, iblocks_t&& blocks) NOEXCEPT
 {
+    if (const auto kernel = dispatch(&kernels_t::accumulate_blocks))
+        return kernel(state, std::move(blocks));
+
     iterate(state, blocks);
 }
 
@@ -40,6 +43,12 @@ TEMPLATE
 constexpr void CLASS::
 accumulate(state_t& state, const block_t& block) NOEXCEPT
 {
+    if (!std::is_constant_evaluated())
+    {
+        if (const auto kernel = dispatch(&kernels_t::accumulate_block))
+            return kernel(state, block);
+    }
+
     // As an array of a 1 arrays is the same as the array, this compiles away.
     iterate(state, ablocks_t<one>{ block });
 }
@@ -69,14 +78,17 @@ finalize(state_t& state) NOEXCEPT
     {
         return finalizer(state);
     }
-    else if constexpr (native)
+    else if (const auto kernel = dispatch(&kernels_t::finalize))
     {
-        return native_finalize<Blocks>(state);
+        return kernel(state, Blocks);
     }
-    else
+    else if constexpr (native)
     {
-        return finalizer(state);
+        if (have_native())
+            return native_finalize<Blocks>(state);
     }
+
+    return finalizer(state);
 }
 
 TEMPLATE
@@ -95,14 +107,17 @@ finalize(state_t& state, size_t blocks) NOEXCEPT
     {
         return finalizer(state, blocks);
     }
-    else if constexpr (native)
+    else if (const auto kernel = dispatch(&kernels_t::finalize))
     {
-        return native_finalize(state, blocks);
+        return kernel(state, blocks);
     }
-    else
+    else if constexpr (native)
     {
-        return finalizer(state, blocks);
+        if (have_native())
+            return native_finalize(state, blocks);
     }
+
+    return finalizer(state, blocks);
 }
 
 TEMPLATE
@@ -128,14 +143,17 @@ finalize_second(const state_t& state) NOEXCEPT
     {
         return finalizer(state);
     }
-    else if constexpr (native)
+    else if (const auto kernel = dispatch(&kernels_t::finalize_second))
     {
-        return native_finalize_second(state);
+        return kernel(state);
     }
-    else
+    else if constexpr (native)
     {
-        return finalizer(state);
+        if (have_native())
+            return native_finalize_second(state);
     }
+
+    return finalizer(state);
 }
 
 TEMPLATE
@@ -163,14 +181,17 @@ finalize_double(state_t& state, size_t blocks) NOEXCEPT
     {
         return finalizer(state, blocks);
     }
-    else if constexpr (native)
+    else if (const auto kernel = dispatch(&kernels_t::finalize_double))
     {
-        return native_finalize_double(state, blocks);
+        return kernel(state, blocks);
     }
-    else
+    else if constexpr (native)
     {
-        return finalizer(state, blocks);
+        if (have_native())
+            return native_finalize_double(state, blocks);
     }
+
+    return finalizer(state, blocks);
 }
 
 } // namespace sha
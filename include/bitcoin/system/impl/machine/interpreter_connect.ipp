@@ -48,6 +48,14 @@ TEMPLATE
 code CLASS::
 connect(const chain::context& state, const chain::transaction& tx,
     const input_iterator& it) NOEXCEPT
+{
+    return connect(state, tx, it, false);
+}
+
+TEMPLATE
+code CLASS::
+connect(const chain::context& state, const chain::transaction& tx,
+    const input_iterator& it, bool committed) NOEXCEPT
 {
     using namespace chain;
     const auto& input = **it;
@@ -84,10 +92,11 @@ connect(const chain::context& state, const chain::transaction& tx,
             return error::dirty_witness;
 
         // Because output script pushed version and witness program [bip141].
-        if ((ec = connect_witness(state, tx, it, *prevout, false)))
+        if ((ec = connect_witness(state, tx, it, *prevout, false,
+            committed)))
             return ec;
     }
-    else if (!input.witness().stack().empty())
+    else if (!is_zero(input.witness().stack_size()))
     {
         // A non-witness program must have empty witness field [bip141].
         return error::unexpected_witness;
@@ -129,10 +138,11 @@ code CLASS::connect_embedded(const chain::context& state,
             return error::dirty_witness;
 
         // Because output script pushed version/witness program [bip141].
-        if ((ec = connect_witness(state, tx, it, *embedded, true)))
+        if ((ec = connect_witness(state, tx, it, *embedded, true,
+            false)))
             return ec;
     }
-    else if (!input.witness().stack().empty())
+    else if (!is_zero(input.witness().stack_size()))
     {
         // A non-witness program must have empty witness field [bip141].
         return error::unexpected_witness;
@@ -145,7 +155,7 @@ code CLASS::connect_embedded(const chain::context& state,
 TEMPLATE
 code CLASS::connect_witness(const chain::context& state,
     const chain::transaction& tx, const input_iterator& it,
-    const chain::script& prevout, bool embedded) NOEXCEPT
+    const chain::script& prevout, bool embedded, bool committed) NOEXCEPT
 {
     using namespace chain;
     const auto& input = **it;
@@ -192,7 +202,7 @@ code CLASS::connect_witness(const chain::context& state,
             script::cptr script;
             chunk_cptrs_ptr stack;
             if ((ec = input.witness().extract_taproot(tapleaf, script, stack,
-                prevout)))
+                prevout, committed)))
                 return ec;
 
             interpreter program(tx, it, script, flags, version, stack, tapleaf);
@@ -22,6 +22,7 @@
 #include <algorithm>
 #include <ranges>
 #include <string_view>
+#include <utility>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/math/math.hpp>
@@ -64,6 +65,19 @@ constexpr uint8_t from_base16_characters(char high, char low) NOEXCEPT
         from_base16_digit(low);
 }
 
+// data_chunk is not a literal type, so cannot be a constexpr local.
+inline bool decode_base16_chunk(data_chunk& out,
+    const std::string_view& in) NOEXCEPT
+{
+    // Vectorized/table decoding, out is unchanged if in is malformed.
+    data_chunk data(in.size() / octet_width);
+    if (!decode_base16(data_slab{ data }, in))
+        return false;
+
+    out = std::move(data);
+    return true;
+}
+
 // published
 // ============================================================================
 
@@ -97,8 +111,15 @@ constexpr std::string encode_base16(const data_slice& data) NOEXCEPT
 {
     std::string out;
     out.resize(data.size() * octet_width);
-    auto digit = out.begin();
 
+    if (!std::is_constant_evaluated())
+    {
+        // Vectorized/table encoding into the sized string (cannot fail).
+        encode_base16(data_slab{ out }, data);
+        return out;
+    }
+
+    auto digit = out.begin();
     for (const auto byte: data)
     {
         *digit++ = to_base16_character(shift_right(byte, to_half(byte_bits)));
@@ -133,6 +154,9 @@ constexpr bool decode_base16(data_chunk& out,
     if (!is_multiple(in.size(), octet_width))
         return false;
 
+    if (!std::is_constant_evaluated())
+        return decode_base16_chunk(out, in);
+
     if (!std::all_of(in.begin(), in.end(), is_base16<char>))
         return false;
 
@@ -156,6 +180,17 @@ constexpr bool decode_base16(data_array<Size>& out,
     if (!is_product(in.size(), octet_width, Size))
         return false;
 
+    if (!std::is_constant_evaluated())
+    {
+        // Vectorized/table decoding, out is unchanged if in is malformed.
+        data_array<Size> data{};
+        if (!decode_base16(data_slab{ data }, in))
+            return false;
+
+        out = data;
+        return true;
+    }
+
     if (!std::all_of(in.begin(), in.end(), is_base16<char>))
         return false;
 
@@ -0,0 +1,266 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_UTREEXO_FOREST_IPP
+#define LIBBITCOIN_SYSTEM_UTREEXO_FOREST_IPP
+
+#include <bit>
+#include <tuple>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace utreexo {
+
+// Hashing.
+// ----------------------------------------------------------------------------
+
+constexpr node_hash parent_hash(const node_hash& left,
+    const node_hash& right) NOEXCEPT
+{
+    return sha512_256::hash(left, right);
+}
+
+// Position math.
+// ----------------------------------------------------------------------------
+
+constexpr uint64_t parent(uint64_t child, uint8_t forest_rows) NOEXCEPT
+{
+    return set_right(shift_right(child), forest_rows);
+}
+
+constexpr uint64_t children(uint64_t parent, uint8_t forest_rows) NOEXCEPT
+{
+    // What happens when these bits are lost?
+    BC_ASSERT(!is_left_shift_overflow(parent, add1<size_t>(forest_rows)));
+
+    return bit_and(shift_left(parent),
+        unmask_right<uint64_t>(add1<size_t>(forest_rows)));
+}
+
+constexpr uint64_t left_child(uint64_t parent, uint8_t forest_rows) NOEXCEPT
+{
+    return children(parent, forest_rows);
+}
+
+constexpr uint64_t right_child(uint64_t parent, uint8_t forest_rows) NOEXCEPT
+{
+    // What happens when these bits are lost?
+    BC_ASSERT(!is_add_overflow<uint64_t>(children(parent, forest_rows), one));
+
+    return add1(children(parent, forest_rows));
+}
+
+constexpr uint64_t left_sibling(uint64_t node) NOEXCEPT
+{
+    return set_right(node, zero, false);
+}
+
+constexpr bool is_left_niece(uint64_t node) NOEXCEPT
+{
+    return !get_right(node);
+}
+
+constexpr bool is_right_sibling(uint64_t node, uint64_t next) NOEXCEPT
+{
+    return set_right(node) == next;
+}
+
+constexpr bool is_sibling(uint64_t node1, uint64_t node2) NOEXCEPT
+{
+    return bit_xor<uint64_t>(node1, one) == node2;
+}
+
+constexpr bool is_root_populated(uint64_t leaves, uint8_t row) NOEXCEPT
+{
+    return get_right(leaves, row);
+}
+
+constexpr uint8_t detect_row(uint64_t node, uint8_t forest_rows) NOEXCEPT
+{
+    auto bit = forest_rows;
+    while (!is_zero(bit) && get_right(node, bit)) { --bit; }
+    return subtract(forest_rows, bit);
+}
+
+constexpr uint64_t root_position(uint64_t leaves, uint8_t row,
+    uint8_t forest_rows) NOEXCEPT
+{
+    BC_ASSERT(!is_subtract_overflow<size_t>(add1<size_t>(forest_rows), row));
+
+    const auto mask = unmask_right<uint64_t>(add1<size_t>(forest_rows));
+    const auto before = bit_and(leaves, shift_left(mask, add1<size_t>(row)));
+    const auto left = shift_left(mask, subtract(add1<size_t>(forest_rows), row));
+    const auto right = shift_right(before, row);
+    const auto shifted = bit_or(left, right);
+    return bit_and(shifted, mask);
+}
+
+constexpr bool is_root_position(uint64_t position, uint64_t leaves,
+    uint8_t forest_rows) NOEXCEPT
+{
+    const auto row = detect_row(position, forest_rows);
+    return get_right(leaves, row) &&
+        (position == root_position(leaves, row, forest_rows));
+}
+
+constexpr uint64_t remove_bit(uint64_t value, size_t bit) NOEXCEPT
+{
+    const auto hi = unmask_right<uint64_t>(bit);
+    const auto lo = mask_right<uint64_t>(add1(bit));
+    return bit_or(shift_right(bit_and(value, lo)), bit_and(value, hi));
+}
+
+constexpr bool calculate_next(uint64_t& out, uint64_t node,
+    uint64_t delete_node, uint8_t forest_rows) NOEXCEPT
+{
+    const auto node_row = detect_row(node, forest_rows);
+    const auto delete_row = detect_row(delete_node, forest_rows);
+    if (is_subtract_overflow(delete_row, node_row))
+        return false;
+
+    const auto bit = subtract(delete_row, node_row);
+    const auto lo = remove_bit(node, bit);
+
+    const auto row = add1(node_row);
+    const auto hi = shift_left(bit_right<uint64_t>(row),
+        subtract(forest_rows, row));
+
+    out = bit_or(hi, lo);
+    return true;
+}
+
+constexpr uint64_t start_position_at_row(uint8_t row,
+    uint8_t forest_rows) NOEXCEPT
+{
+    // Second subtraction cannot overflow if this one does not.
+    BC_ASSERT(!is_subtract_overflow(forest_rows, row));
+
+    return subtract(
+        bit_right<uint64_t>(add1<size_t>(forest_rows)),
+        bit_right<uint64_t>(add1<size_t>(subtract(forest_rows, row))));
+}
+
+constexpr size_t number_of_roots(uint64_t leaves) NOEXCEPT
+{
+    return std::popcount(leaves);
+}
+
+constexpr uint8_t tree_rows(uint64_t leaves) NOEXCEPT
+{
+    return narrow_cast<uint8_t>(is_zero(leaves) ? zero :
+        subtract(bits<uint64_t>, left_zeros<uint64_t>(sub1(leaves))));
+}
+
+constexpr size_t root_index(uint64_t leaves, uint8_t row) NOEXCEPT
+{
+    const auto above = add1<size_t>(row);
+    return above < bits<uint64_t> ?
+        number_of_roots(shift_right(leaves, above)) : zero;
+}
+
+constexpr bool detect_offset(offset& out, uint64_t node,
+    uint64_t leaves) NOEXCEPT
+{
+    auto rows = tree_rows(leaves);
+    if (is_zero(leaves) || rows >= bits<uint64_t>)
+        return false;
+
+    uint8_t trees{};
+    const auto row = detect_row(node, rows);
+
+    // Subtract the leaves of each larger tree until the node is within one.
+    while (true)
+    {
+        const auto mask = unmask_right<uint64_t>(add1<size_t>(rows));
+        const auto size = bit_and(bit_right<uint64_t>(rows), leaves);
+        if (bit_and(shift_left(node, row), mask) < size)
+            break;
+
+        if (!is_zero(size))
+        {
+            if (is_subtract_overflow(node, size))
+                return false;
+
+            node -= size;
+            ++trees;
+        }
+
+        // The node is not within any tree of the forest.
+        if (is_zero(rows))
+            return false;
+
+        --rows;
+    };
+
+    if (is_subtract_overflow(rows, row))
+        return false;
+
+    out = offset{ trees, subtract(rows, row), bit_not(node) };
+    return true;
+}
+
+constexpr bool parent_many(uint64_t& out, uint64_t node, uint8_t rise,
+    uint8_t forest_rows) NOEXCEPT
+{
+    if (is_zero(rise))
+    {
+        out = node;
+        return true;
+    }
+
+    if (rise > forest_rows || forest_rows >= bits<uint64_t>)
+        return false;
+
+    const auto left = subtract(forest_rows, sub1(rise));
+    const auto mask = unmask_right<uint64_t>(add1<size_t>(forest_rows));
+    out = bit_and(bit_or(shift_right(node, rise), shift_left(mask, left)), mask);
+    return true;
+}
+
+constexpr bool max_position_at_row(uint64_t& out, uint8_t row, uint8_t rows,
+    uint64_t leaves) NOEXCEPT
+{
+    uint64_t many{};
+    if (!parent_many(many, leaves, row, rows))
+        return false;
+
+    out = floored_subtract(many, one);
+    return true;
+}
+
+constexpr bool is_ancestor(uint64_t higher, uint64_t lower,
+    uint8_t forest_rows) NOEXCEPT
+{
+    if (higher == lower)
+        return false;
+
+    uint64_t ancestor{};
+    const auto lo = detect_row(lower, forest_rows);
+    const auto hi = detect_row(higher, forest_rows);
+    return !is_subtract_overflow(hi, lo) &&
+        parent_many(ancestor, lower, subtract(hi, lo), forest_rows) &&
+        (ancestor == higher);
+}
+
+} // namespace utreexo
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -36,8 +36,9 @@ constexpr int32_t missing = -1;
 // ----------------------------------------------------------------------------
 
 template<size_t Count, size_t Size>
-dictionaries<Count, Size>::dictionaries(const list& dictionaries) NOEXCEPT
-  : dictionaries_(dictionaries)
+dictionaries<Count, Size>::dictionaries(const list& dictionaries,
+    hasher hasher) NOEXCEPT
+  : dictionaries_(dictionaries), hasher_(hasher)
 {
 }
 
@@ -110,6 +111,10 @@ language dictionaries<Count, Size>::contains(const std::string& word,
             identifier : language::none;
     }
 
+    // One probe returns all dictionaries that contain the word.
+    if (!is_null(hasher_))
+        return to_identifier(hasher_().find(word).lists);
+
     // std::find_if returns first match, order is guaranteed.
     const auto it = std::find_if(dictionaries_.begin(), dictionaries_.end(),
         [&](const dictionary<Size>& dictionary) NOEXCEPT
@@ -131,6 +136,18 @@ language dictionaries<Count, Size>::contains(const string_list& words,
             identifier : language::none;
     }
 
+    // One probe per word, intersecting the dictionaries that contain each.
+    if (!is_null(hasher_))
+    {
+        const auto& hashes = hasher_();
+        auto lists = bit_all<uint16_t>;
+        for (const auto& word: words)
+            if (is_zero(lists &= hashes.find(word).lists))
+                break;
+
+        return to_identifier(lists);
+    }
+
     // std::find_if returns first match, order is guaranteed.
     const auto it = std::find_if(dictionaries_.begin(), dictionaries_.end(),
         [&](const dictionary<Size>& dictionary) NOEXCEPT
@@ -168,6 +185,20 @@ dictionaries<Count, Size>::to_dictionary(const std::string& name) const NOEXCEPT
         });
 }
 
+template<size_t Count, size_t Size>
+language dictionaries<Count, Size>::to_identifier(
+    uint16_t lists) const NOEXCEPT
+{
+    // The lowest set bit is the first dictionary, order is guaranteed.
+    const auto first = right_zeros(lists);
+    if (first >= Count)
+        return language::none;
+
+    BC_PUSH_WARNING(NO_DYNAMIC_ARRAY_INDEXING)
+    return dictionaries_[first].identifier();
+    BC_POP_WARNING()
+}
+
 } // namespace words
 } // namespace system
 } // namespace libbitcoin
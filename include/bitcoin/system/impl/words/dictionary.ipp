@@ -39,8 +39,9 @@ static_assert(std::is_standard_layout<dictionary<1>::words>(), "performance");
 // ----------------------------------------------------------------------------
 
 template<size_t Size>
-dictionary<Size>::dictionary(language identifier, const words& words) NOEXCEPT
-  : identifier_(identifier), words_(words)
+dictionary<Size>::dictionary(language identifier, const words& words,
+    hasher hasher) NOEXCEPT
+  : identifier_(identifier), words_(words), hasher_(hasher)
 {
 }
 
@@ -84,6 +85,14 @@ string_list dictionary<Size>::at(const search& indexes) const NOEXCEPT
 template <size_t Size>
 int32_t dictionary<Size>::index(const std::string& word) const NOEXCEPT
 {
+    // The position of a hashed word is its index, if the word matches.
+    if (!is_null(hasher_))
+    {
+        const auto position = hasher_().position(word);
+        return word == words_.word[position] ?
+            possible_narrow_and_sign_cast<int32_t>(position) : -1;
+    }
+
     // Dictionary sort is configured on each dictionary, verified by tests.
     // Dictionary is char* elements but using std::string (word) for compares.
     if (words_.sorted)
@@ -0,0 +1,200 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_WORDS_PERFECT_HASH_IPP
+#define LIBBITCOIN_SYSTEM_WORDS_PERFECT_HASH_IPP
+
+#include <algorithm>
+#include <string_view>
+#include <vector>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace words {
+
+BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+BC_PUSH_WARNING(NO_DYNAMIC_ARRAY_INDEXING)
+
+// Constructor.
+// ----------------------------------------------------------------------------
+
+template <size_t Capacity>
+constexpr perfect_hash<Capacity>::perfect_hash(const words& words,
+    size_t count) NOEXCEPT
+  : size_(std::min(count, Capacity)),
+    buckets_(add1(size_)),
+    seeds_{},
+    positions_{}
+{
+    // Words are hashed once, and chained into buckets (one-based links).
+    // Scratch is allocated, as combined tables may exceed a safe stack.
+    std::vector<uint64_t> hashes(size_);
+    std::vector<uint16_t> links(size_);
+    std::vector<uint16_t> heads(buckets_);
+    std::vector<uint16_t> sizes(buckets_);
+    std::vector<bool> taken(size_);
+    size_t largest{};
+
+    for (size_t word = 0; word < size_; ++word)
+    {
+        hashes[word] = hash(words[word]);
+        const auto index = bucket(hashes[word]);
+        links[word] = heads[index];
+        heads[index] = possible_narrow_cast<uint16_t>(add1(word));
+        largest = std::max(largest, size_t{ ++sizes[index] });
+    }
+
+    // Displace buckets of multiple words, largest first, by seed search.
+    for (auto size = largest; size > one; --size)
+    {
+        for (size_t index = 0; index < buckets_; ++index)
+        {
+            if (sizes[index] != size)
+                continue;
+
+            for (int32_t seed = 0; seed < max_int32; ++seed)
+            {
+                auto link = heads[index];
+                for (; !is_zero(link); link = links[sub1(link)])
+                {
+                    const auto to = slot(hashes[sub1(link)], seed);
+                    if (taken[to])
+                        break;
+
+                    taken[to] = true;
+                }
+
+                // Release slots taken by a failed seed (before the collision).
+                if (!is_zero(link))
+                {
+                    for (auto undo = heads[index]; undo != link;
+                        undo = links[sub1(undo)])
+                        taken[slot(hashes[sub1(undo)], seed)] = false;
+
+                    continue;
+                }
+
+                seeds_[index] = seed;
+                for (link = heads[index]; !is_zero(link);
+                    link = links[sub1(link)])
+                    positions_[slot(hashes[sub1(link)], seed)] =
+                        sub1(link);
+
+                break;
+            }
+        }
+    }
+
+    // Buckets of one word are assigned remaining slots directly.
+    size_t free{};
+    for (size_t index = 0; index < buckets_; ++index)
+    {
+        if (sizes[index] != one)
+            continue;
+
+        while (taken[free])
+            ++free;
+
+        taken[free] = true;
+        seeds_[index] = possible_narrow_and_sign_cast<int32_t>(
+            bit_not(free));
+        positions_[free] = sub1(heads[index]);
+    }
+}
+
+// Properties.
+// ----------------------------------------------------------------------------
+
+template <size_t Capacity>
+constexpr uint64_t perfect_hash<Capacity>::hash(
+    const std::string_view& word) NOEXCEPT
+{
+    // FNV-1a (64 bit).
+    uint64_t value = 0xcbf29ce484222325_u64;
+    for (const auto character: word)
+    {
+        value ^= static_cast<uint8_t>(character);
+        value *= 0x00000100000001b3_u64;
+    }
+
+    return value;
+}
+
+template <size_t Capacity>
+constexpr size_t perfect_hash<Capacity>::size() const NOEXCEPT
+{
+    return size_;
+}
+
+template <size_t Capacity>
+constexpr size_t perfect_hash<Capacity>::position(
+    const std::string_view& word) const NOEXCEPT
+{
+    return position(hash(word));
+}
+
+template <size_t Capacity>
+constexpr size_t perfect_hash<Capacity>::position(
+    uint64_t hash) const NOEXCEPT
+{
+    if (is_zero(size_))
+        return zero;
+
+    return positions_[slot(hash, seeds_[bucket(hash)])];
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+template <size_t Capacity>
+constexpr uint64_t perfect_hash<Capacity>::mix(uint64_t hash,
+    uint32_t seed) NOEXCEPT
+{
+    // splitmix64 finalizer over the seeded hash.
+    auto value = hash + add1<uint64_t>(seed) * 0x9e3779b97f4a7c15_u64;
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9_u64;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111eb_u64;
+    return value ^ (value >> 31);
+}
+
+template <size_t Capacity>
+constexpr size_t perfect_hash<Capacity>::bucket(uint64_t hash) const NOEXCEPT
+{
+    return hash % buckets_;
+}
+
+template <size_t Capacity>
+constexpr size_t perfect_hash<Capacity>::slot(uint64_t hash,
+    int32_t seed) const NOEXCEPT
+{
+    if (is_negative(seed))
+        return possible_narrow_and_sign_cast<size_t>(bit_not(seed));
+
+    return mix(hash, possible_sign_cast<uint32_t>(seed)) % size_;
+}
+
+BC_POP_WARNING()
+BC_POP_WARNING()
+
+} // namespace words
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,122 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_WORDS_PERFECT_HASHES_IPP
+#define LIBBITCOIN_SYSTEM_WORDS_PERFECT_HASHES_IPP
+
+#include <string_view>
+#include <vector>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/math/math.hpp>
+#include <bitcoin/system/words/perfect_hash.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace words {
+
+BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+BC_PUSH_WARNING(NO_DYNAMIC_ARRAY_INDEXING)
+
+// Constructor.
+// ----------------------------------------------------------------------------
+
+// Merge initializes size_ from the preceding members, then hash_ follows.
+template <size_t Count, size_t Size>
+constexpr perfect_hashes<Count, Size>::perfect_hashes(const lists& lists,
+    const hashes& hashes) NOEXCEPT
+  : size_(merge(lists, hashes)),
+    hash_(words_, size_)
+{
+}
+
+// Properties.
+// ----------------------------------------------------------------------------
+
+template <size_t Count, size_t Size>
+constexpr size_t perfect_hashes<Count, Size>::size() const NOEXCEPT
+{
+    return size_;
+}
+
+template <size_t Count, size_t Size>
+constexpr typename perfect_hashes<Count, Size>::location
+perfect_hashes<Count, Size>::find(const std::string_view& word) const NOEXCEPT
+{
+    const auto position = hash_.position(word);
+    if (is_zero(size_) || word != words_[position])
+        return { 0, -1 };
+
+    return { lists_[position], indexes_[position] };
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+template <size_t Count, size_t Size>
+constexpr size_t perfect_hashes<Count, Size>::merge(const lists& lists,
+    const hashes& hashes) NOEXCEPT
+{
+    // The distinct word position of each word of each list.
+    std::vector<uint16_t> distinct(capacity);
+    size_t count{};
+
+    for (size_t list = 0; list < Count; ++list)
+    {
+        const auto& words = *lists[list];
+        for (size_t index = 0; index < Size; ++index)
+        {
+            const std::string_view word{ words[index] };
+            const auto hash = perfect_hash<Size>::hash(word);
+
+            // Search preceding lists for the word, one probe for each.
+            size_t prior{};
+            size_t position{};
+            for (; prior < list; ++prior)
+            {
+                position = hashes[prior]->position(hash);
+                if (word == (*lists[prior])[position])
+                    break;
+            }
+
+            auto& at = distinct[list * Size + index];
+            if (prior == list)
+            {
+                words_[count] = words[index];
+                indexes_[count] = possible_narrow_cast<uint16_t>(index);
+                at = possible_narrow_cast<uint16_t>(count++);
+            }
+            else
+            {
+                at = distinct[prior * Size + position];
+            }
+
+            lists_[at] |= bit_right<uint16_t>(list);
+        }
+    }
+
+    return count;
+}
+
+BC_POP_WARNING()
+BC_POP_WARNING()
+
+} // namespace words
+} // namespace system
+} // namespace libbitcoin
+
+#endif
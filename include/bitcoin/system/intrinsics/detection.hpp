@@ -33,6 +33,7 @@ namespace cpu1_0
     constexpr auto leaf = 1;
     constexpr auto subleaf = 0;
     constexpr auto sse41_ecx_bit = 19;
+    constexpr auto aes_ecx_bit = 25;
     constexpr auto xsave_ecx_bit = 27;
     constexpr auto avx_ecx_bit = 28;
 }
@@ -52,6 +53,9 @@ namespace xcr0
     constexpr auto feature = 0;
     constexpr auto sse_bit = 1;
     constexpr auto avx_bit = 2;
+    constexpr auto opmask_bit = 5;
+    constexpr auto zmm_hi256_bit = 6;
+    constexpr auto hi16_zmm_bit = 7;
 }
 
 // Local util because no dependency on /math.
@@ -72,6 +76,13 @@ inline bool try_shani() NOEXCEPT
         && get_bit<cpu7_0::shani_ebx_bit>(ebx);     // SHA
 }
 
+inline bool try_aesni() NOEXCEPT
+{
+    uint32_t eax{}, ebx{}, ecx{}, edx{};
+    return get_cpu(eax, ebx, ecx, edx, cpu1_0::leaf, cpu1_0::subleaf)
+        && get_bit<cpu1_0::aes_ecx_bit>(ecx);       // AES
+}
+
 inline bool try_avx512() NOEXCEPT
 {
     uint64_t extended{};
@@ -83,6 +94,9 @@ inline bool try_avx512() NOEXCEPT
         && get_xcr(extended, xcr0::feature)
         && get_bit<xcr0::sse_bit>(extended)
         && get_bit<xcr0::avx_bit>(extended)
+        && get_bit<xcr0::opmask_bit>(extended)      // AVX512 state (os)
+        && get_bit<xcr0::zmm_hi256_bit>(extended)
+        && get_bit<xcr0::hi16_zmm_bit>(extended)
         && get_cpu(eax, ebx, ecx, edx, cpu7_0::leaf, cpu7_0::subleaf)
         && get_bit<cpu7_0::avx2_ebx_bit>(ebx)       // AVX2 (implied?)
         && get_bit<cpu7_0::avx512bw_ebx_bit>(ebx);  // AVX512BW
@@ -55,6 +55,11 @@ public:
     static code connect(const chain::context& state,
         const chain::transaction& tx, const input_iterator& it) NOEXCEPT;
 
+    /// As above, with taproot script path commitment preverified if committed.
+    static code connect(const chain::context& state,
+        const chain::transaction& tx, const input_iterator& it,
+        bool committed) NOEXCEPT;
+
 protected:
     using flags = chain::flags;
     using opcode = chain::opcode;
@@ -69,7 +74,7 @@ protected:
     /// Witnessed script handler.
     static code connect_witness(const chain::context& state,
         const chain::transaction& tx, const input_iterator& it,
-        const chain::script& prevout, bool embedded) NOEXCEPT;
+        const chain::script& prevout, bool embedded, bool committed) NOEXCEPT;
 
     /// Operation disatch.
     op_error_t run_op(const op_iterator& op) NOEXCEPT;
@@ -50,6 +50,12 @@ constexpr std::string encode_base16(const data_slice& data) NOEXCEPT;
 /// Convert a byte array to a reversed byte order hexidecimal string.
 constexpr std::string encode_hash(const data_slice& hash) NOEXCEPT;
 
+/// Write the hexidecimal encoding of data into the caller's buffer.
+/// Writes exactly data.size() * octet_width characters, without allocation.
+/// False if the buffer is too small for the encoding (buffer unchanged).
+BC_API bool encode_base16(const data_slab& out,
+    const data_slice& data) NOEXCEPT;
+
 /// Decoding of hex string to data_array or data_chunk.
 /// ---------------------------------------------------------------------------
 
@@ -57,6 +63,13 @@ constexpr std::string encode_hash(const data_slice& hash) NOEXCEPT;
 /// False if the input is malformed.
 constexpr bool decode_base16(data_chunk& out, const std::string& in) NOEXCEPT;
 
+/// Write the decoding of a hexidecimal string into the caller's buffer.
+/// Writes exactly in.size() / octet_width bytes, without allocation.
+/// False if the input is malformed or the buffer is too small for the
+/// decoding (buffer contents are then unspecified).
+BC_API bool decode_base16(const data_slab& out,
+    const std::string_view& in) NOEXCEPT;
+
 /// Convert a hexidecimal string to a byte array.
 /// False if the input is malformed, or the wrong length.
 template <size_t Size>
@@ -81,6 +81,12 @@ BC_API data_chunk base32_pack(const base32_chunk& unpacked) NOEXCEPT;
 /// Unpack any vector of 8 bit bytes to a vector of 5 bit bytes.
 BC_API base32_chunk base32_unpack(const data_chunk& packed) NOEXCEPT;
 
+/// The base32 character of a 5 bit value (upper bits are ignored).
+BC_API char base32_character(uint8_t value) NOEXCEPT;
+
+/// The 5 bit value of a base32 character of either case, 0xff if invalid.
+BC_API uint8_t base32_value(char character) NOEXCEPT;
+
 } // namespace system
 } // namespace libbitcoin
 
@@ -0,0 +1,57 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_STREAM_MAPPED_FILE_HPP
+#define LIBBITCOIN_SYSTEM_STREAM_MAPPED_FILE_HPP
+
+#include <filesystem>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+/// Read-only memory map of an entire file, for zero-copy reading (e.g. with
+/// stream::in::copy or a chain::block_file over data()). The mapping is
+/// released on destruction, invalidating any slice of it.
+class BC_API mapped_file final
+{
+public:
+    DELETE_COPY_MOVE(mapped_file);
+
+    /// Map the file (check is_open).
+    mapped_file(const std::filesystem::path& path) NOEXCEPT;
+    ~mapped_file() NOEXCEPT;
+
+    /// True if the file was opened and mapped (an empty file is not mapped).
+    bool is_open() const NOEXCEPT;
+
+    /// The mapped bytes (empty if not open or the file is empty).
+    data_slice data() const NOEXCEPT;
+    size_t size() const NOEXCEPT;
+
+private:
+    const uint8_t* data_{};
+    size_t size_{};
+    bool open_{};
+};
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
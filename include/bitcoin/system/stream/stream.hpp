@@ -27,6 +27,7 @@
 #include <bitcoin/system/stream/devices/push_sink.hpp>
 #include <bitcoin/system/stream/make_stream.hpp>
 #include <bitcoin/system/stream/make_streamer.hpp>
+#include <bitcoin/system/stream/mapped_file.hpp>
 #include <bitcoin/system/stream/iostream/iostream.hpp>
 #include <bitcoin/system/stream/iostream/istream.hpp>
 #include <bitcoin/system/stream/iostream/ostream.hpp>
@@ -0,0 +1,129 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_UTREEXO_FOREST_HPP
+#define LIBBITCOIN_SYSTEM_UTREEXO_FOREST_HPP
+
+#include <tuple>
+#include <vector>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+#include <bitcoin/system/radix/radix.hpp>
+
+// Forest position math, based on rustreexo (github.com/mit-dci/rustreexo).
+// Positions number the nodes of a complete forest of forest_rows rows, leaves
+// first (row zero), then each row above in order, so a parent is always at a
+// greater position than its children and rows are contiguous.
+
+namespace libbitcoin {
+namespace system {
+namespace utreexo {
+
+using positions = std::vector<uint64_t>;
+using offset = std::tuple<uint8_t, uint8_t, uint64_t>;
+using node_hash = hash_digest;
+constexpr auto empty_hash = node_hash{};
+constexpr auto dummy_hash = base16_hash(
+    "4242424242424242424242424242424242424242424242424242424242424242");
+
+/// Hashing.
+/// ---------------------------------------------------------------------------
+
+/// sha512_256(left || right).
+constexpr node_hash parent_hash(const node_hash& left,
+    const node_hash& right) NOEXCEPT;
+
+/// Position math.
+/// ---------------------------------------------------------------------------
+
+constexpr uint64_t parent(uint64_t child, uint8_t forest_rows) NOEXCEPT;
+constexpr uint64_t children(uint64_t parent, uint8_t forest_rows) NOEXCEPT;
+constexpr uint64_t left_child(uint64_t parent, uint8_t forest_rows) NOEXCEPT;
+constexpr uint64_t right_child(uint64_t parent, uint8_t forest_rows) NOEXCEPT;
+constexpr uint64_t left_sibling(uint64_t node) NOEXCEPT;
+constexpr bool is_left_niece(uint64_t node) NOEXCEPT;
+constexpr bool is_right_sibling(uint64_t node, uint64_t next) NOEXCEPT;
+constexpr bool is_sibling(uint64_t node1, uint64_t node2) NOEXCEPT;
+
+/// Parameters reversed from rustreexo.
+constexpr bool is_root_populated(uint64_t leaves, uint8_t row) NOEXCEPT;
+constexpr uint8_t detect_row(uint64_t node, uint8_t forest_rows) NOEXCEPT;
+
+/// Arbitrary if the row does not have a root.
+constexpr uint64_t root_position(uint64_t leaves, uint8_t row,
+    uint8_t forest_rows) NOEXCEPT;
+constexpr bool is_root_position(uint64_t position, uint64_t leaves,
+    uint8_t forest_rows) NOEXCEPT;
+
+constexpr uint64_t remove_bit(uint64_t value, size_t bit) NOEXCEPT;
+constexpr bool calculate_next(uint64_t& out, uint64_t node,
+    uint64_t delete_node, uint8_t forest_rows) NOEXCEPT;
+constexpr uint64_t start_position_at_row(uint8_t row,
+    uint8_t forest_rows) NOEXCEPT;
+constexpr size_t number_of_roots(uint64_t leaves) NOEXCEPT;
+constexpr uint8_t tree_rows(uint64_t leaves) NOEXCEPT;
+
+/// The index of the root of the row within the roots of leaves, which are
+/// ordered by descending row (arbitrary if the row does not have a root).
+constexpr size_t root_index(uint64_t leaves, uint8_t row) NOEXCEPT;
+
+/// The number of trees to the left of the tree of the node, the number of
+/// rows from the node to the root of its tree, and the path from the root to
+/// the node (bit_not of the node offset within its tree). False if there are
+/// no leaves, the forest exceeds 63 rows or the node is not within a tree.
+constexpr bool detect_offset(offset& out, uint64_t node,
+    uint64_t leaves) NOEXCEPT;
+
+/// The ancestor of the node rise rows above it (the node if rise is zero).
+/// False if rise exceeds forest_rows or the forest exceeds 63 rows.
+constexpr bool parent_many(uint64_t& out, uint64_t node, uint8_t rise,
+    uint8_t forest_rows) NOEXCEPT;
+
+/// The greatest position at the row of a forest of rows with leaves (less
+/// than the start of the row if the row is empty). False as parent_many.
+constexpr bool max_position_at_row(uint64_t& out, uint8_t row, uint8_t rows,
+    uint64_t leaves) NOEXCEPT;
+
+/// True if higher is an ancestor of (not the same as) lower.
+constexpr bool is_ancestor(uint64_t higher, uint64_t lower,
+    uint8_t forest_rows) NOEXCEPT;
+
+/// Position sets.
+/// ---------------------------------------------------------------------------
+
+/// Replace each pair of sorted siblings with their parent.
+BC_API positions detwin(const positions& nodes, uint8_t forest_rows) NOEXCEPT;
+
+/// The positions of the empty roots destroyed by adding leaves, in order of
+/// destruction. Roots are ordered by descending row, one for each populated
+/// row of leaves. False if roots does not match leaves, or if the added
+/// leaves overflow the leaf count or a forest of 63 rows.
+BC_API bool roots_to_destroy(positions& out, hashes&& roots, uint64_t adding,
+    uint64_t leaves) NOEXCEPT;
+
+/// The sorted positions of the nodes required to prove the targets.
+BC_API positions get_proof_positions(positions&& targets, uint64_t leaves,
+    uint8_t forest_rows) NOEXCEPT;
+
+} // namespace utreexo
+} // namespace system
+} // namespace libbitcoin
+
+#include <bitcoin/system/impl/utreexo/forest.ipp>
+
+#endif
@@ -0,0 +1,115 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_UTREEXO_POLLARD_HPP
+#define LIBBITCOIN_SYSTEM_UTREEXO_POLLARD_HPP
+
+#include <deque>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+#include <bitcoin/system/utreexo/forest.hpp>
+#include <bitcoin/system/utreexo/proof.hpp>
+#include <bitcoin/system/utreexo/stump.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace utreexo {
+
+/// Partially cached utreexo forest (not thread safe).
+/// The most recently added leaves are remembered, up to capacity, along with
+/// the nodes required to prove them. All other subtrees are pruned to their
+/// hashes, so with zero capacity only the roots are retained (as stump).
+/// Proven deletions are ingested (cached) for the block and then pruned.
+class BC_API pollard
+{
+public:
+    DELETE_COPY_MOVE(pollard);
+
+    /// Empty accumulator, remembering up to capacity leaves.
+    pollard(size_t capacity) NOEXCEPT;
+
+    /// Accumulator of the stump, remembering up to capacity added leaves.
+    pollard(const stump& state, size_t capacity) NOEXCEPT;
+
+    /// Properties.
+    /// -----------------------------------------------------------------------
+
+    /// The number of leaves ever added (deletion does not reduce it).
+    uint64_t leaves() const NOEXCEPT;
+
+    /// The roots, ordered by descending row (deleted roots are empty_hash).
+    hashes roots() const NOEXCEPT;
+
+    /// The number of leaves currently remembered (cached).
+    size_t remembered() const NOEXCEPT;
+
+    /// Methods.
+    /// -----------------------------------------------------------------------
+
+    /// True if the proof proves the targets (in proof.targets order).
+    bool verify(const proof& proof, const hashes& targets) const NOEXCEPT;
+
+    /// Delete the proven targets and then add the leaves (as for a block).
+    /// False if the proof does not prove the targets (roots are unchanged).
+    bool modify(const hashes& adds, const hashes& deletes,
+        const proof& proof) NOEXCEPT;
+
+    /// Prove remembered targets, false if any target is not remembered.
+    bool prove(proof& out, const hashes& targets) const NOEXCEPT;
+
+private:
+    struct node;
+    typedef std::unique_ptr<node> node_ptr;
+    struct node
+    {
+        node_hash hash{};
+        node* parent{};
+        node_ptr left{};
+        node_ptr right{};
+        bool remember{};
+        bool dirty{};
+    };
+
+    bool is_proven(const updates& nodes) const NOEXCEPT;
+    static bool is_prunable(const node& node) NOEXCEPT;
+    static void update(node& node, bool rehash) NOEXCEPT;
+
+    node_ptr& slot(const node& root) NOEXCEPT;
+    node* find(uint64_t position) const NOEXCEPT;
+    node* ingest(uint64_t position, const updates& nodes) NOEXCEPT;
+    uint64_t position(const node& leaf) const NOEXCEPT;
+    void remove(node& leaf) NOEXCEPT;
+    void add(const node_hash& leaf) NOEXCEPT;
+    void evict() NOEXCEPT;
+    void update(bool rehash) NOEXCEPT;
+
+    const size_t capacity_;
+    uint64_t leaves_;
+    std::vector<node_ptr> roots_;
+    std::deque<node_hash> added_;
+    std::unordered_map<node_hash, node*, unique_hash_t<>> remembered_;
+};
+
+} // namespace utreexo
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,64 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_UTREEXO_PROOF_HPP
+#define LIBBITCOIN_SYSTEM_UTREEXO_PROOF_HPP
+
+#include <vector>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+#include <bitcoin/system/utreexo/forest.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace utreexo {
+
+/// Batch inclusion proof of a set of leaves (targets).
+struct proof
+{
+    /// The positions of the targets.
+    positions targets{};
+
+    /// The hashes at get_proof_positions(targets), in position order.
+    hashes nodes{};
+};
+
+/// A computed node, with its hash before and after deletion of the targets.
+struct update
+{
+    uint64_t position;
+    node_hash prior;
+    node_hash hash;
+};
+
+typedef std::vector<update> updates;
+
+/// Compute the nodes from the targets (leaf hashes in proof.targets order) and
+/// proof nodes up to their roots, in position order. Deleted nodes are empty,
+/// and the sibling of a deleted node replaces their parent, as in utreexo
+/// deletion. The parents of each row are hashed as a batch, concurrently for
+/// large rows. Roots must be compared to the accumulator (see root_index).
+/// False if the proof is not well formed for the targets and leaves.
+BC_API bool compute(updates& out, const proof& proof, const hashes& targets,
+    uint64_t leaves, bool remove) NOEXCEPT;
+
+} // namespace utreexo
+} // namespace system
+} // namespace libbitcoin
+
+#endif
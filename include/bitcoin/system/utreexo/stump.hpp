@@ -0,0 +1,75 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_UTREEXO_STUMP_HPP
+#define LIBBITCOIN_SYSTEM_UTREEXO_STUMP_HPP
+
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+#include <bitcoin/system/utreexo/forest.hpp>
+#include <bitcoin/system/utreexo/proof.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace utreexo {
+
+/// Utreexo accumulator state, the roots of the forest and its leaf count.
+/// This is sufficient to validate proven spends, with no utxo set retained.
+class BC_API stump
+{
+public:
+    /// Empty accumulator.
+    stump() NOEXCEPT;
+
+    /// Roots must be ordered by descending row, one for each bit of leaves.
+    stump(uint64_t leaves, hashes&& roots) NOEXCEPT;
+
+    /// Properties.
+    /// -----------------------------------------------------------------------
+
+    /// The number of leaves ever added (deletion does not reduce it).
+    uint64_t leaves() const NOEXCEPT;
+
+    /// The roots, ordered by descending row (deleted roots are empty_hash).
+    const hashes& roots() const NOEXCEPT;
+
+    /// Methods.
+    /// -----------------------------------------------------------------------
+
+    /// True if the proof proves the targets (in proof.targets order).
+    bool verify(const proof& proof, const hashes& targets) const NOEXCEPT;
+
+    /// Delete the proven targets and then add the leaves (as for a block).
+    /// False (and unchanged) if the proof does not prove the targets.
+    bool modify(const hashes& adds, const hashes& deletes,
+        const proof& proof) NOEXCEPT;
+
+protected:
+    bool is_proven(const updates& nodes) const NOEXCEPT;
+    void add(const node_hash& leaf) NOEXCEPT;
+
+private:
+    uint64_t leaves_;
+    hashes roots_;
+};
+
+} // namespace utreexo
+} // namespace system
+} // namespace libbitcoin
+
+#endif
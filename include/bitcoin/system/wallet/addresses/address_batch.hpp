@@ -0,0 +1,75 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_WALLET_ADDRESSES_ADDRESS_BATCH_HPP
+#define LIBBITCOIN_SYSTEM_WALLET_ADDRESSES_ADDRESS_BATCH_HPP
+
+#include <string>
+#include <bitcoin/system/chain/chain.hpp>
+#include <bitcoin/system/crypto/crypto.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/unicode/unicode.hpp>
+#include <bitcoin/system/wallet/addresses/payment_address.hpp>
+#include <bitcoin/system/wallet/addresses/witness_address.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace wallet {
+
+/// Address types derived from a compressed public key.
+enum class address_type
+{
+    /// Pay to public key hash, base58check.
+    p2pkh,
+
+    /// Pay to witness public key hash nested in pay to script hash [bip141].
+    p2sh_p2wpkh,
+
+    /// Pay to witness public key hash, bech32 [bip173].
+    p2wpkh,
+
+    /// Pay to taproot key path (no script tree), bech32m [bip86/bip350].
+    p2tr
+};
+
+/// Prefixes of the encoded addresses (mainnet by default).
+struct address_prefixes
+{
+    uint8_t p2kh{ payment_address::mainnet_p2kh };
+    uint8_t p2sh{ payment_address::mainnet_p2sh };
+    std::string witness{ witness_address::mainnet };
+};
+
+/// Encode the address of each key, concurrently and in order, out[n] is the
+/// address of keys[n]. Keys are not validated, except for p2tr (which
+/// requires a point), and an empty string is returned for an invalid key.
+BC_API string_list encode_addresses(const compressed_list& keys,
+    address_type type, const address_prefixes& prefixes={}) NOEXCEPT;
+
+/// Encode the address of each output script, concurrently and in order,
+/// out[n] is the address of scripts[n]. Pay to key hash, pay to script hash
+/// and witness program scripts are encoded, and an empty string is returned
+/// for any other script.
+BC_API string_list encode_addresses(const chain::scripts& scripts,
+    const address_prefixes& prefixes={}) NOEXCEPT;
+
+} // namespace wallet
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -52,6 +52,15 @@ struct BC_API hd_lineage
     bool operator!=(const hd_lineage& other) const NOEXCEPT;
 };
 
+/// A normal child public key and its bitcoin short hash (hash160).
+struct BC_API hd_child
+{
+    ec_compressed point;
+    short_hash hash;
+};
+
+typedef std_vector<hd_child> hd_children;
+
 class hd_private;
 
 /// An extended public key, as defined by BIP32.
@@ -99,6 +108,12 @@ public:
     hd_key to_hd_key() const NOEXCEPT;
     hd_public derive_public(uint32_t index) const NOEXCEPT;
 
+    /// Derive the normal children [first, first + count) for gap scanning.
+    /// The hmac key schedule and parent point parse are shared by all
+    /// indexes. False if any index is hardened or any child is invalid.
+    bool derive_children(hd_children& out, uint32_t first,
+        size_t count) const NOEXCEPT;
+
 protected:
     /// Factories.
     static hd_public from_secret(const ec_secret& secret,
@@ -0,0 +1,118 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_WALLET_SCANNER_HPP
+#define LIBBITCOIN_SYSTEM_WALLET_SCANNER_HPP
+
+#include <unordered_set>
+#include <bitcoin/system/chain/chain.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+#include <bitcoin/system/wallet/addresses/payment_address.hpp>
+#include <bitcoin/system/wallet/addresses/witness_address.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace wallet {
+
+/// Wallet rescan engine, matches block outputs against a watch set and
+/// reports spends of matched outputs (by input point).
+/// Scripts are watched by script hash (sha256 of the unprefixed script).
+/// The watch set is a sorted array of script hashes behind a bloom screen,
+/// so that a non-matching output is generally rejected by the screen alone.
+/// Watching is not thread safe, scanning is internally concurrent.
+class BC_API scanner
+{
+public:
+    DEFAULT_COPY_MOVE_DESTRUCT(scanner);
+
+    /// A watched output (payment) or a spend of a watched output.
+    struct match
+    {
+        /// Position of the transaction within its block.
+        size_t position;
+
+        /// Index of the output (payment) or of the input (spend).
+        uint32_t index;
+
+        /// True if the match is a spend of a watched output.
+        bool spend;
+    };
+
+    typedef std_vector<match> matches;
+
+    /// Bits of bloom screen per watched script.
+    static constexpr size_t screen_bits = 16;
+
+    /// Constructors.
+    scanner() NOEXCEPT;
+
+    /// Add to the watch set, false if address or script is invalid.
+    bool watch(const hash_digest& script_hash) NOEXCEPT;
+    bool watch(const chain::script& script) NOEXCEPT;
+    bool watch(const payment_address& address) NOEXCEPT;
+    bool watch(const witness_address& address) NOEXCEPT;
+
+    /// Add an output point, spends of which are reported.
+    void watch(const chain::point& point) NOEXCEPT;
+
+    /// Number of watched script hashes (distinct once scanned).
+    size_t scripts() const NOEXCEPT;
+
+    /// Number of watched output points.
+    size_t points() const NOEXCEPT;
+
+    /// Report payments to and spends from the watch set, in block order
+    /// (by transaction, with payments preceding spends in a transaction).
+    /// Matched outputs are added to the watched points.
+    void scan(matches& out, const chain::block& block) NOEXCEPT;
+
+    /// Scan blocks (assumed in chain order) concurrently, out[n] is the
+    /// set of matches for blocks[n].
+    void scan(std_vector<matches>& out, const chain::blocks& blocks) NOEXCEPT;
+
+protected:
+    /// Sort and deduplicate the watch set and populate the screen.
+    void index() NOEXCEPT;
+
+    /// Screen and search the watch set (requires index).
+    bool is_screened(const hash_digest& script_hash) const NOEXCEPT;
+    bool is_watched(const hash_digest& script_hash) const NOEXCEPT;
+
+    /// Matching outputs and spends of watched points in block (requires index).
+    matches payments(const chain::block& block) const NOEXCEPT;
+    matches spends(const chain::block& block) const NOEXCEPT;
+
+    /// Add output points of payments in block to the watched points.
+    void retain(const matches& payments, const chain::block& block) NOEXCEPT;
+
+    /// Merge spends into payments, in block order (both in block order).
+    static void merge(matches& out, const matches& spends) NOEXCEPT;
+
+private:
+    hashes hashes_;
+    std_vector<uint64_t> screen_;
+    std::unordered_set<chain::point> points_;
+    bool indexed_;
+};
+
+} // namespace wallet
+} // namespace system
+} // namespace libbitcoin
+
+#endif
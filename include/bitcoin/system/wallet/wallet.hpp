@@ -19,6 +19,7 @@
 #ifndef LIBBITCOIN_SYSTEM_WALLET_WALLET_HPP
 #define LIBBITCOIN_SYSTEM_WALLET_WALLET_HPP
 
+#include <bitcoin/system/wallet/addresses/address_batch.hpp>
 #include <bitcoin/system/wallet/addresses/bitcoin_uri.hpp>
 #include <bitcoin/system/wallet/addresses/checked.hpp>
 #include <bitcoin/system/wallet/addresses/payment_address.hpp>
@@ -50,5 +51,6 @@
 #include <bitcoin/system/wallet/neutrino.hpp>
 #include <bitcoin/system/wallet/point_value.hpp>
 #include <bitcoin/system/wallet/points_value.hpp>
+#include <bitcoin/system/wallet/scanner.hpp>
 
 #endif
@@ -43,8 +43,24 @@ extern const catalog::words& ko;
 extern const catalog::words& zh_Hans;
 extern const catalog::words& zh_Hant;
 
+// Hashes of the word lists, created on first use.
+
+BC_API const catalog::hash& en_hash() NOEXCEPT;
+BC_API const catalog::hash& es_hash() NOEXCEPT;
+BC_API const catalog::hash& it_hash() NOEXCEPT;
+BC_API const catalog::hash& fr_hash() NOEXCEPT;
+BC_API const catalog::hash& cs_hash() NOEXCEPT;
+BC_API const catalog::hash& pt_hash() NOEXCEPT;
+BC_API const catalog::hash& ja_hash() NOEXCEPT;
+BC_API const catalog::hash& ko_hash() NOEXCEPT;
+BC_API const catalog::hash& zh_Hans_hash() NOEXCEPT;
+BC_API const catalog::hash& zh_Hant_hash() NOEXCEPT;
+
 typedef words::dictionaries<10, catalog::size()> catalogs;
 
+// Combined hash of the word lists (in the order above), created on first use.
+BC_API const catalogs::hashes& hashes() NOEXCEPT;
+
 } // namespace electrum
 } // namespace words
 } // namespace system
@@ -33,8 +33,16 @@ typedef words::dictionary<1626> catalog;
 extern const catalog::words en;
 extern const catalog::words pt;
 
+// Hashes of the word lists, created on first use.
+
+BC_API const catalog::hash& en_hash() NOEXCEPT;
+BC_API const catalog::hash& pt_hash() NOEXCEPT;
+
 typedef words::dictionaries<2, catalog::size()> catalogs;
 
+// Combined hash of the word lists (in the order above), created on first use.
+BC_API const catalogs::hashes& hashes() NOEXCEPT;
+
 } // namespace electrum_v1
 } // namespace words
 } // namespace system
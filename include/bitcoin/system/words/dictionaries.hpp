@@ -24,6 +24,7 @@
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/words/dictionary.hpp>
 #include <bitcoin/system/words/language.hpp>
+#include <bitcoin/system/words/perfect_hashes.hpp>
 
 namespace libbitcoin {
 namespace system {
@@ -31,6 +32,7 @@ namespace words {
 
 // Search container for a set of dictionaries with POD word lists.
 // POD dictionaries wrapper with per dictionary O(n) search and O(1) index.
+// Search of all dictionaries is O(1) given the combined hash of word lists.
 // Search order is guaranteed, always returns first match.
 template<size_t Count, size_t Size>
 class dictionaries final
@@ -40,6 +42,8 @@ public:
     typedef typename dictionary<Size>::search search;
     typedef typename dictionary<Size>::result result;
     typedef std_array<dictionary<Size>, Count> list;
+    typedef perfect_hashes<Count, Size> hashes;
+    typedef const hashes& (*hasher)() NOEXCEPT;
 
     /// The number of dictionaries.
     static constexpr size_t count() NOEXCEPT { return Count; };
@@ -48,7 +52,9 @@ public:
     static constexpr size_t size() NOEXCEPT { return Size; };
 
     /// Constructor.
-    dictionaries(const list& dictionaries) NOEXCEPT;
+    /// The optional hasher must return the combined hash of the same word
+    /// lists, in the same order as the dictionaries.
+    dictionaries(const list& dictionaries, hasher hasher=nullptr) NOEXCEPT;
 
     /// True if the specified dictionary exists.
     bool exists(language identifier) const NOEXCEPT;
@@ -103,6 +109,9 @@ private:
     typename list::const_iterator to_dictionary(
         const std::string& name) const NOEXCEPT;
 
+    // The first dictionary of the set (by position), or language::none.
+    language to_identifier(uint16_t lists) const NOEXCEPT;
+
     // This dictionary collection creates only one word of state for each
     // dictionary reference, each which creates only one word of state for the
     // dictionary language identifier. Word lists are not loaded into a vector.
@@ -111,6 +120,9 @@ private:
     // the dictionary elements, which retain the reference. This dictionaries
     // search wrapper is held by the owner of the word list references.
     const list dictionaries_;
+
+    // The combined hash is static, created on first use by its hasher.
+    const hasher hasher_;
 };
 
 } // namespace words
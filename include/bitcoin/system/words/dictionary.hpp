@@ -23,6 +23,7 @@
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/math/math.hpp>
 #include <bitcoin/system/words/language.hpp>
+#include <bitcoin/system/words/perfect_hash.hpp>
 
 namespace libbitcoin {
 namespace system {
@@ -30,6 +31,7 @@ namespace words {
 
 // Search container for a dictionary of lexically-sorted words.
 // POD dictionary wrapper with O(n) search and O(1) index.
+// Search is O(1) given the word list hash (catalogs provide these).
 // Search order is guaranteed, always returns first match.
 template<size_t Size>
 class dictionary final
@@ -38,13 +40,17 @@ public:
     typedef std::vector<size_t> search;
     typedef std::vector<int32_t> result;
     typedef struct { bool sorted; std_array<const char*, Size> word; } words;
+    typedef perfect_hash<Size> hash;
+    typedef const hash& (*hasher)() NOEXCEPT;
     static_assert(Size <= possible_narrow_sign_cast<size_t>(max_int32));
 
     /// The number of words in the dictionary.
     static constexpr size_t size() NOEXCEPT { return Size; };
 
     /// Constructor.
-    dictionary(language identifier, const words& words) NOEXCEPT;
+    /// The optional hasher must return the hash of the same word list.
+    dictionary(language identifier, const words& words,
+        hasher hasher=nullptr) NOEXCEPT;
 
     /// The language identifier of the dictionary.
     language identifier() const NOEXCEPT;
@@ -81,6 +87,9 @@ private:
     // this wrapper dictionary object is created for each word list, for
     // each dictionaries object constructed by various mnemonic classes.
     const words& words_;
+
+    // The word list hash is also static, created on first use by its hasher.
+    const hasher hasher_;
 };
 
 } // namespace words
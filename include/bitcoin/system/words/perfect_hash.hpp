@@ -0,0 +1,79 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_WORDS_PERFECT_HASH_HPP
+#define LIBBITCOIN_SYSTEM_WORDS_PERFECT_HASH_HPP
+
+#include <string_view>
+#include <vector>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace words {
+
+// Minimal perfect hash over a set of up to Capacity unique words.
+// Built by hash and displace, each word of the set maps to a distinct
+// position, so a search is one hash and one string comparison. Construction
+// is constexpr, though catalogs create their tables on first use (see
+// catalogs). The set is not retained, so a position must be verified
+// against its word.
+template <size_t Capacity>
+class perfect_hash final
+{
+public:
+    typedef std_array<const char*, Capacity> words;
+    static_assert(!is_zero(Capacity) && Capacity <= max_uint16);
+
+    /// The hash of a word, for multiple searches of the same word.
+    static constexpr uint64_t hash(const std::string_view& word) NOEXCEPT;
+
+    /// Constructor (count words must be unique, count <= Capacity).
+    constexpr perfect_hash(const words& words,
+        size_t count=Capacity) NOEXCEPT;
+
+    /// The number of words in the set.
+    constexpr size_t size() const NOEXCEPT;
+
+    /// The position of the word, if it is in the set (otherwise arbitrary).
+    /// Zero if the set is empty, otherwise less than size().
+    constexpr size_t position(const std::string_view& word) const NOEXCEPT;
+    constexpr size_t position(uint64_t hash) const NOEXCEPT;
+
+private:
+    static constexpr size_t buckets = add1(Capacity);
+    static constexpr uint64_t mix(uint64_t hash, uint32_t seed) NOEXCEPT;
+
+    constexpr size_t bucket(uint64_t hash) const NOEXCEPT;
+    constexpr size_t slot(uint64_t hash, int32_t seed) const NOEXCEPT;
+
+    // Negative seeds are direct slots, for buckets of one word.
+    size_t size_;
+    size_t buckets_;
+    std_array<int32_t, buckets> seeds_;
+    std_array<uint16_t, Capacity> positions_;
+};
+
+} // namespace words
+} // namespace system
+} // namespace libbitcoin
+
+#include <bitcoin/system/impl/words/perfect_hash.ipp>
+
+#endif
@@ -0,0 +1,76 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_WORDS_PERFECT_HASHES_HPP
+#define LIBBITCOIN_SYSTEM_WORDS_PERFECT_HASHES_HPP
+
+#include <string_view>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/words/perfect_hash.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace words {
+
+// Minimal perfect hash over the union of Count word lists of Size words.
+// Each distinct word maps to the set of lists that contain it and its index
+// in the first of them, so a word is located across all lists in one probe.
+// Lists are identified by position, which is the order of construction.
+template <size_t Count, size_t Size>
+class perfect_hashes final
+{
+public:
+    typedef std_array<const char*, Size> words;
+    typedef std_array<const words*, Count> lists;
+    typedef std_array<const perfect_hash<Size>*, Count> hashes;
+    typedef struct { uint16_t lists; int32_t index; } location;
+    static_assert(!is_zero(Count) && Count <= bits<uint16_t>);
+
+    /// Constructor (the hash of each list is used to merge the lists).
+    constexpr perfect_hashes(const lists& lists,
+        const hashes& hashes) NOEXCEPT;
+
+    /// The number of distinct words.
+    constexpr size_t size() const NOEXCEPT;
+
+    /// The lists that contain the word (bit set by list position) and the
+    /// index of the word in the first of them. Lists zero and index -1 if not
+    /// contained by any list.
+    constexpr location find(const std::string_view& word) const NOEXCEPT;
+
+private:
+    static constexpr size_t capacity = Count * Size;
+
+    constexpr size_t merge(const lists& lists,
+        const hashes& hashes) NOEXCEPT;
+
+    // Distinct words are merged before (and for) construction of the hash.
+    std_array<const char*, capacity> words_{};
+    std_array<uint16_t, capacity> lists_{};
+    std_array<uint16_t, capacity> indexes_{};
+    size_t size_;
+    perfect_hash<capacity> hash_;
+};
+
+} // namespace words
+} // namespace system
+} // namespace libbitcoin
+
+#include <bitcoin/system/impl/words/perfect_hashes.ipp>
+
+#endif
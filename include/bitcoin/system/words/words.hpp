@@ -26,5 +26,7 @@
 #include <bitcoin/system/words/dictionary.hpp>
 #include <bitcoin/system/words/language.hpp>
 #include <bitcoin/system/words/languages.hpp>
+#include <bitcoin/system/words/perfect_hash.hpp>
+#include <bitcoin/system/words/perfect_hashes.hpp>
 
 #endif
@@ -40,6 +40,7 @@
 #include <bitcoin/system/chain/enums/flags.hpp>
 #include <bitcoin/system/chain/enums/magic_numbers.hpp>
 #include <bitcoin/system/chain/enums/opcode.hpp>
+#include <bitcoin/system/chain/enums/script_version.hpp>
 #include <bitcoin/system/chain/point.hpp>
 #include <bitcoin/system/chain/script.hpp>
 #include <bitcoin/system/data/data.hpp>
@@ -157,6 +158,87 @@ void block::assign_data(reader& source, bool witness) NOEXCEPT
     valid_ = source;
 }
 
+// static
+code block::deserialize(cptr& out, std::istream& stream, bool witness,
+    const handler& handler) NOEXCEPT
+{
+    read::bytes::istream source{ stream };
+    return deserialize(out, source, witness, handler);
+}
+
+// static
+code block::deserialize(cptr& out, reader& source, bool witness,
+    const handler& handler) NOEXCEPT
+{
+    out.reset();
+    auto& allocator = source.get_allocator();
+    const chain::header::cptr header{ CREATE(chain::header, allocator,
+        source) };
+    const auto count = source.read_size(max_block_size);
+    if (!source)
+        return error::malformed_block;
+
+    if (is_zero(count))
+        return error::empty_block;
+
+    auto nominal = ceilinged_add(chain::header::serialized_size(),
+        variable_size(count));
+
+    const transactions_cptr txs{ CREATE(transaction_cptrs, allocator) };
+    const auto list = to_non_const_raw_ptr(txs);
+    list->reserve(count);
+
+    // A non-coinbase first transaction of 64 bytes may be malleated64.
+    auto malleable = false;
+    for (size_t index = 0; index < count; ++index)
+    {
+        const transaction::cptr tx{ CREATE(transaction, allocator, source,
+            witness) };
+
+        if (!source || !tx->is_valid())
+            return error::malformed_block;
+
+        // Cache the merkle leaf (overlaps hashing with reading).
+        tx->get_hash(false);
+        list->push_back(tx);
+
+        nominal = ceilinged_add(nominal, tx->serialized_size(false));
+        if (nominal > max_block_size)
+            return error::block_size_limit;
+
+        if (is_zero(index))
+        {
+            malleable = !tx->is_coinbase();
+            if (malleable && tx->serialized_size(false) != two * hash_size)
+                return error::first_not_coinbase;
+        }
+        else
+        {
+            if (!malleable && tx->is_coinbase())
+                return error::extra_coinbases;
+        }
+
+        if (!malleable)
+            if (const auto ec = tx->check())
+                return ec;
+
+        if (handler)
+            if (const auto ec = handler(tx))
+                return ec;
+    }
+
+    const auto instance = to_shared(block{ header, txs, true });
+
+    // Size, coinbase placement and transactions were checked above, but a
+    // malleable first transaction defers all checks to the whole block.
+    if (const auto ec = malleable ? instance->check() :
+        instance->check_streamed())
+        return ec;
+
+    out = instance;
+    return error::block_success;
+}
+
 void block::set_allocation(size_t allocation) const NOEXCEPT
 {
     allocation_ = allocation;
@@ -179,6 +261,14 @@ data_chunk block::to_data(bool witness) const NOEXCEPT
     return data;
 }
 
+void block::to_data(data_chunk& data, bool witness) const NOEXCEPT
+{
+    data.resize(serialized_size(witness));
+    stream::out::fast ostream(data);
+    write::bytes::fast out(ostream);
+    to_data(out, witness);
+}
+
 void block::to_data(std::ostream& stream, bool witness) const NOEXCEPT
 {
     write::bytes::ostream out(stream);
@@ -844,14 +934,57 @@ code block::accept_transactions(const context& ctx) const NOEXCEPT
 // Do NOT invoke on coinbase.
 code block::connect_transactions(const context& ctx) const NOEXCEPT
 {
-    if (!is_empty())
-        for (auto tx = std::next(txs_->begin()); tx != txs_->end(); ++tx)
-            if (const auto ec = (*tx)->connect(ctx))
-                return ec;
+    if (is_empty())
+        return error::block_success;
+
+    // Verified commitments of all inputs, in order (empty if not bip341).
+    const auto committed = verify_commitments(ctx);
+    auto bit = committed.begin();
+
+    std_vector<bool> verified{};
+    for (auto tx = std::next(txs_->begin()); tx != txs_->end(); ++tx)
+    {
+        if (!committed.empty())
+        {
+            const auto end = std::next(bit, (*tx)->inputs());
+            verified.assign(bit, end);
+            bit = end;
+        }
+
+        if (const auto ec = (*tx)->connect(ctx, verified))
+            return ec;
+    }
 
     return error::block_success;
 }
 
+// Do NOT invoke on coinbase.
+// Taproot script path commitments (the costly ec tweak check of each) are
+// independent of script evaluation, so are verified for the block at once.
+std_vector<bool> block::verify_commitments(const context& ctx) const NOEXCEPT
+{
+    if (!script::is_enabled(ctx.flags, flags::bip341_rule))
+        return {};
+
+    std_vector<const input*> ins{};
+    for (auto tx = std::next(txs_->begin()); tx != txs_->end(); ++tx)
+        for (const auto& in: *(*tx)->inputs_ptr())
+            ins.push_back(in.get());
+
+    // Bytes, as concurrent writes to the bits of a std_vector<bool> race.
+    // Only unwrapped taproot outputs are encumbered [bip341].
+    std_vector<uint8_t> verified(ins.size());
+    std::transform(poolstl::execution::par, ins.begin(), ins.end(),
+        verified.begin(), [](const input* in) NOEXCEPT -> uint8_t
+        {
+            return in->prevout && in->script().ops().empty() &&
+                in->prevout->script().version() == script_version::taproot &&
+                in->witness().is_committed(in->prevout->script());
+        });
+
+    return std_vector<bool>(verified.begin(), verified.end());
+}
+
 // Do NOT invoke on coinbase.
 code block::confirm_transactions(const context& ctx) const NOEXCEPT
 {
@@ -893,15 +1026,15 @@ code block::identify(const context& ctx) const NOEXCEPT
 // Use of get_hash() in is_forward_reference makes this thread-unsafe.
 code block::check() const NOEXCEPT
 {
-    // empty_block is subset of first_not_coinbase.
     // type64 malleated is a subset of first_not_coinbase.
     // type32 malleated is a subset of is_internal_double_spend.
+    if (is_empty())
+        return error::empty_block;
     if (is_oversized())
         return error::block_size_limit;
     if (is_first_non_coinbase())
-        return (is_empty() ? error::empty_block :
-            (is_malleated() ? error::invalid_transaction_commitment :
-                error::first_not_coinbase));
+        return is_malleated() ? error::invalid_transaction_commitment :
+            error::first_not_coinbase;
     if (is_extra_coinbases())
         return error::extra_coinbases;
     if (is_forward_reference())
@@ -915,6 +1048,21 @@ code block::check() const NOEXCEPT
     return check_transactions();
 }
 
+// private
+// The checks of check() not performed as transactions are streamed.
+code block::check_streamed() const NOEXCEPT
+{
+    if (is_forward_reference())
+        return error::forward_reference;
+    if (is_internal_double_spend())
+        return is_malleated() ? error::invalid_transaction_commitment :
+            error::block_internal_double_spend;
+    if (is_invalid_merkle_root())
+        return error::invalid_transaction_commitment;
+
+    return error::block_success;
+}
+
 // forks
 // height
 // timestamp
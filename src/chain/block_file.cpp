@@ -0,0 +1,136 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/chain/block_file.hpp>
+
+#include <algorithm>
+#include <bitcoin/system/chain/block.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/endian/endian.hpp>
+#include <bitcoin/system/math/math.hpp>
+#include <bitcoin/system/stream/stream.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+
+// Constructors.
+// ----------------------------------------------------------------------------
+
+block_file::block_file(const data_slice& data, uint32_t magic) NOEXCEPT
+  : data_(data), magic_(magic)
+{
+}
+
+// Properties.
+// ----------------------------------------------------------------------------
+
+bool block_file::is_valid() const NOEXCEPT
+{
+    return valid_;
+}
+
+size_t block_file::position() const NOEXCEPT
+{
+    return position_;
+}
+
+// Methods.
+// ----------------------------------------------------------------------------
+
+bool block_file::next(data_slice& out) NOEXCEPT
+{
+    const auto remaining = data_.size() - position_;
+    if (!valid_ || is_zero(remaining))
+        return false;
+
+    // Preallocated files are zero filled beyond the last record.
+    const auto start = std::next(data_.data(), position_);
+    if (remaining < sizeof(uint32_t) ||
+        is_zero(unsafe_from_little_endian<uint32_t>(start)))
+    {
+        position_ = data_.size();
+        return false;
+    }
+
+    if (remaining < record_header ||
+        unsafe_from_little_endian<uint32_t>(start) != magic_)
+    {
+        valid_ = false;
+        return false;
+    }
+
+    const auto size = unsafe_from_little_endian<uint32_t>(
+        std::next(start, sizeof(uint32_t)));
+
+    if (is_zero(size) || size > remaining - record_header)
+    {
+        valid_ = false;
+        return false;
+    }
+
+    const auto begin = std::next(start, record_header);
+    out = { begin, std::next(begin, size) };
+    position_ += record_header + size;
+    return true;
+}
+
+bool block_file::decode(const handler& handler, bool witness,
+    size_t read_ahead) NOEXCEPT
+{
+    read_ahead = std::max(read_ahead, one);
+    std_vector<data_slice> slices{};
+    std_vector<block::cptr> blocks{};
+    slices.reserve(read_ahead);
+    blocks.resize(read_ahead);
+
+    data_slice slice{};
+    do
+    {
+        slices.clear();
+        while (slices.size() < read_ahead && next(slice))
+            slices.push_back(slice);
+
+        // Blocks of a batch are independent, and delivered in file order.
+        std::transform(poolstl::execution::par, slices.begin(), slices.end(),
+            blocks.begin(), [witness](const data_slice& data) NOEXCEPT
+            {
+                return to_shared<block>(stream::in::fast{ data }, witness);
+            });
+
+        for (size_t index = 0; index < slices.size(); ++index)
+        {
+            if (!handler(blocks.at(index)))
+                return false;
+
+            blocks.at(index).reset();
+        }
+    }
+    while (slices.size() == read_ahead);
+
+    return valid_;
+}
+
+BC_POP_WARNING()
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
@@ -0,0 +1,263 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/chain/gather.hpp>
+
+#include <algorithm>
+#include <bitcoin/system/chain/block.hpp>
+#include <bitcoin/system/chain/enums/magic_numbers.hpp>
+#include <bitcoin/system/chain/header.hpp>
+#include <bitcoin/system/chain/input.hpp>
+#include <bitcoin/system/chain/output.hpp>
+#include <bitcoin/system/chain/point.hpp>
+#include <bitcoin/system/chain/script.hpp>
+#include <bitcoin/system/chain/transaction.hpp>
+#include <bitcoin/system/chain/witness.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/endian/endian.hpp>
+#include <bitcoin/system/math/math.hpp>
+#include <bitcoin/system/stream/stream.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+
+// Constructors.
+// ----------------------------------------------------------------------------
+
+gather::gather(const block& block, bool witness) NOEXCEPT
+  : size_(block.serialized_size(witness))
+{
+    buffer_.reserve(size_);
+    write(block, witness);
+}
+
+gather::gather(const transaction& tx, bool witness) NOEXCEPT
+  : size_(tx.serialized_size(witness))
+{
+    buffer_.reserve(size_);
+    write(tx, witness);
+}
+
+// Properties.
+// ----------------------------------------------------------------------------
+
+size_t gather::size() const NOEXCEPT
+{
+    return size_;
+}
+
+const gather::segments& gather::parts() const NOEXCEPT
+{
+    return segments_;
+}
+
+bool gather::copy(const data_slab& out) const NOEXCEPT
+{
+    if (out.size() != size_)
+        return false;
+
+    auto to = out.data();
+    for (const auto& segment: segments_)
+        to = std::copy(segment.begin(), segment.end(), to);
+
+    return true;
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+// Contiguous owned bytes are coalesced into one segment.
+uint8_t* gather::allocate(size_t size) NOEXCEPT
+{
+    BC_ASSERT(buffer_.size() + size <= buffer_.capacity());
+    const auto start = buffer_.size();
+    buffer_.resize(start + size);
+    const auto data = buffer_.data() + start;
+
+    if (owned_)
+    {
+        auto& last = segments_.back();
+        last = { last.data(), data + size };
+    }
+    else if (!is_zero(size))
+    {
+        segments_.emplace_back(data, data + size);
+        owned_ = true;
+    }
+
+    return data;
+}
+
+void gather::reference(const data_slice& data) NOEXCEPT
+{
+    segments_.push_back(data);
+    owned_ = false;
+}
+
+void gather::write_byte(uint8_t value) NOEXCEPT
+{
+    *allocate(one) = value;
+}
+
+void gather::write_bytes(const data_slice& data) NOEXCEPT
+{
+    if (data.size() < minimum_reference)
+    {
+        std::copy(data.begin(), data.end(), allocate(data.size()));
+        return;
+    }
+
+    reference(data);
+}
+
+template <typename Integer>
+void gather::write_little_endian(Integer value) NOEXCEPT
+{
+    unsafe_to_little_endian<Integer>(allocate(sizeof(Integer)), value);
+}
+
+void gather::write_variable(uint64_t value) NOEXCEPT
+{
+    if (value < varint_two_bytes)
+    {
+        write_byte(narrow_cast<uint8_t>(value));
+    }
+    else if (value <= max_uint16)
+    {
+        write_byte(varint_two_bytes);
+        write_little_endian(narrow_cast<uint16_t>(value));
+    }
+    else if (value <= max_uint32)
+    {
+        write_byte(varint_four_bytes);
+        write_little_endian(narrow_cast<uint32_t>(value));
+    }
+    else
+    {
+        write_byte(varint_eight_bytes);
+        write_little_endian(value);
+    }
+}
+
+// Serialization (mirrors to_data(writer&) of each type).
+// ----------------------------------------------------------------------------
+
+void gather::write(const block& block, bool witness) NOEXCEPT
+{
+    const auto& txs = *block.transactions_ptr();
+    write(block.header());
+    write_variable(txs.size());
+
+    for (const auto& tx: txs)
+        write(*tx, witness);
+}
+
+void gather::write(const header& header) NOEXCEPT
+{
+    write_little_endian(header.version());
+    write_bytes(header.previous_block_hash());
+    write_bytes(header.merkle_root());
+    write_little_endian(header.timestamp());
+    write_little_endian(header.bits());
+    write_little_endian(header.nonce());
+}
+
+void gather::write(const transaction& tx, bool witness) NOEXCEPT
+{
+    witness &= tx.is_segregated();
+    const auto& inputs = *tx.inputs_ptr();
+    const auto& outputs = *tx.outputs_ptr();
+
+    write_little_endian(tx.version());
+
+    if (witness)
+    {
+        write_byte(witness_marker);
+        write_byte(witness_enabled);
+    }
+
+    write_variable(inputs.size());
+    for (const auto& input: inputs)
+        write(*input);
+
+    write_variable(outputs.size());
+    for (const auto& output: outputs)
+        write(*output);
+
+    if (witness)
+        for (const auto& input: inputs)
+            write(input->witness());
+
+    write_little_endian(tx.locktime());
+}
+
+void gather::write(const input& input) NOEXCEPT
+{
+    write_bytes(input.point().hash());
+    write_little_endian(input.point().index());
+    write(input.script());
+    write_little_endian(input.sequence());
+}
+
+void gather::write(const output& output) NOEXCEPT
+{
+    write_little_endian(output.value());
+    write(output.script());
+}
+
+void gather::write(const script& script) NOEXCEPT
+{
+    const auto size = script.serialized_size(false);
+    write_variable(size);
+
+    // Scripts not deserialized (or offset) are serialized from operations.
+    const auto retained = script.retained();
+    if (retained.size() == size)
+    {
+        write_bytes(retained);
+        return;
+    }
+
+    const auto data = allocate(size);
+    write::bytes::copy sink({ data, data + size });
+    script.to_data(sink, false);
+}
+
+void gather::write(const witness& witness) NOEXCEPT
+{
+    // Witness prefix is an element count, not byte length (unlike script).
+    const auto count = witness.stack_size();
+    write_variable(count);
+
+    for (size_t index = 0; index < count; ++index)
+    {
+        const auto data = witness.element(index);
+        write_variable(data.size());
+        write_bytes(data);
+    }
+}
+
+BC_POP_WARNING()
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
@@ -176,6 +176,14 @@ data_chunk header::to_data() const NOEXCEPT
     return data;
 }
 
+void header::to_data(data_chunk& data) const NOEXCEPT
+{
+    data.resize(serialized_size());
+    stream::out::fast ostream(data);
+    write::bytes::fast out(ostream);
+    to_data(out);
+}
+
 void header::to_data(std::ostream& stream) const NOEXCEPT
 {
     write::bytes::ostream out(stream);
@@ -439,12 +439,12 @@ bool input::is_relative_locked(size_t height,
 
 bool input::reserved_hash(hash_cref& out) const NOEXCEPT
 {
-    const auto& stack = witness().stack();
-    if (!witness::is_reserved_pattern(stack))
+    const auto& witness = get_witness();
+    if (!witness.is_reserved_pattern())
         return false;
 
     // Guarded by is_reserved_pattern.
-    out = unsafe_array_cast<uint8_t, hash_size>(stack.front()->data());
+    out = unsafe_array_cast<uint8_t, hash_size>(witness.element(0).data());
     return true;
 }
 
@@ -0,0 +1,249 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/chain/json.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <iterator>
+#include <string>
+#include <bitcoin/system/chain/block.hpp>
+#include <bitcoin/system/chain/enums/flags.hpp>
+#include <bitcoin/system/chain/header.hpp>
+#include <bitcoin/system/chain/input.hpp>
+#include <bitcoin/system/chain/operation.hpp>
+#include <bitcoin/system/chain/output.hpp>
+#include <bitcoin/system/chain/point.hpp>
+#include <bitcoin/system/chain/script.hpp>
+#include <bitcoin/system/chain/transaction.hpp>
+#include <bitcoin/system/chain/witness.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/math/math.hpp>
+#include <bitcoin/system/radix/radix.hpp>
+#include <bitcoin/system/stream/stream.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+// All strings of the value_from conversions are base16, script mnemonics or
+// "(?)", none of which requires json escaping, so strings are written as is.
+// Keys are written in the order of the corresponding value_from conversion.
+
+// Hex is encoded through a stack buffer, in pieces of this many bytes.
+constexpr size_t encode_piece = 512;
+
+BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+
+// primitives
+// ----------------------------------------------------------------------------
+
+static void write_number(writer& sink, uint64_t value) NOEXCEPT
+{
+    std_array<char, 20> buffer{};
+    const auto begin = buffer.data();
+    const auto end = std::to_chars(begin, begin + buffer.size(), value).ptr;
+    sink.write_bytes(data_slice{ begin, end });
+}
+
+static void write_base16(writer& sink, const data_slice& data) NOEXCEPT
+{
+    std_array<uint8_t, encode_piece * octet_width> buffer{};
+    for (auto it = data.begin(); it != data.end();)
+    {
+        const auto size = std::min(encode_piece,
+            possible_narrow_and_sign_cast<size_t>(std::distance(it,
+                data.end())));
+        const auto end = buffer.data() + size * octet_width;
+        encode_base16(data_slab{ buffer.data(), end }, { it, it + size });
+        sink.write_bytes(data_slice{ buffer.data(), end });
+        it += size;
+    }
+}
+
+static void write_hash(writer& sink, const hash_digest& hash) NOEXCEPT
+{
+    sink.write_byte('"');
+    auto reversed = hash;
+    std::reverse(reversed.begin(), reversed.end());
+    write_base16(sink, reversed);
+    sink.write_byte('"');
+}
+
+template <typename Collection>
+static void write_array(writer& sink, const Collection& collection) NOEXCEPT
+{
+    auto first = true;
+    sink.write_byte('[');
+    for (const auto& element: collection)
+    {
+        if (!first)
+            sink.write_byte(',');
+
+        to_json(sink, *element);
+        first = false;
+    }
+
+    sink.write_byte(']');
+}
+
+BC_POP_WARNING()
+
+// objects
+// ----------------------------------------------------------------------------
+
+void to_json(writer& sink, const block& block) NOEXCEPT
+{
+    sink.write_bytes("{\"header\":");
+    to_json(sink, block.header());
+    sink.write_bytes(",\"transactions\":");
+    write_array(sink, *block.transactions_ptr());
+    sink.write_byte('}');
+}
+
+void to_json(writer& sink, const header& header) NOEXCEPT
+{
+    sink.write_bytes("{\"version\":");
+    write_number(sink, header.version());
+    sink.write_bytes(",\"previous\":");
+    write_hash(sink, header.previous_block_hash());
+    sink.write_bytes(",\"merkle_root\":");
+    write_hash(sink, header.merkle_root());
+    sink.write_bytes(",\"timestamp\":");
+    write_number(sink, header.timestamp());
+    sink.write_bytes(",\"bits\":");
+    write_number(sink, header.bits());
+    sink.write_bytes(",\"nonce\":");
+    write_number(sink, header.nonce());
+    sink.write_byte('}');
+}
+
+void to_json(writer& sink, const transaction& tx) NOEXCEPT
+{
+    sink.write_bytes("{\"version\":");
+    write_number(sink, tx.version());
+    sink.write_bytes(",\"inputs\":");
+    write_array(sink, *tx.inputs_ptr());
+    sink.write_bytes(",\"outputs\":");
+    write_array(sink, *tx.outputs_ptr());
+    sink.write_bytes(",\"locktime\":");
+    write_number(sink, tx.locktime());
+    sink.write_byte('}');
+}
+
+void to_json(writer& sink, const input& input) NOEXCEPT
+{
+    sink.write_bytes("{\"point\":");
+    to_json(sink, input.point());
+    sink.write_bytes(",\"script\":");
+    to_json(sink, input.script());
+    sink.write_bytes(",\"witness\":");
+    to_json(sink, input.witness());
+    sink.write_bytes(",\"sequence\":");
+    write_number(sink, input.sequence());
+    sink.write_byte('}');
+}
+
+void to_json(writer& sink, const output& output) NOEXCEPT
+{
+    sink.write_bytes("{\"value\":");
+    write_number(sink, output.value());
+    sink.write_bytes(",\"script\":");
+    to_json(sink, output.script());
+    sink.write_byte('}');
+}
+
+void to_json(writer& sink, const point& point) NOEXCEPT
+{
+    sink.write_bytes("{\"hash\":");
+    write_hash(sink, point.hash());
+    sink.write_bytes(",\"index\":");
+    write_number(sink, point.index());
+    sink.write_byte('}');
+}
+
+// Matches script::to_string(flags::all_rules).
+void to_json(writer& sink, const script& script) NOEXCEPT
+{
+    auto first = true;
+    sink.write_byte('"');
+    for (const auto& op: script.ops())
+    {
+        if (!first)
+            sink.write_byte(' ');
+
+        op.to_string(sink, flags::all_rules);
+        first = false;
+    }
+
+    sink.write_byte('"');
+}
+
+// Matches witness::to_string(), elements are not materialized as a stack.
+void to_json(writer& sink, const witness& witness) NOEXCEPT
+{
+    sink.write_byte('"');
+    if (!witness.is_valid())
+    {
+        sink.write_bytes("(?)");
+    }
+    else
+    {
+        for (size_t index = 0; index < witness.stack_size(); ++index)
+        {
+            if (!is_zero(index))
+                sink.write_byte(' ');
+
+            sink.write_byte('[');
+            write_base16(sink, witness.element(index));
+            sink.write_byte(']');
+        }
+    }
+
+    sink.write_byte('"');
+}
+
+// strings
+// ----------------------------------------------------------------------------
+
+// Hex at least doubles the wire size, which is a sufficient initial reserve.
+template <typename Object>
+static std::string to_text(const Object& object, size_t reserve) NOEXCEPT
+{
+    std::string text{};
+    text.reserve(reserve);
+    write::bytes::text sink(text);
+    to_json(sink, object);
+    sink.flush();
+    return text;
+}
+
+std::string to_json(const block& block) NOEXCEPT
+{
+    return to_text(block, two * block.serialized_size(true));
+}
+
+std::string to_json(const transaction& tx) NOEXCEPT
+{
+    return to_text(tx, two * tx.serialized_size(true));
+}
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
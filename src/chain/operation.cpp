@@ -32,6 +32,7 @@
 #include <bitcoin/system/chain/operation.hpp>
 
 #include <algorithm>
+#include <iterator>
 #include <memory>
 #include <bitcoin/system/chain/enums/numbers.hpp>
 #include <bitcoin/system/chain/enums/opcode.hpp>
@@ -474,20 +475,57 @@ static std::string opcode_to_prefix(opcode code,
     }
 }
 
-std::string operation::to_string(uint32_t active_flags) const NOEXCEPT
+// Hex is encoded through a stack buffer, in pieces of this many bytes.
+BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+static void write_base16(writer& sink, const data_chunk& data) NOEXCEPT
 {
-    if (!is_valid())
-        return "(?)";
-
-    if (underflow_)
-        return "<" + encode_base16(get_data()) + ">";
+    constexpr size_t piece = 512;
+    std_array<uint8_t, piece * octet_width> buffer{};
+    for (auto it = data.begin(); it != data.end();)
+    {
+        const auto size = std::min(piece, possible_narrow_and_sign_cast<
+            size_t>(std::distance(it, data.end())));
+        const auto end = buffer.data() + size * octet_width;
+        encode_base16(data_slab{ buffer.data(), end }, { it, it + size });
+        sink.write_bytes(data_slice{ buffer.data(), end });
+        it += size;
+    }
+}
+BC_POP_WARNING()
 
-    if (data_empty())
-        return opcode_to_mnemonic(code_, active_flags);
+std::string operation::to_string(uint32_t active_flags) const NOEXCEPT
+{
+    std::string text{};
+    write::bytes::text sink(text);
+    to_string(sink, active_flags);
+    sink.flush();
+    return text;
+}
 
-    // Data encoding uses single token with explicit size prefix as required.
-    return "[" + opcode_to_prefix(code_, get_data()) +
-        encode_base16(get_data()) + "]";
+void operation::to_string(writer& sink, uint32_t active_flags) const NOEXCEPT
+{
+    if (!is_valid())
+    {
+        sink.write_bytes("(?)");
+    }
+    else if (underflow_)
+    {
+        sink.write_byte('<');
+        write_base16(sink, get_data());
+        sink.write_byte('>');
+    }
+    else if (data_empty())
+    {
+        sink.write_bytes(opcode_to_mnemonic(code_, active_flags));
+    }
+    else
+    {
+        // Data encoding uses single token with explicit size prefix as required.
+        sink.write_byte('[');
+        sink.write_bytes(opcode_to_prefix(code_, get_data()));
+        write_base16(sink, get_data());
+        sink.write_byte(']');
+    }
 }
 
 // Properties.
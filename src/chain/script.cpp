@@ -31,6 +31,7 @@
 #include <bitcoin/system/chain/script.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <sstream>
 #include <utility>
 #include <bitcoin/system/chain/enums/flags.hpp>
@@ -78,25 +79,36 @@ script::~script() NOEXCEPT
 {
 }
 
+// An unparsed script is copied/moved as unparsed (bytes only).
 script::script(script&& other) NOEXCEPT
-  : script(
-      std::move(other.ops_),
-      other.valid_,
-      other.easier_,
-      other.failer_,
-      other.roller_,
-      other.size_)
+  : bytes_(std::move(other.bytes_)),
+    ops_(std::move(other.ops_)),
+    state_(other.is_parsed() ? state::parsed : state::unparsed),
+    valid_(other.valid_),
+    easier_(other.easier_),
+    failer_(other.failer_),
+    roller_(other.roller_),
+    size_(other.size_),
+    offset(ops_.begin())
 {
 }
 
 script::script(const script& other) NOEXCEPT
-  : script(
-      other.ops_,
-      other.valid_,
-      other.easier_,
-      other.failer_,
-      other.roller_,
-      other.size_)
+  : script(other, other.is_parsed())
+{
+}
+
+// private
+script::script(const script& other, bool parsed) NOEXCEPT
+  : bytes_(other.bytes_),
+    ops_(parsed ? other.ops_ : operations{}),
+    state_(parsed ? state::parsed : state::unparsed),
+    valid_(other.valid_),
+    easier_(parsed && other.easier_),
+    failer_(parsed && other.failer_),
+    roller_(parsed && other.roller_),
+    size_(other.size_),
+    offset(ops_.begin())
 {
 }
 
@@ -135,8 +147,10 @@ script::script(reader&& source, bool prefix) NOEXCEPT
 {
 }
 
+// Serialized bytes are arena allocated, operations are parsed on first use.
 script::script(reader& source, bool prefix) NOEXCEPT
-  : ops_(source.get_arena())
+  : bytes_(source.get_arena()),
+    state_(state::unparsed)
 {
     assign_data(source, prefix);
 }
@@ -149,7 +163,9 @@ script::script(const std::string& mnemonic) NOEXCEPT
 // protected
 script::script(const operations& ops, bool valid, bool easier, bool failer,
     bool roller, size_t size) NOEXCEPT
-  : ops_(ops),
+  : bytes_(),
+    ops_(ops),
+    state_(state::parsed),
     valid_(valid),
     easier_(easier),
     failer_(failer),
@@ -164,7 +180,10 @@ script::script(const operations& ops, bool valid, bool easier, bool failer,
 
 script& script::operator=(script&& other) NOEXCEPT
 {
+    const auto parsed = other.is_parsed();
+    bytes_ = std::move(other.bytes_);
     ops_ = std::move(other.ops_);
+    state_.store(parsed ? state::parsed : state::unparsed);
     valid_ = other.valid_;
     easier_ = other.easier_;
     failer_ = other.failer_;
@@ -176,11 +195,14 @@ script& script::operator=(script&& other) NOEXCEPT
 
 script& script::operator=(const script& other) NOEXCEPT
 {
-    ops_ = other.ops_;
+    const auto parsed = other.is_parsed();
+    bytes_ = other.bytes_;
+    ops_ = parsed ? other.ops_ : operations{};
+    state_.store(parsed ? state::parsed : state::unparsed);
     valid_ = other.valid_;
-    easier_ = other.easier_;
-    failer_ = other.failer_;
-    roller_ = other.roller_;
+    easier_ = parsed && other.easier_;
+    failer_ = parsed && other.failer_;
+    roller_ = parsed && other.roller_;
     size_ = other.size_;
     offset = ops_.begin();
     return *this;
@@ -188,8 +210,14 @@ script& script::operator=(const script& other) NOEXCEPT
 
 bool script::operator==(const script& other) const NOEXCEPT
 {
-    return size_ == other.size_
-        && ops_ == other.ops_;
+    if (size_ != other.size_)
+        return false;
+
+    // Equal serializations imply equal operations (and vice versa).
+    if (!bytes_.empty() && !other.bytes_.empty())
+        return bytes_ == other.bytes_;
+
+    return ops() == other.ops();
 }
 
 bool script::operator!=(const script& other) const NOEXCEPT
@@ -262,16 +290,50 @@ void script::assign_data(reader& source, bool prefix) NOEXCEPT
     easier_ = false;
     failer_ = false;
     roller_ = false;
-    size_t expected{};
 
     if (prefix)
     {
-        expected = source.read_size();
-        source.set_limit(expected);
+        // Guards allocation, as with operation push data.
+        const auto size = source.read_size(max_block_size);
+        bytes_.resize(size);
+        source.read_bytes(bytes_.data(), size);
+    }
+    else
+    {
+        // Without a prefix the script consumes the remaining (limited) stream.
+        bytes_ = source.read_bytes();
     }
 
+    if (!source)
+        bytes_.clear();
+
+    size_ = bytes_.size();
+    valid_ = source;
+    offset = ops_.begin();
+
+    // An empty script has no operations to parse.
+    if (bytes_.empty())
+        state_.store(state::parsed);
+}
+
+// private
+// Operations are allocated from the default arena, as materialization may
+// occur on any thread and after the deserialization arena is unavailable.
+void script::materialize() const NOEXCEPT
+{
+    auto expected = state::unparsed;
+    if (!state_.compare_exchange_strong(expected, state::parsing,
+        std::memory_order_acquire))
+    {
+        // Another thread is parsing (or has parsed), wait for completion.
+        while (state_.load(std::memory_order_acquire) != state::parsed)
+            state_.wait(state::parsing, std::memory_order_acquire);
+
+        return;
+    }
+
+    read::bytes::copy source(bytes_);
     ops_.reserve(op_count(source));
-    const auto start = source.get_read_position();
 
     while (!source.is_exhausted())
     {
@@ -282,17 +344,9 @@ void script::assign_data(reader& source, bool prefix) NOEXCEPT
         roller_ |= op.is_roller();
     }
 
-    size_ = source.get_read_position() - start;
-
-    if (prefix)
-    {
-        source.set_limit();
-        if (size_ != expected)
-            source.invalidate();
-    }
-
-    valid_ = source;
     offset = ops_.begin();
+    state_.store(state::parsed, std::memory_order_release);
+    state_.notify_all();
 }
 
 // static/private
@@ -344,6 +398,14 @@ data_chunk script::to_data(bool prefix) const NOEXCEPT
     return data;
 }
 
+void script::to_data(data_chunk& data, bool prefix) const NOEXCEPT
+{
+    data.resize(serialized_size(prefix));
+    stream::out::fast ostream(data);
+    write::bytes::fast out(ostream);
+    to_data(out, prefix);
+}
+
 void script::to_data(std::ostream& stream, bool prefix) const NOEXCEPT
 {
     write::bytes::ostream out(stream);
@@ -357,8 +419,15 @@ void script::to_data(writer& sink, bool prefix) const NOEXCEPT
         sink.write_variable(serialized_size(false));
 
     // Data serialization is affected by offset metadata.
-    for (iterator op{ offset }; op != ops().end(); ++op)
-        op->to_data(sink);
+    if (is_offset() || bytes_.empty())
+    {
+        for (iterator op{ offset }; op != ops().end(); ++op)
+            op->to_data(sink);
+    }
+    else
+    {
+        sink.write_bytes(bytes_);
+    }
 }
 
 std::string script::to_string(uint32_t active_flags) const NOEXCEPT
@@ -379,7 +448,14 @@ std::string script::to_string(uint32_t active_flags) const NOEXCEPT
 
 void script::clear_offset() const NOEXCEPT
 {
-    offset = ops_.begin();
+    offset = ops().begin();
+}
+
+// private
+bool script::is_offset() const NOEXCEPT
+{
+    // An unparsed script cannot have been offset.
+    return is_parsed() && offset != ops_.begin();
 }
 
 // Properties.
@@ -394,18 +470,21 @@ bool script::is_valid() const NOEXCEPT
 
 bool script::is_roller() const NOEXCEPT
 {
+    ops();
     return roller_;
 };
 
 bool script::is_prefail() const NOEXCEPT
 {
     // Script contains an invalid opcode and will fail evaluation.
+    ops();
     return failer_;
 }
 
 bool script::is_prevalid() const NOEXCEPT
 {
     // Script contains a success opcode and will pass evaluation (tapscript).
+    ops();
     return easier_;
 }
 
@@ -425,7 +504,7 @@ bool script::is_oversized() const NOEXCEPT
 // The criteria below are not comprehensive but are fast to evaluate.
 bool script::is_unspendable() const NOEXCEPT
 {
-    if (ops_.empty())
+    if (ops().empty())
         return false;
 
     const auto& code = ops_.front().code();
@@ -436,8 +515,16 @@ bool script::is_unspendable() const NOEXCEPT
     return operation::is_reserved(code) || operation::is_invalid(code);
 }
 
+bool script::is_parsed() const NOEXCEPT
+{
+    return state_.load(std::memory_order_acquire) == state::parsed;
+}
+
 const operations& script::ops() const NOEXCEPT
 {
+    if (!is_parsed())
+        materialize();
+
     return ops_;
 }
 
@@ -461,12 +548,17 @@ size_t script::serialized_size(const operations& ops) NOEXCEPT
 size_t script::serialized_size(bool prefix) const NOEXCEPT
 {
     // Recompute it serialization has been affected by offset metadata.
-    const auto size = (offset == ops_.begin()) ? size_ :
-        std::accumulate(offset, ops_.end(), zero, op_size);
+    const auto size = !is_offset() ? size_ :
+        std::accumulate(offset, ops_.cend(), zero, op_size);
 
     return prefix ? ceilinged_add(size, variable_size(size)) : size;
 }
 
+data_slice script::retained() const NOEXCEPT
+{
+    return is_offset() ? data_slice{} : data_slice{ bytes_ };
+}
+
 BC_POP_WARNING()
 BC_POP_WARNING()
 
@@ -53,10 +53,12 @@ const chunk_cptr& script::witness_program() const NOEXCEPT
 
 script_version script::version() const NOEXCEPT
 {
-    if (!is_witness_program_pattern(ops()))
+    if (bytes_.empty() ? !is_witness_program_pattern(ops()) :
+        !is_witness_program_pattern(bytes_))
         return script_version::unversioned;
 
-    switch (ops_.front().code())
+    switch (bytes_.empty() ? ops_.front().code() :
+        static_cast<opcode>(bytes_.front()))
     {
         case opcode::push_size_0:
             return script_version::segwit;
@@ -79,6 +81,16 @@ script_pattern script::pattern() const NOEXCEPT
 // The bip141 coinbase pattern is not tested here, must test independently.
 script_pattern script::output_pattern() const NOEXCEPT
 {
+    // Common templates are matched without parsing when deserialized.
+    if (!bytes_.empty())
+    {
+        if (is_pay_key_hash_pattern(bytes_))
+            return script_pattern::pay_key_hash;
+
+        if (is_pay_script_hash_pattern(bytes_))
+            return script_pattern::pay_script_hash;
+    }
+
     if (is_pay_key_hash_pattern(ops()))
         return script_pattern::pay_key_hash;
 
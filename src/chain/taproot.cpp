@@ -31,13 +31,19 @@
 #include <bitcoin/system/chain/taproot.hpp>
 
 #include <algorithm>
+#include <functional>
+#include <queue>
+#include <utility>
+#include <vector>
 #include <bitcoin/system/chain/annex.hpp>
+#include <bitcoin/system/chain/enums/magic_numbers.hpp>
 #include <bitcoin/system/chain/script.hpp>
 #include <bitcoin/system/chain/tapscript.hpp>
 #include <bitcoin/system/crypto/crypto.hpp>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/hash/hash.hpp>
+#include <bitcoin/system/math/math.hpp>
 #include <bitcoin/system/stream/stream.hpp>
 
 namespace libbitcoin {
@@ -78,6 +84,17 @@ hash_digest taproot::branch_hash(const hash_digest& first,
     return out;
 }
 
+// TapTweak (key path only)
+hash_digest taproot::tweak_hash(const ec_xonly& key) NOEXCEPT
+{
+    hash_digest out{};
+    stream::out::fast stream{ out };
+    hash::sha256t::fast<"TapTweak"> sink{ stream };
+    sink.write_bytes(key);
+    sink.flush();
+    return out;
+}
+
 // TapTweak
 hash_digest taproot::tweak_hash(const ec_xonly& key,
     const hash_digest& merkle) NOEXCEPT
@@ -126,6 +143,124 @@ bool taproot::verify_commit(const tapscript& control, const ec_xonly& out_key,
     return verify_commitment(control.key(), tweak, out_key, control.parity());
 }
 
+BC_PUSH_WARNING(NO_DYNAMIC_ARRAY_INDEXING)
+
+bool taproot::commit(commitment& out, const ec_xonly& internal_key,
+    const leaves& leaves) NOEXCEPT
+{
+    constexpr auto none = max_size_t;
+    const auto count = leaves.size();
+
+    // A partial commitment is never left in out.
+    const auto fail = [&out]() NOEXCEPT
+    {
+        out = {};
+        return false;
+    };
+
+    if (std::any_of(leaves.begin(), leaves.end(), [](const leaf& leaf) NOEXCEPT
+        {
+            return leaf.version != bit_and(leaf.version, tapscript_mask);
+        }))
+        return fail();
+
+    out.leaf_hashes.resize(count);
+    out.controls.clear();
+
+    // Leaf hashes are independent of each other and of the tree.
+    std::transform(poolstl::execution::par, leaves.begin(), leaves.end(),
+        out.leaf_hashes.begin(), [](const leaf& leaf) NOEXCEPT
+        {
+            return leaf_hash(leaf.version, leaf.script);
+        });
+
+    // Nodes [0, count) are leaves, each branch is appended as it is created,
+    // so a parent always follows its children.
+    struct node
+    {
+        hash_digest hash;
+        size_t sibling;
+        size_t parent;
+    };
+
+    std_vector<node> nodes{};
+    nodes.reserve(two * count);
+    for (const auto& hash: out.leaf_hashes)
+        nodes.push_back({ hash, none, none });
+
+    // Huffman: combine the two lightest nodes (earliest first when equal).
+    typedef std::pair<uint64_t, size_t> entry;
+    std::priority_queue<entry, std::vector<entry>, std::greater<entry>>
+        queue{};
+
+    for (size_t index = 0; index < count; ++index)
+        queue.emplace(leaves[index].weight, index);
+
+    while (queue.size() > one)
+    {
+        const auto first = queue.top();
+        queue.pop();
+        const auto second = queue.top();
+        queue.pop();
+
+        const auto branch = nodes.size();
+        auto& left = nodes[first.second];
+        auto& right = nodes[second.second];
+        left.sibling = second.second;
+        right.sibling = first.second;
+        left.parent = right.parent = branch;
+
+        const auto hash = sorted_branch_hash(left.hash, right.hash);
+        nodes.push_back({ hash, none, none });
+        queue.emplace(ceilinged_add(first.first, second.first), branch);
+    }
+
+    // Depths follow from parents, in reverse order of creation.
+    std_vector<size_t> depths(nodes.size());
+    for (auto index = nodes.size(); !is_zero(index);)
+    {
+        --index;
+        const auto parent = nodes[index].parent;
+        depths[index] = parent == none ? zero : add1(depths[parent]);
+    }
+
+    if (std::any_of(depths.begin(), std::next(depths.begin(), count),
+        [](size_t depth) NOEXCEPT { return depth > taproot_max_keys; }))
+        return fail();
+
+    out.root = is_zero(count) ? null_hash : nodes.back().hash;
+    out.tweak = is_zero(count) ? tweak_hash(internal_key) :
+        tweak_hash(internal_key, out.root);
+
+    if (!schnorr::create_commitment(out.output_key, out.parity, internal_key,
+        out.tweak))
+        return fail();
+
+    // [v|p:1][k:32][e:32]..., the siblings of the path from leaf to root.
+    out.controls.resize(count);
+    std::for_each(poolstl::execution::par, poolstl::iota_iter<size_t>(zero),
+        poolstl::iota_iter<size_t>(count), [&](size_t index) NOEXCEPT
+        {
+            auto& control = out.controls[index];
+            control.reserve(add1(ec_xonly_size * add1(depths[index])));
+            control.push_back(bit_or(leaves[index].version,
+                to_int<uint8_t>(out.parity)));
+            control.insert(control.end(), internal_key.begin(),
+                internal_key.end());
+
+            for (auto at = index; nodes[at].parent != none;
+                at = nodes[at].parent)
+            {
+                const auto& sibling = nodes[nodes[at].sibling].hash;
+                control.insert(control.end(), sibling.begin(), sibling.end());
+            }
+        });
+
+    return true;
+}
+
+BC_POP_WARNING()
+
 } // namespace chain
 } // namespace system
 } // namespace libbitcoin
@@ -232,6 +232,16 @@ data_chunk transaction::to_data(bool witness) const NOEXCEPT
     return data;
 }
 
+void transaction::to_data(data_chunk& data, bool witness) const NOEXCEPT
+{
+    witness &= segregated_;
+
+    data.resize(serialized_size(witness));
+    stream::out::fast ostream(data);
+    write::bytes::fast out(ostream);
+    to_data(out, witness);
+}
+
 void transaction::to_data(std::ostream& stream, bool witness) const NOEXCEPT
 {
     witness &= segregated_;
@@ -469,6 +479,40 @@ bool transaction::create_endorsement(endorsement& out, const ec_secret& secret,
     return true;
 }
 
+// This is not used internal to the library.
+bool transaction::create_endorsements(endorsements& out,
+    const signers& signers, uint32_t flags) const NOEXCEPT
+{
+    const auto invalid = [this](const signer& signer) NOEXCEPT
+    {
+        return signer.index >= inputs_->size();
+    };
+
+    out.clear();
+    if (std::any_of(signers.begin(), signers.end(), invalid))
+        return false;
+
+    // Shared signature hashes are cached before concurrent reads.
+    set_signature_hashes(signers, flags);
+    out.resize(signers.size());
+
+    std::transform(poolstl::execution::par, signers.begin(), signers.end(),
+        out.begin(), [&](const signer& signer) NOEXCEPT
+        {
+            endorsement endorsement{};
+            if (!create_endorsement(endorsement, signer.secret,
+                signer.subscript, signer.index, signer.value,
+                signer.sighash_flags, signer.version, flags))
+                endorsement.clear();
+
+            return endorsement;
+        });
+
+    // A created endorsement is never empty.
+    return std::none_of(out.begin(), out.end(), [](const auto& endorsement)
+        NOEXCEPT { return endorsement.empty(); });
+}
+
 // Signature hashing (common).
 // ----------------------------------------------------------------------------
 
@@ -549,7 +593,7 @@ bool transaction::segregated(const chain::inputs& inputs) NOEXCEPT
 {
     const auto witnessed = [](const auto& input) NOEXCEPT
     {
-        return !input.witness().stack().empty();
+        return !is_zero(input.witness().stack_size());
     };
 
     return std::any_of(inputs.begin(), inputs.end(), witnessed);
@@ -560,7 +604,7 @@ bool transaction::segregated(const input_cptrs& inputs) NOEXCEPT
 {
     const auto witnessed = [](const auto& input) NOEXCEPT
     {
-        return !input->witness().stack().empty();
+        return !is_zero(input->witness().stack_size());
     };
 
     return std::any_of(inputs.begin(), inputs.end(), witnessed);
@@ -923,7 +967,7 @@ code transaction::confirm(const context& ctx) const NOEXCEPT
 // ----------------------------------------------------------------------------
 
 code transaction::connect_input(const context& ctx,
-    const input_iterator& it) const NOEXCEPT
+    const input_iterator& it, bool committed) const NOEXCEPT
 {
     using namespace machine;
 
@@ -931,11 +975,12 @@ code transaction::connect_input(const context& ctx,
     if ((*it)->is_roller())
     {
         // Evaluate rolling scripts with linear search but constant erase.
-        return interpreter<linked_stack>::connect(ctx, *this, it);
+        return interpreter<linked_stack>::connect(ctx, *this, it, committed);
     }
 
     // Evaluate non-rolling scripts with constant search but linear erase.
-    return interpreter<contiguous_stack>::connect(ctx, *this, it);
+    return interpreter<contiguous_stack>::connect(ctx, *this, it,
+        committed);
 }
 
 // Connect (contextual).
@@ -946,14 +991,24 @@ code transaction::connect_input(const context& ctx,
 // forks
 
 code transaction::connect(const context& ctx) const NOEXCEPT
+{
+    return connect(ctx, {});
+}
+
+code transaction::connect(const context& ctx,
+    const std_vector<bool>& committed) const NOEXCEPT
 {
     ////BC_ASSERT(!is_coinbase());
+    BC_ASSERT(committed.empty() || committed.size() == inputs_->size());
 
     if (is_coinbase())
         return error::transaction_success;
 
+    // Empty committed implies full commitment verification of each input.
+    auto bit = committed.begin();
     for (auto in = inputs_->begin(); in != inputs_->end(); ++in)
-        if (const auto ec = connect_input(ctx, in))
+        if (const auto ec = connect_input(ctx, in,
+            !committed.empty() && *bit++))
             return ec;
 
     return error::transaction_success;
@@ -227,6 +227,35 @@ void transaction::set_v1_only_hash() const NOEXCEPT
         );
 }
 
+// Set only the caches that signature hashing of signers would set.
+void transaction::set_signature_hashes(const signers& signers,
+    uint32_t flags) const NOEXCEPT
+{
+    const auto bip143 = script::is_enabled(flags, flags::bip143_rule);
+    const auto bip342 = script::is_enabled(flags, flags::bip342_rule);
+
+    for (const auto& signer: signers)
+    {
+        if (bip143 && signer.version == script_version::segwit)
+        {
+            set_x2_base_hash();
+        }
+        else if (bip342 && signer.version == script_version::taproot)
+        {
+            set_x1_base_hash();
+
+            // This requires ALL prevouts of the tx are populated.
+            if (!is_anyone_can_pay(signer.sighash_flags))
+                set_v1_only_hash();
+
+            // The output hash is cached by the output for hash_single.
+            if (mask_sighash(signer.sighash_flags) == coverage::hash_single &&
+                signer.index < outputs_->size())
+                outputs_->at(signer.index)->get_hash();
+        }
+    }
+}
+
 BC_POP_WARNING()
 
 // sha256x1 (script verson 1)
@@ -31,8 +31,12 @@
 #include <bitcoin/system/chain/witness.hpp>
 
 #include <algorithm>
+#include <atomic>
+#include <functional>
 #include <iterator>
+#include <memory>
 #include <utility>
+#include <bitcoin/system/arena.hpp>
 #include <bitcoin/system/chain/enums/magic_numbers.hpp>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
@@ -52,6 +56,39 @@ witness::witness() NOEXCEPT
 {
 }
 
+witness::~witness() NOEXCEPT
+{
+}
+
+// An unstacked witness is copied/moved as unstacked (contiguous only).
+witness::witness(witness&& other) NOEXCEPT
+  : bytes_(std::move(other.bytes_)),
+    offsets_(std::move(other.offsets_)),
+    stack_(std::move(other.stack_)),
+    state_(other.is_stacked() ? state::stacked : state::unstacked),
+    valid_(other.valid_),
+    size_(other.size_),
+    annex_(std::move(other.annex_))
+{
+}
+
+witness::witness(const witness& other) NOEXCEPT
+  : witness(other, other.is_stacked())
+{
+}
+
+// private
+witness::witness(const witness& other, bool stacked) NOEXCEPT
+  : bytes_(other.bytes_),
+    offsets_(other.offsets_),
+    stack_(stacked ? other.stack_ : chunk_cptrs{}),
+    state_(stacked ? state::stacked : state::unstacked),
+    valid_(other.valid_),
+    size_(other.size_),
+    annex_(other.annex_)
+{
+}
+
 witness::witness(data_stack&& stack) NOEXCEPT
   : witness(*to_shareds(std::move(stack)), true)
 {
@@ -99,10 +136,13 @@ witness::witness(reader&& source, bool prefix) NOEXCEPT
 {
 }
 
+// Element data and offsets are arena allocated, stack is created on first use.
 witness::witness(reader& source, bool prefix) NOEXCEPT
-  : stack_(source.get_arena()), annex_()
+  : bytes_(source.get_arena()),
+    offsets_(source.get_arena()),
+    state_(state::unstacked),
+    annex_()
 {
-    // annex_ may be reconstructed, since it requires the populated stack.
     assign_data(source, prefix);
 }
 
@@ -113,7 +153,9 @@ witness::witness(const std::string& mnemonic) NOEXCEPT
 
 // protected
 witness::witness(chunk_cptrs&& stack, bool valid) NOEXCEPT
-  : stack_(std::move(stack)), valid_(valid),
+  : stack_(std::move(stack)),
+    state_(state::stacked),
+    valid_(valid),
     size_(serialized_size(stack_, false)),
     annex_(stack_)
 {
@@ -122,6 +164,7 @@ witness::witness(chunk_cptrs&& stack, bool valid) NOEXCEPT
 // protected
 witness::witness(const chunk_cptrs& stack, bool valid) NOEXCEPT
   : stack_(stack),
+    state_(state::stacked),
     valid_(valid),
     size_(serialized_size(stack_, false)),
     annex_(stack_)
@@ -131,6 +174,7 @@ witness::witness(const chunk_cptrs& stack, bool valid) NOEXCEPT
 // protected
 witness::witness(const chunk_cptrs& stack, bool valid, size_t size) NOEXCEPT
   : stack_(stack),
+    state_(state::stacked),
     valid_(valid),
     size_(size),
     annex_(stack_)
@@ -140,9 +184,44 @@ witness::witness(const chunk_cptrs& stack, bool valid, size_t size) NOEXCEPT
 // Operators.
 // ----------------------------------------------------------------------------
 
+witness& witness::operator=(witness&& other) NOEXCEPT
+{
+    const auto stacked = other.is_stacked();
+    bytes_ = std::move(other.bytes_);
+    offsets_ = std::move(other.offsets_);
+    stack_ = std::move(other.stack_);
+    state_.store(stacked ? state::stacked : state::unstacked);
+    valid_ = other.valid_;
+    size_ = other.size_;
+    annex_ = std::move(other.annex_);
+    return *this;
+}
+
+witness& witness::operator=(const witness& other) NOEXCEPT
+{
+    const auto stacked = other.is_stacked();
+    bytes_ = other.bytes_;
+    offsets_ = other.offsets_;
+    stack_ = stacked ? other.stack_ : chunk_cptrs{};
+    state_.store(stacked ? state::stacked : state::unstacked);
+    valid_ = other.valid_;
+    size_ = other.size_;
+    annex_ = other.annex_;
+    return *this;
+}
+
 bool witness::operator==(const witness& other) const NOEXCEPT
 {
-    return deep_equal(stack_, other.stack_);
+    // Compares element data, independent of storage.
+    const auto count = stack_size();
+    if (count != other.stack_size())
+        return false;
+
+    for (size_t index = 0; index < count; ++index)
+        if (element(index) != other.element(index))
+            return false;
+
+    return true;
 }
 
 bool witness::operator!=(const witness& other) const NOEXCEPT
@@ -153,13 +232,17 @@ bool witness::operator!=(const witness& other) const NOEXCEPT
 // Deserialization.
 // ----------------------------------------------------------------------------
 
-static inline size_t element_size(const chunk_cptr& element) NOEXCEPT
+static inline size_t element_size(size_t size) NOEXCEPT
 {
     // Each witness is prefixed with number of elements [bip144].
-    const auto size = element->size();
     return ceilinged_add(variable_size(size), size);
 };
 
+static inline size_t element_size(const chunk_cptr& element) NOEXCEPT
+{
+    return element_size(element->size());
+};
+
 // static
 void witness::skip(reader& source, bool prefix) NOEXCEPT
 {
@@ -177,30 +260,67 @@ void witness::skip(reader& source, bool prefix) NOEXCEPT
     }
 }
 
+// static/private
+// Total element data size (and element count), without advancing the reader.
+size_t witness::data_size(reader& source, bool prefix, size_t& count) NOEXCEPT
+{
+    // Stream errors reset by set_position so trap here.
+    count = zero;
+    if (!source)
+        return zero;
+
+    const auto start = source.get_read_position();
+    const auto limit = prefix ? source.read_size(max_block_weight) : max_size_t;
+    auto bytes = zero;
+
+    while (count < limit && (prefix || !source.is_exhausted()))
+    {
+        const auto size = source.read_size(max_block_weight);
+        source.skip_bytes(size);
+        if (!source)
+            break;
+
+        bytes = ceilinged_add(bytes, size);
+        ++count;
+    }
+
+    source.set_position(start);
+    return bytes;
+}
+
 // private
+// Elements are read into one buffer, sized in advance, avoiding an allocation
+// (or reallocation) per element.
 void witness::assign_data(reader& source, bool prefix) NOEXCEPT
 {
+    auto elements = zero;
+    bytes_.resize(data_size(source, prefix, elements));
+    offsets_.reserve(add1(elements));
+    offsets_.push_back(zero);
     size_ = zero;
-    auto& allocator = source.get_allocator();
 
-    const auto push_witness = [&allocator, &source, this]() NOEXCEPT
+    const auto push_witness = [&source, this]() NOEXCEPT
     {
-        // If read_bytes_raw returns nullptr invalid source is implied.
         const auto size = source.read_size(max_block_weight);
-        const auto bytes = source.read_bytes_raw(size);
-        if (is_null(bytes))
+        const auto start = offsets_.back();
+        if (size > bytes_.size() - start)
+        {
+            source.invalidate();
             return false;
+        }
 
-        stack_.emplace_back(POINTER(data_chunk, allocator, bytes));
-        size_ = ceilinged_add(size_, element_size(stack_.back()));
+        source.read_bytes(std::next(bytes_.data(), start), size);
+        if (!source)
+            return false;
+
+        offsets_.push_back(start + size);
+        size_ = ceilinged_add(size_, element_size(size));
         return true;
     };
 
     if (prefix)
     {
         const auto count = source.read_size(max_block_weight);
-        stack_.reserve(count);
-
         for (size_t element = 0; element < count; ++element)
             if (!push_witness())
                 break;
@@ -212,12 +332,152 @@ void witness::assign_data(reader& source, bool prefix) NOEXCEPT
                 break;
     }
 
-    if (annex::is_annex_pattern(stack_))
-        annex_ = { stack_.back() };
+    // Discard a partial element.
+    bytes_.resize(offsets_.back());
+
+    // An empty stack has nothing to materialize.
+    if (is_zero(stack_size()))
+        state_.store(state::stacked);
+
+    // The annex is rare, so is copied independently of the stack.
+    if (is_annexed())
+        annex_ = { to_shared(element(sub1(stack_size())).to_chunk()) };
 
     valid_ = source;
 }
 
+// Linear arena over one owned buffer, for the elements of a stack created
+// from contiguous element data. Deallocation is a nop, the buffer is freed
+// with the arena. Allocations beyond the buffer revert to the default arena.
+class element_arena final
+  : public arena
+{
+public:
+    element_arena(size_t size) NOEXCEPT
+      : buffer_(size)
+    {
+    }
+
+    void* start(size_t) THROWS override
+    {
+        offset_ = zero;
+        return buffer_.data();
+    }
+
+    size_t detach() NOEXCEPT override
+    {
+        return offset_;
+    }
+
+    void release(void*) NOEXCEPT override
+    {
+    }
+
+private:
+    void* do_allocate(size_t bytes, size_t align) THROWS override
+    {
+        const auto mask = sub1(align);
+        const auto offset = bit_and(ceilinged_add(offset_, mask), bit_not(mask));
+        if (offset > buffer_.size() || bytes > buffer_.size() - offset)
+            return default_arena::get()->allocate(bytes, align);
+
+        offset_ = offset + bytes;
+        return std::next(buffer_.data(), offset);
+    }
+
+    void do_deallocate(void* ptr, size_t bytes, size_t align) NOEXCEPT override
+    {
+        const auto begin = buffer_.data();
+        const auto end = std::next(begin, buffer_.size());
+        const auto at = pointer_cast<uint8_t>(ptr);
+        if (std::less<>{}(at, begin) || !std::less<>{}(at, end))
+            default_arena::get()->deallocate(ptr, bytes, align);
+    }
+
+    bool do_is_equal(const arena& other) const NOEXCEPT override
+    {
+        return &other == this;
+    }
+
+    data_chunk buffer_;
+    size_t offset_{};
+};
+
+// The elements (and their data) of a stack share one owned buffer.
+struct stack_elements
+{
+    stack_elements(size_t bytes, size_t count) NOEXCEPT
+      : arena(ceilinged_add(ceilinged_multiply(count, sizeof(data_chunk)),
+            bytes)),
+        chunks(&arena)
+    {
+        chunks.reserve(count);
+    }
+
+    element_arena arena;
+    std_vector<data_chunk> chunks;
+};
+
+// private
+// Stack elements alias one owned buffer (default arena), as the stack may be
+// used on any thread and after the deserialization arena is unavailable. This
+// avoids an allocation and shared pointer control block per element.
+void witness::push_elements(chunk_cptrs& out, size_t count) const NOEXCEPT
+{
+    BC_ASSERT(count <= stack_size());
+    out.reserve(count);
+
+    // Non-contiguous and materialized elements are already shared.
+    if (is_stacked())
+    {
+        out.insert(out.end(), stack_.begin(), std::next(stack_.begin(), count));
+        return;
+    }
+
+    if (is_zero(count))
+        return;
+
+    const auto elements = std::make_shared<stack_elements>(offsets_[count],
+        count);
+
+    for (size_t index = 0; index < count; ++index)
+    {
+        const auto data = element(index);
+        elements->chunks.emplace_back(data.begin(), data.end());
+    }
+
+    for (const auto& chunk: elements->chunks)
+        out.emplace_back(elements, &chunk);
+}
+
+// private
+// Mutable stack of the first count elements, for script execution.
+chunk_cptrs_ptr witness::to_stack(size_t count) const NOEXCEPT
+{
+    const auto stack = std::make_shared<chunk_cptrs>();
+    push_elements(*stack, count);
+    return stack;
+}
+
+// private
+void witness::materialize() const NOEXCEPT
+{
+    auto expected = state::unstacked;
+    if (!state_.compare_exchange_strong(expected, state::stacking,
+        std::memory_order_acquire))
+    {
+        // Another thread is stacking (or has stacked), wait for completion.
+        while (state_.load(std::memory_order_acquire) != state::stacked)
+            state_.wait(state::stacking, std::memory_order_acquire);
+
+        return;
+    }
+
+    push_elements(stack_, stack_size());
+    state_.store(state::stacked, std::memory_order_release);
+    state_.notify_all();
+}
+
 // Serialization.
 // ----------------------------------------------------------------------------
 
@@ -230,6 +490,14 @@ data_chunk witness::to_data(bool prefix) const NOEXCEPT
     return data;
 }
 
+void witness::to_data(data_chunk& data, bool prefix) const NOEXCEPT
+{
+    data.resize(serialized_size(prefix));
+    stream::out::fast ostream(data);
+    write::bytes::fast out(ostream);
+    to_data(out, prefix);
+}
+
 void witness::to_data(std::ostream& stream, bool prefix) const NOEXCEPT
 {
     write::bytes::ostream out(stream);
@@ -239,14 +507,16 @@ void witness::to_data(std::ostream& stream, bool prefix) const NOEXCEPT
 void witness::to_data(writer& sink, bool prefix) const NOEXCEPT
 {
     // Witness prefix is an element count, not byte length (unlike script).
+    const auto count = stack_size();
     if (prefix)
-        sink.write_variable(stack_.size());
+        sink.write_variable(count);
 
     // Tokens encoded as variable integer prefixed byte array [bip144].
-    for (const auto& element: stack_)
+    for (size_t index = 0; index < count; ++index)
     {
-        sink.write_variable(element->size());
-        sink.write_bytes(*element);
+        const auto data = element(index);
+        sink.write_variable(data.size());
+        sink.write_bytes(data);
     }
 }
 
@@ -295,8 +565,8 @@ std::string witness::to_string() const NOEXCEPT
         return "(?)";
 
     std::string text;
-    for (const auto& element: stack_)
-        text += "[" + encode_base16(*element) + "] ";
+    for (size_t index = 0; index < stack_size(); ++index)
+        text += "[" + encode_base16(element(index)) + "] ";
 
     trim_right(text);
     return text;
@@ -310,8 +580,16 @@ bool witness::is_valid() const NOEXCEPT
     return valid_;
 }
 
+bool witness::is_stacked() const NOEXCEPT
+{
+    return state_.load(std::memory_order_acquire) == state::stacked;
+}
+
 const chunk_cptrs& witness::stack() const NOEXCEPT
 {
+    if (!is_stacked())
+        materialize();
+
     return stack_;
 }
 
@@ -320,6 +598,58 @@ const chain::annex& witness::annex() const NOEXCEPT
     return annex_;
 }
 
+// private
+bool witness::is_contiguous() const NOEXCEPT
+{
+    return !offsets_.empty();
+}
+
+size_t witness::stack_size() const NOEXCEPT
+{
+    return is_contiguous() ? sub1(offsets_.size()) : stack_.size();
+}
+
+data_slice witness::element(size_t index) const NOEXCEPT
+{
+    BC_ASSERT(index < stack_size());
+    if (!is_contiguous())
+        return *stack_[index];
+
+    return
+    {
+        std::next(bytes_.data(), offsets_[index]),
+        std::next(bytes_.data(), offsets_[add1(index)])
+    };
+}
+
+// private
+// annex::is_annex_pattern over element accessors.
+bool witness::is_annexed() const NOEXCEPT
+{
+    // If at least two elements, discard annex if present.
+    const auto count = stack_size();
+    if (count <= one)
+        return false;
+
+    // If first byte of stack top is 0x50 it is the annex [bip341].
+    const auto top = element(sub1(count));
+    return !top.empty() && (top.front() == taproot_annex_prefix);
+}
+
+bool witness::is_push_size() const NOEXCEPT
+{
+    for (size_t index = 0; index < stack_size(); ++index)
+        if (element(index).size() > max_push_data_size)
+            return false;
+
+    return true;
+}
+
+bool witness::is_reserved_pattern() const NOEXCEPT
+{
+    return is_one(stack_size()) && element(0).size() == hash_size;
+}
+
 // static
 size_t witness::serialized_size(const chunk_cptrs& stack, bool prefix) NOEXCEPT
 {
@@ -337,7 +667,7 @@ size_t witness::serialized_size(bool prefix) const NOEXCEPT
     // Witness prefix is an element count, not byte length (unlike script).
     // An empty stack is not a valid witnessed tx (no inputs) but a consistent
     // serialization is used independently by database so zero stack allowed.
-    return prefix ? ceilinged_add(variable_size(stack_.size()), size_) : size_;
+    return prefix ? ceilinged_add(variable_size(stack_size()), size_) : size_;
 }
 
 BC_POP_WARNING()
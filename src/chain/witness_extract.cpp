@@ -30,6 +30,7 @@
  */
 #include <bitcoin/system/chain/witness.hpp>
 
+#include <bitcoin/system/chain/annex.hpp>
 #include <bitcoin/system/chain/enums/script_version.hpp>
 #include <bitcoin/system/chain/enums/opcode.hpp>
 #include <bitcoin/system/chain/operation.hpp>
@@ -41,6 +42,7 @@
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/error/error.hpp>
 #include <bitcoin/system/hash/hash.hpp>
+#include <bitcoin/system/stream/stream.hpp>
 
 namespace libbitcoin {
 namespace system {
@@ -91,8 +93,11 @@ bool witness::extract_sigop_script(script& out_script,
 
                 // p2wsh sigops are counted as before for p2sh [bip141].
                 case hash_size:
-                    if (!stack_.empty())
-                        out_script = { *stack_.back(), false };
+                    if (!is_zero(stack_size()))
+                    {
+                        stream::in::fast stream{ element(sub1(stack_size())) };
+                        out_script = { stream, false };
+                    }
 
                     return true;
 
@@ -127,9 +132,7 @@ code witness::extract_segwit(script::cptr& out_script,
 {
     BC_ASSERT(program_script.version() == script_version::segwit);
     const auto& program = program_script.witness_program();
-
-    // Copy stack of shared const pointers for mutable witness stack.
-    out_stack = std::make_shared<chunk_cptrs>(stack_);
+    const auto count = stack_size();
 
     switch (program->size())
     {
@@ -145,8 +148,11 @@ code witness::extract_segwit(script::cptr& out_script,
                 script::to_pay_key_hash_pattern(program));
 
             // Stack must be 2 elements.
-            return out_stack->size() == two ?
-                error::script_success : error::invalid_witness;
+            if (count != two)
+                return error::invalid_witness;
+
+            out_stack = to_stack(count);
+            return error::script_success;
         }
 
         // p2wsh
@@ -156,16 +162,20 @@ code witness::extract_segwit(script::cptr& out_script,
         case hash_size:
         {
             // The stack must consist of at least 1 element.
-            if (out_stack->empty())
+            if (is_zero(count))
                 return error::invalid_witness;
 
-            // Input script is popped from the stack.
-            out_script = to_shared<script>(*pop(*out_stack), false);
+            // Input script is popped from the stack (not copied to it).
+            stream::in::fast stream{ element(sub1(count)) };
+            out_script = to_shared<script>(stream, false);
 
             // Popped script sha256 hash must match program.
-            return unsafe_array_cast<uint8_t, hash_size>(program->data()) ==
-                out_script->hash() ? error::script_success :
-                error::invalid_witness;
+            if (unsafe_array_cast<uint8_t, hash_size>(program->data()) !=
+                out_script->hash())
+                return error::invalid_witness;
+
+            out_stack = to_stack(sub1(count));
+            return error::script_success;
         }
 
         // If the version byte is 0, but the witness program is neither
@@ -175,32 +185,41 @@ code witness::extract_segwit(script::cptr& out_script,
     }
 }
 
-// All [bip341] comments.
 // Extract script, initial execution stack, and optional tapleaf hash.
 code witness::extract_taproot(hash_cptr& out_leaf, script::cptr& out_script,
     chunk_cptrs_ptr& out_stack, const script& program_script) const NOEXCEPT
+{
+    return extract_taproot(out_leaf, out_script, out_stack, program_script,
+        false);
+}
+
+// All [bip341] comments.
+// Commitment verification is skipped only if preverified by the caller.
+code witness::extract_taproot(hash_cptr& out_leaf, script::cptr& out_script,
+    chunk_cptrs_ptr& out_stack, const script& program_script,
+    bool committed) const NOEXCEPT
 {
     BC_ASSERT(program_script.version() == script_version::taproot);
     const auto& program = program_script.witness_program();
 
-    // Copy stack of shared const pointers for mutable witness stack.
-    out_stack = std::make_shared<chunk_cptrs>(stack_);
-
     // witness stack : [annex]...
     if (program->size() == ec_xonly_size)
     {
-        auto stack_size = out_stack->size();
+        auto count = stack_size();
 
         // If at least two elements, discard annex if present.
-        if (taproot::drop_annex(*out_stack))
-            --stack_size;
+        if (is_annexed())
+            --count;
 
         // p2ts (tapscript, script path spend)
         // witness stack : <control> <script> [stack-elements]
         // input script  : (empty)
         // output script : <1> <32-byte-tweaked-public-key>
-        if (stack_size > one)
+        if (count > one)
         {
+            // The annex is not copied to the stack.
+            out_stack = to_stack(count);
+
             // The last stack element is the control block.
             const auto control = tapscript{ pop(*out_stack) };
             if (!control.is_valid())
@@ -216,11 +235,12 @@ code witness::extract_taproot(hash_cptr& out_leaf, script::cptr& out_script,
                 out_leaf = to_shared(taproot::leaf_hash(control.version(),
                     *out_script));
 
-                // Execute tapleaf script.
+                // Execute tapleaf script (commitment may be preverified).
                 // out stack  : [stack-elements]
                 // out script : (popped-from-stack)
-                return taproot::verify_commit(control, key, *out_leaf) ?
-                    error::script_success : error::invalid_commitment;
+                return committed || taproot::verify_commit(control, key,
+                    *out_leaf) ? error::script_success :
+                    error::invalid_commitment;
             }
 
             // Others remain unencumbered (success).
@@ -235,12 +255,13 @@ code witness::extract_taproot(hash_cptr& out_leaf, script::cptr& out_script,
         // witness stack : <signature>
         // input script  : (empty)
         // output script : <1> <32-byte-tweaked-public-key>
-        if (is_one(stack_size))
+        if (is_one(count))
         {
             // Stack element is a signature that must be valid for q.
             // Program is q, a 32 byte bip340 public key, so push it.
             // out stack  : (empty)
             // out script : <op_checksig>
+            out_stack = to_stack(count);
             out_stack->push_back(program);
             out_script = checksig_script_ptr();
             return error::script_success;
@@ -264,10 +285,39 @@ code witness::extract_taproot(hash_cptr& out_leaf, script::cptr& out_script,
     // out stack  : (empty)
     // out script : <op_success>
     out_script = success_script_ptr();
-    out_stack->clear();
+    out_stack = std::make_shared<chunk_cptrs>();
     return error::script_success;
 }
 
+// Script path commitment of extract_taproot, without creating the stack.
+bool witness::is_committed(const script& program_script) const NOEXCEPT
+{
+    const auto& program = program_script.witness_program();
+    if (program_script.version() != script_version::taproot ||
+        !program || program->size() != ec_xonly_size)
+        return false;
+
+    auto count = stack_size();
+    if (is_annexed())
+        --count;
+
+    if (count <= one)
+        return false;
+
+    // Only the control block is copied (tapscript requires shared data).
+    const auto control = tapscript{ to_shared(
+        element(sub1(count)).to_chunk()) };
+    if (!control.is_valid() || !control.is_tapscript())
+        return false;
+
+    const auto& key = unsafe_array_cast<uint8_t, ec_xonly_size>(
+        program->data());
+    stream::in::fast stream{ element(sub1(sub1(count))) };
+    const script tapleaf{ stream, false };
+    return taproot::verify_commit(control, key,
+        taproot::leaf_hash(control.version(), tapleaf));
+}
+
 BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
 
 } // namespace chain
@@ -30,6 +30,8 @@
  */
 #include <bitcoin/system/config/block.hpp>
 
+#include <algorithm>
+#include <iterator>
 #include <sstream>
 #include <utility>
 #include <bitcoin/system/chain/block.hpp>
@@ -87,7 +89,20 @@ std::istream& operator>>(std::istream& stream, block& argument) THROWS
 
 std::ostream& operator<<(std::ostream& stream, const block& argument) NOEXCEPT
 {
-    stream << encode_base16(argument.to_data(true));
+    // Encode in pages directly to the stream, avoiding a full text copy.
+    constexpr size_t page = 4096;
+    std_array<char, page * octet_width> buffer{};
+    const auto data = argument.to_data(true);
+
+    for (size_t offset{}; offset < data.size(); offset += page)
+    {
+        const auto size = std::min(page, data.size() - offset);
+        const auto begin = std::next(data.data(), offset);
+        encode_base16(buffer, { begin, std::next(begin, size) });
+        stream.write(buffer.data(),
+            possible_narrow_sign_cast<std::streamsize>(size * octet_width));
+    }
+
     return stream;
 }
 
@@ -31,8 +31,13 @@
  */
 #include <bitcoin/system/crypto/aes256.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <iterator>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/endian/endian.hpp>
+#include <bitcoin/system/intrinsics/intrinsics.hpp>
 #include <bitcoin/system/math/math.hpp>
 
 namespace libbitcoin {
@@ -402,23 +407,357 @@ constexpr void decrypt_block(aes256::context& context, block& bytes) NOEXCEPT
 ////    context.deckey.fill(0);
 ////}
 
-// published
+// native
 // ----------------------------------------------------------------------------
+// Round keys are expanded once and blocks are processed in lanes, interleaving
+// independent rounds to hide instruction latency. There are no table lookups.
 
-void encrypt(block& bytes, const secret& key) NOEXCEPT
+constexpr size_t lanes = 4;
+
+// AES-NI is compiled on x86 regardless of build flags and selected by cpuid.
+// Only the target region is compiled for aes, as all includes precede it.
+// vc++: intrinsics are not flag gated, so no region is required.
+#if defined(HAVE_XCPU)
+    #define HAVE_AESNI_TARGET
+#endif
+
+#if defined(HAVE_AESNI_TARGET)
+
+#if defined(__clang__)
+    #pragma clang attribute push(__attribute__((target("aes"))), \
+        apply_to = function)
+#elif defined(__GNUC__)
+    #pragma GCC push_options
+    #pragma GCC target("aes")
+#endif
+
+namespace native {
+
+typedef std_array<__m128i, add1(rounds)> schedule;
+
+INLINE __m128i load(const uint8_t* data) NOEXCEPT
+{
+    return _mm_loadu_si128(pointer_cast<const __m128i>(data));
+}
+
+INLINE void store(uint8_t* data, __m128i value) NOEXCEPT
+{
+    _mm_storeu_si128(pointer_cast<__m128i>(data), value);
+}
+
+// Prefix xor of the four words of a round key.
+INLINE __m128i accumulate(__m128i key) NOEXCEPT
+{
+    key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+    return _mm_xor_si128(key, _mm_slli_si128(key, 8));
+}
+
+// RotWord/SubWord/Rcon of the last word of the odd key.
+template <int Rcon>
+INLINE __m128i expand_even(__m128i even, __m128i odd) NOEXCEPT
+{
+    const auto assist = _mm_aeskeygenassist_si128(odd, Rcon);
+    return _mm_xor_si128(accumulate(even), _mm_shuffle_epi32(assist, 0xff));
+}
+
+// SubWord of the last word of the even key.
+INLINE __m128i expand_odd(__m128i odd, __m128i even) NOEXCEPT
+{
+    const auto assist = _mm_aeskeygenassist_si128(even, 0x00);
+    return _mm_xor_si128(accumulate(odd), _mm_shuffle_epi32(assist, 0xaa));
+}
+
+BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+
+INLINE void expand(schedule& keys, const secret& key) NOEXCEPT
+{
+    keys[0] = load(key.data());
+    keys[1] = load(std::next(key.data(), block_size));
+    keys[2] = expand_even<0x01>(keys[0], keys[1]);
+    keys[3] = expand_odd(keys[1], keys[2]);
+    keys[4] = expand_even<0x02>(keys[2], keys[3]);
+    keys[5] = expand_odd(keys[3], keys[4]);
+    keys[6] = expand_even<0x04>(keys[4], keys[5]);
+    keys[7] = expand_odd(keys[5], keys[6]);
+    keys[8] = expand_even<0x08>(keys[6], keys[7]);
+    keys[9] = expand_odd(keys[7], keys[8]);
+    keys[10] = expand_even<0x10>(keys[8], keys[9]);
+    keys[11] = expand_odd(keys[9], keys[10]);
+    keys[12] = expand_even<0x20>(keys[10], keys[11]);
+    keys[13] = expand_odd(keys[11], keys[12]);
+    keys[14] = expand_even<0x40>(keys[12], keys[13]);
+}
+
+BC_POP_WARNING()
+
+BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+BC_PUSH_WARNING(NO_DYNAMIC_ARRAY_INDEXING)
+
+// Equivalent inverse cipher keys (reversed, inner keys inverse mixed).
+// Reversed in place, as std::reverse is not compiled for the region (x32).
+INLINE void invert(schedule& keys) NOEXCEPT
+{
+    for (size_t low = 0, high = rounds; low < high; ++low, --high)
+    {
+        const auto key = keys[low];
+        keys[low] = keys[high];
+        keys[high] = key;
+    }
+
+    for (size_t round = 1; round < rounds; ++round)
+        keys[round] = _mm_aesimc_si128(keys[round]);
+}
+
+BC_POP_WARNING()
+BC_POP_WARNING()
+
+template <bool Encrypt, size_t Lanes>
+INLINE void transform(uint8_t* data, const schedule& keys) NOEXCEPT
+{
+    std_array<__m128i, Lanes> state{};
+    for (size_t lane = 0; lane < Lanes; ++lane)
+        state[lane] = _mm_xor_si128(load(std::next(data,
+            lane * block_size)), keys.front());
+
+    for (size_t round = 1; round < rounds; ++round)
+        for (size_t lane = 0; lane < Lanes; ++lane)
+            state[lane] = Encrypt ?
+                _mm_aesenc_si128(state[lane], keys[round]) :
+                _mm_aesdec_si128(state[lane], keys[round]);
+
+    for (size_t lane = 0; lane < Lanes; ++lane)
+        store(std::next(data, lane * block_size), Encrypt ?
+            _mm_aesenclast_si128(state[lane], keys.back()) :
+            _mm_aesdeclast_si128(state[lane], keys.back()));
+}
+
+} // namespace native
+
+#elif defined(HAVE_ARM) && defined(HAVE_CRYPTO)
+
+namespace native {
+
+typedef std_array<uint8x16_t, add1(rounds)> schedule;
+constexpr size_t key_words = secret_size / sizeof(uint32_t);
+constexpr size_t round_words = block_size / sizeof(uint32_t);
+constexpr size_t schedule_words = add1(rounds) * round_words;
+constexpr std_array<uint8_t, 7> rcon
+{
+    0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40
+};
+
+INLINE uint8x16_t load(const uint8_t* data) NOEXCEPT
+{
+    return vld1q_u8(data);
+}
+
+INLINE void store(uint8_t* data, uint8x16_t value) NOEXCEPT
+{
+    vst1q_u8(data, value);
+}
+
+// ShiftRows is moot as all columns are identical and the round key is zero.
+INLINE uint32_t sub_word(uint32_t word) NOEXCEPT
+{
+    const auto state = vreinterpretq_u8_u32(vdupq_n_u32(word));
+    return vgetq_lane_u32(vreinterpretq_u32_u8(vaeseq_u8(state,
+        vdupq_n_u8(0))), 0);
+}
+
+BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+BC_PUSH_WARNING(NO_DYNAMIC_ARRAY_INDEXING)
+
+INLINE void expand(schedule& keys, const secret& key) NOEXCEPT
+{
+    std_array<uint32_t, schedule_words> words{};
+    const auto initial = from_little_endians(array_cast<uint32_t>(key));
+    std::copy(initial.begin(), initial.end(), words.begin());
+
+    for (auto word = key_words; word < schedule_words; ++word)
+    {
+        auto temp = words[sub1(word)];
+        if (is_zero(word % key_words))
+            temp = sub_word(rotr(temp, byte_bits)) ^
+                rcon[sub1(word / key_words)];
+        else if (word % key_words == round_words)
+            temp = sub_word(temp);
+
+        words[word] = words[word - key_words] ^ temp;
+    }
+
+    const auto little = to_little_endians(words);
+    const auto& bytes = array_cast<uint8_t>(little);
+    for (size_t round = 0; round < keys.size(); ++round)
+        keys[round] = load(std::next(bytes.data(), round * block_size));
+}
+
+BC_POP_WARNING()
+BC_POP_WARNING()
+
+// Equivalent inverse cipher keys (reversed, inner keys inverse mixed).
+INLINE void invert(schedule& keys) NOEXCEPT
+{
+    std::reverse(keys.begin(), keys.end());
+    for (auto key = std::next(keys.begin()); key != std::prev(keys.end());
+        ++key)
+        *key = vaesimcq_u8(*key);
+}
+
+// ARMv8 rounds xor the key before (not after) sub/shift, so the final key is
+// applied by xor, and mix columns is a distinct instruction.
+template <bool Encrypt, size_t Lanes>
+INLINE void transform(uint8_t* data, const schedule& keys) NOEXCEPT
+{
+    std_array<uint8x16_t, Lanes> state{};
+    for (size_t lane = 0; lane < Lanes; ++lane)
+        state[lane] = load(std::next(data, lane * block_size));
+
+    for (size_t round = 0; round < sub1(rounds); ++round)
+        for (size_t lane = 0; lane < Lanes; ++lane)
+            state[lane] = Encrypt ?
+                vaesmcq_u8(vaeseq_u8(state[lane], keys[round])) :
+                vaesimcq_u8(vaesdq_u8(state[lane], keys[round]));
+
+    for (size_t lane = 0; lane < Lanes; ++lane)
+        store(std::next(data, lane * block_size), veorq_u8(Encrypt ?
+            vaeseq_u8(state[lane], keys[sub1(rounds)]) :
+            vaesdq_u8(state[lane], keys[sub1(rounds)]), keys.back()));
+}
+
+} // namespace native
+
+#endif // HAVE_AESNI_TARGET
+
+#if defined(HAVE_AESNI_TARGET) || (defined(HAVE_ARM) && defined(HAVE_CRYPTO))
+
+template <bool Encrypt>
+static void native_ecb(const data_slab& bytes, const secret& key) NOEXCEPT
+{
+    native::schedule keys{};
+    native::expand(keys, key);
+    if constexpr (!Encrypt)
+        native::invert(keys);
+
+    auto data = bytes.data();
+    auto count = bytes.size() / block_size;
+
+    for (; count >= lanes; count -= lanes)
+    {
+        native::transform<Encrypt, lanes>(data, keys);
+        std::advance(data, lanes * block_size);
+    }
+
+    for (; !is_zero(count); --count)
+    {
+        native::transform<Encrypt, one>(data, keys);
+        std::advance(data, block_size);
+    }
+}
+
+#else
+
+template <bool Encrypt>
+static void native_ecb(const data_slab&, const secret&) NOEXCEPT
+{
+}
+
+#endif // HAVE_AESNI_TARGET || (HAVE_ARM && HAVE_CRYPTO)
+
+#if defined(HAVE_AESNI_TARGET)
+    #if defined(__clang__)
+        #pragma clang attribute pop
+    #elif defined(__GNUC__)
+        #pragma GCC pop_options
+    #endif
+#endif
+
+// software
+// ----------------------------------------------------------------------------
+
+template <bool Encrypt>
+static void software_ecb(const data_slab& bytes, const secret& key) NOEXCEPT
 {
     aes256::context context;
     initialize(context, key);
-    encrypt_block(context, bytes);
-    ////zeroize(context);
+
+    auto data = bytes.data();
+    for (auto count = bytes.size() / block_size; !is_zero(count); --count)
+    {
+        auto& bytes = unsafe_array_cast<uint8_t, block_size>(data);
+        if constexpr (Encrypt)
+            encrypt_block(context, bytes);
+        else
+            decrypt_block(context, bytes);
+
+        std::advance(data, block_size);
+    }
+}
+
+template <bool Encrypt>
+static bool ecb(const data_slab& bytes, const secret& key) NOEXCEPT
+{
+    if (!is_zero(bytes.size() % block_size))
+        return false;
+
+    if (have_native())
+        native_ecb<Encrypt>(bytes, key);
+    else
+        software_ecb<Encrypt>(bytes, key);
+
+    return true;
+}
+
+// published
+// ----------------------------------------------------------------------------
+
+// There is no arm runtime detection (see cpuid.hpp), so compiled is assumed.
+static bool detect() NOEXCEPT
+{
+#if defined(HAVE_AESNI_TARGET)
+    return try_aesni();
+#elif defined(HAVE_ARM) && defined(HAVE_CRYPTO)
+    return true;
+#else
+    return false;
+#endif
+}
+
+static std::atomic_bool& selection() NOEXCEPT
+{
+    static std::atomic_bool enabled{ true };
+    return enabled;
+}
+
+bool have_native() NOEXCEPT
+{
+    static const auto detected = detect();
+    return detected && selection().load(std::memory_order_relaxed);
+}
+
+bool select_native(bool enable) NOEXCEPT
+{
+    selection().store(enable, std::memory_order_relaxed);
+    return have_native();
+}
+
+void encrypt(block& bytes, const secret& key) NOEXCEPT
+{
+    ecb<true>(bytes, key);
 }
 
 void decrypt(block& bytes, const secret& key) NOEXCEPT
 {
-    aes256::context context;
-    initialize(context, key);
-    decrypt_block(context, bytes);
-    ////zeroize(context);
+    ecb<false>(bytes, key);
+}
+
+bool encrypt_ecb(const data_slab& bytes, const secret& key) NOEXCEPT
+{
+    return ecb<true>(bytes, key);
+}
+
+bool decrypt_ecb(const data_slab& bytes, const secret& key) NOEXCEPT
+{
+    return ecb<false>(bytes, key);
 }
 
 } // namespace aes256
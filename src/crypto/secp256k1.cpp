@@ -241,6 +241,29 @@ bool ec_sum(ec_compressed& out, const compressed_list& points) NOEXCEPT
         serialize(context, out, pubkey);
 }
 
+// parse once, (add, serialize) per scalar
+bool ec_add(compressed_list& out, const ec_compressed& point,
+    const secret_list& scalars) NOEXCEPT
+{
+    out.resize(scalars.size());
+    const auto context = ec_context_verify::context();
+
+    secp256k1_pubkey parent;
+    if (!parse(context, parent, point))
+        return false;
+
+    auto sum = out.begin();
+    for (const auto& scalar: scalars)
+    {
+        auto pubkey = parent;
+        if (secp256k1_ec_pubkey_tweak_add(context, &pubkey, scalar.data()) !=
+            ec_success || !serialize(context, *sum++, pubkey))
+            return false;
+    }
+
+    return true;
+}
+
 // Multiply EC values
 // ----------------------------------------------------------------------------
 
@@ -315,6 +338,42 @@ bool secret_to_public(ec_uncompressed& out, const ec_secret& secret) NOEXCEPT
     return secret_to_public(context, out, secret);
 }
 
+// create, serialize per secret (concurrent)
+bool secret_to_public(compressed_list& out,
+    const secret_list& secrets) NOEXCEPT
+{
+    out.resize(secrets.size());
+    const auto context = ec_context_sign::context();
+
+    // The signing context (generator table) is read-only and shared.
+    std::transform(poolstl::execution::par, secrets.begin(), secrets.end(),
+        out.begin(), [context](const ec_secret& secret) NOEXCEPT
+        {
+            ec_compressed point{};
+            return secret_to_public(context, point, secret) ? point :
+                null_ec_compressed;
+        });
+
+    // A valid point is never null (invalid sign byte).
+    return std::find(out.begin(), out.end(), null_ec_compressed) == out.end();
+}
+
+bool secret_to_public(compressed_list& out, std_vector<short_hash>& hashes,
+    const secret_list& secrets) NOEXCEPT
+{
+    if (!secret_to_public(out, secrets))
+        return false;
+
+    hashes.resize(out.size());
+    std::transform(poolstl::execution::par, out.begin(), out.end(),
+        hashes.begin(), [](const ec_compressed& point) NOEXCEPT
+        {
+            return bitcoin_short_hash(point);
+        });
+
+    return true;
+}
+
 // Verify keys
 // ----------------------------------------------------------------------------
 
@@ -549,6 +608,29 @@ bool verify_commitment(const ec_xonly& internal_key, const hash_digest& tweak,
             parity, &pubkey, tweak.data()) == ec_success;
 }
 
+// BIP341: Q = P + int(t)G, returns x(Q) and y(Q) mod 2.
+bool create_commitment(ec_xonly& tweaked_key, bool& tweaked_key_parity,
+    const ec_xonly& internal_key, const hash_digest& tweak) NOEXCEPT
+{
+    int parity{};
+    secp256k1_pubkey point;
+    secp256k1_xonly_pubkey pubkey;
+    const auto context = ec_context_verify::context();
+
+    if (secp256k1_xonly_pubkey_parse(context, &pubkey, internal_key.data()) !=
+            ec_success ||
+        secp256k1_xonly_pubkey_tweak_add(context, &point, &pubkey,
+            tweak.data()) != ec_success ||
+        secp256k1_xonly_pubkey_from_pubkey(context, &pubkey, &parity,
+            &point) != ec_success ||
+        secp256k1_xonly_pubkey_serialize(context, tweaked_key.data(),
+            &pubkey) != ec_success)
+        return false;
+
+    tweaked_key_parity = to_bool(parity);
+    return true;
+}
+
 } // namespace schnorr
 } // namespace system
 } // namespace libbitcoin
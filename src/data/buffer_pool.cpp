@@ -0,0 +1,189 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/data/buffer_pool.hpp>
+
+#include <algorithm>
+#include <utility>
+#include <bitcoin/system/data/data_chunk.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+BC_PUSH_WARNING(NO_DYNAMIC_ARRAY_INDEXING)
+
+// buffer
+// ----------------------------------------------------------------------------
+
+buffer_pool::buffer::buffer(data_chunk&& chunk) NOEXCEPT
+  : chunk_(std::move(chunk))
+{
+}
+
+buffer_pool::buffer::buffer(buffer&& other) NOEXCEPT
+  : chunk_(std::move(other.chunk_))
+{
+    other.chunk_ = {};
+}
+
+buffer_pool::buffer& buffer_pool::buffer::operator=(buffer&& other) NOEXCEPT
+{
+    if (this != &other)
+    {
+        local().release(std::move(chunk_));
+        chunk_ = std::move(other.chunk_);
+        other.chunk_ = {};
+    }
+
+    return *this;
+}
+
+buffer_pool::buffer::~buffer() NOEXCEPT
+{
+    local().release(std::move(chunk_));
+}
+
+data_chunk& buffer_pool::buffer::operator*() NOEXCEPT
+{
+    return chunk_;
+}
+
+data_chunk* buffer_pool::buffer::operator->() NOEXCEPT
+{
+    return &chunk_;
+}
+
+// pool
+// ----------------------------------------------------------------------------
+
+// static
+buffer_pool& buffer_pool::local() NOEXCEPT
+{
+    thread_local buffer_pool pool{};
+    return pool;
+}
+
+buffer_pool::buffer_pool() NOEXCEPT
+  : free_{}
+{
+    for (auto& bucket: free_)
+        bucket.reserve(class_depth);
+}
+
+buffer_pool::buffer buffer_pool::get(size_t size) NOEXCEPT
+{
+    return { acquire(size) };
+}
+
+data_chunk buffer_pool::acquire(size_t size) NOEXCEPT
+{
+    data_chunk chunk{};
+    if (size > maximum_size)
+    {
+        ++misses_;
+        chunk.reserve(size);
+        return chunk;
+    }
+
+    // Round up to the class that guarantees capacity.
+    const auto log = add1(floored_log2(sub1(std::max(size, minimum_size))));
+    auto& bucket = free_[log - minimum_class];
+    if (bucket.empty())
+    {
+        ++misses_;
+        chunk.reserve(power2(log));
+        return chunk;
+    }
+
+    ++hits_;
+    chunk = std::move(bucket.back());
+    bucket.pop_back();
+    --retained_;
+    retained_bytes_ -= chunk.capacity();
+    return chunk;
+}
+
+void buffer_pool::release(data_chunk&& chunk) NOEXCEPT
+{
+    // Round down to the class that the capacity guarantees.
+    const auto capacity = chunk.capacity();
+    if (capacity < minimum_size || capacity > maximum_size ||
+        retained_bytes_ + capacity > maximum_retained ||
+        chunk.get_allocator() != data_chunk::allocator_type{})
+        return;
+
+    auto& bucket = free_[floored_log2(capacity) - minimum_class];
+    if (bucket.size() >= class_depth)
+        return;
+
+    chunk.clear();
+    bucket.push_back(std::move(chunk));
+    ++retained_;
+    retained_bytes_ += capacity;
+}
+
+void buffer_pool::release(data_stack&& chunks) NOEXCEPT
+{
+    for (auto& chunk: chunks)
+        release(std::move(chunk));
+
+    chunks.clear();
+}
+
+void buffer_pool::clear() NOEXCEPT
+{
+    for (auto& bucket: free_)
+        bucket.clear();
+
+    hits_ = zero;
+    misses_ = zero;
+    retained_ = zero;
+    retained_bytes_ = zero;
+}
+
+// properties
+// ----------------------------------------------------------------------------
+
+size_t buffer_pool::hits() const NOEXCEPT
+{
+    return hits_;
+}
+
+size_t buffer_pool::misses() const NOEXCEPT
+{
+    return misses_;
+}
+
+size_t buffer_pool::retained() const NOEXCEPT
+{
+    return retained_;
+}
+
+size_t buffer_pool::retained_bytes() const NOEXCEPT
+{
+    return retained_bytes_;
+}
+
+BC_POP_WARNING()
+BC_POP_WARNING()
+
+} // namespace system
+} // namespace libbitcoin
@@ -51,15 +51,16 @@ namespace system {
 void golomb::construct(bitwriter& writer, const data_stack& items, uint8_t bits,
     const siphash_key& entropy, uint64_t target_false_positive_rate) NOEXCEPT
 {
-    const auto set = hashed_set_construct(items, items.size(),
-        target_false_positive_rate, entropy);
+    encode_set(writer, hashed_set_construct(items, items.size(),
+        target_false_positive_rate, entropy), bits);
+}
 
-    uint64_t previous = 0;
-    for (const auto value: set)
-    {
-        encode(writer, value - previous, bits);
-        previous = value;
-    };
+void golomb::construct(bitwriter& writer, const std_vector<data_slice>& items,
+    uint8_t bits, const siphash_key& entropy,
+    uint64_t target_false_positive_rate) NOEXCEPT
+{
+    encode_set(writer, hashed_set_construct(items, items.size(),
+        target_false_positive_rate, entropy), bits);
 }
 
 data_chunk golomb::construct(const data_stack& items, uint8_t bits,
@@ -212,7 +213,19 @@ uint64_t golomb::hash_to_range(const data_slice& item, uint64_t bound,
     return (product >> shift).convert_to<uint64_t>();
 }
 
-std::vector<uint64_t> golomb::hashed_set_construct(const data_stack& items,
+void golomb::encode_set(bitwriter& writer, const std::vector<uint64_t>& set,
+    uint8_t bits) NOEXCEPT
+{
+    uint64_t previous = 0;
+    for (const auto value: set)
+    {
+        encode(writer, value - previous, bits);
+        previous = value;
+    };
+}
+
+template <typename Items>
+std::vector<uint64_t> golomb::hashed_set_construct(const Items& items,
     uint64_t set_size, uint64_t target_false_positive_rate,
     const siphash_key& key) NOEXCEPT
 {
@@ -222,7 +235,7 @@ std::vector<uint64_t> golomb::hashed_set_construct(const data_stack& items,
     std::vector<uint64_t> hashes(items.size());
     const auto bound = target_false_positive_rate * set_size;
     std::transform(items.begin(), items.end(), hashes.begin(),
-        [&](const data_chunk& item) NOEXCEPT
+        [&](const auto& item) NOEXCEPT
         {
             return hash_to_range(item, bound, key);
         });
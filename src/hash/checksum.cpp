@@ -30,10 +30,13 @@
  */
 #include <bitcoin/system/hash/checksum.hpp>
 
+#include <algorithm>
+#include <string_view>
 #include <utility>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/endian/endian.hpp>
+#include <bitcoin/system/math/math.hpp>
 #include <bitcoin/system/radix/radix.hpp>
 #include <bitcoin/system/unicode/ascii.hpp>
 
@@ -112,21 +115,35 @@ static base32_chunk bech32_expand_checksum(uint32_t checksum) NOEXCEPT
     return out;
 }
 
+// Generator combinations, indexed by the five coefficient bits.
+static constexpr auto bech32_generators = []() NOEXCEPT
+{
+    constexpr std_array<uint32_t, 5> generator
+    {
+        0x3b6a57b2, 0x26508e6d, 0x1ea119fa, 0x3d4233dd, 0x2a1462b3
+    };
+
+    std_array<uint32_t, 32> table{};
+    for (size_t coefficient = 0; coefficient < table.size(); ++coefficient)
+        for (size_t bit = 0; bit < generator.size(); ++bit)
+            if (get_right(coefficient, bit))
+                table[coefficient] ^= generator[bit];
+
+    return table;
+}();
+
+constexpr uint32_t bech32_polymod(uint32_t checksum, uint8_t value) NOEXCEPT
+{
+    return ((checksum & 0x01ffffff) << 5) ^ value ^
+        bech32_generators[checksum >> 25];
+}
+
 static uint32_t bech32_checksum(const base32_chunk& data) NOEXCEPT
 {
     uint32_t checksum = 1;
 
     for (const auto& value: data)
-    {
-        const uint32_t coeficient = (checksum >> 25);
-        checksum = ((checksum & 0x01ffffff) << 5) ^ value.convert_to<uint8_t>();
-
-        if (coeficient & 0x01) checksum ^= 0x3b6a57b2;
-        if (coeficient & 0x02) checksum ^= 0x26508e6d;
-        if (coeficient & 0x04) checksum ^= 0x1ea119fa;
-        if (coeficient & 0x08) checksum ^= 0x3d4233dd;
-        if (coeficient & 0x10) checksum ^= 0x2a1462b3;
-    }
+        checksum = bech32_polymod(checksum, value.convert_to<uint8_t>());
 
     return checksum;
 }
@@ -195,5 +212,160 @@ bool bech32_verify_checked(uint8_t& out_version, data_chunk& out_program,
     return bech32_verify_checksum(checked, prefix, out_version);
 }
 
+// bech32 codec
+// ----------------------------------------------------------------------------
+
+constexpr char bech32_separator = '1';
+
+constexpr char bech32_lower(char character) NOEXCEPT
+{
+    return 'A' <= character && character <= 'Z' ?
+        static_cast<char>(character + ('a' - 'A')) : character;
+}
+
+// The checksum state following the expanded prefix (see bech32_expand_prefix).
+static uint32_t bech32_prefix_checksum(const std::string_view& prefix) NOEXCEPT
+{
+    uint32_t checksum = 1;
+
+    for (const auto character: prefix)
+        checksum = bech32_polymod(checksum,
+            static_cast<uint8_t>((bech32_lower(character) >> 5) & 0x1f));
+
+    checksum = bech32_polymod(checksum, 0x00);
+
+    for (const auto character: prefix)
+        checksum = bech32_polymod(checksum,
+            static_cast<uint8_t>(bech32_lower(character) & 0x1f));
+
+    return checksum;
+}
+
+static size_t bech32_encode(bech32_chars& out, uint32_t checksum,
+    uint8_t version, const data_slice& program,
+    const std::string_view& prefix) NOEXCEPT
+{
+    // Version expansion would truncate a value above 5 bits.
+    if (version >= (1 << 5))
+        return zero;
+
+    const auto values = ceilinged_divide(program.size() * byte_bits, 5u);
+    const auto size = prefix.size() + one + bech32_version_size + values +
+        bech32_checksum_size;
+
+    if (size > bech32_maximum_length)
+        return zero;
+
+    auto it = std::copy(prefix.begin(), prefix.end(), out.begin());
+    *it++ = bech32_separator;
+
+    const auto put = [&](uint8_t value) NOEXCEPT
+    {
+        checksum = bech32_polymod(checksum, value);
+        *it++ = base32_character(value);
+    };
+
+    put(version);
+
+    // Unpack as base32_unpack, with final value zero padded.
+    uint32_t accumulator{};
+    size_t bits{};
+    for (const auto byte: program)
+    {
+        accumulator = ((accumulator << byte_bits) | byte) & 0x0fff;
+        for (bits += byte_bits; bits >= 5u;)
+            put(narrow_cast<uint8_t>((accumulator >> (bits -= 5u)) & 0x1f));
+    }
+
+    if (!is_zero(bits))
+        put(narrow_cast<uint8_t>((accumulator << (5u - bits)) & 0x1f));
+
+    for (size_t index = 0; index < bech32_checksum_size; ++index)
+        checksum = bech32_polymod(checksum, 0x00);
+
+    checksum ^= bech32_constant(version);
+    for (auto shift = 25; shift >= 0; shift -= 5)
+        *it++ = base32_character(narrow_cast<uint8_t>((checksum >> shift) &
+            0x1f));
+
+    return size;
+}
+
+size_t bech32_encode(bech32_chars& out, uint8_t version,
+    const data_slice& program, const std::string_view& prefix) NOEXCEPT
+{
+    return bech32_encode(out, bech32_prefix_checksum(prefix), version,
+        program, prefix);
+}
+
+void bech32_encode(std_vector<bech32_text>& out,
+    const std_vector<bech32_witness>& programs,
+    const std::string_view& prefix) NOEXCEPT
+{
+    out.resize(programs.size());
+    const auto checksum = bech32_prefix_checksum(prefix);
+
+    std::for_each(poolstl::execution::par, poolstl::iota_iter<size_t>(zero),
+        poolstl::iota_iter<size_t>(programs.size()), [&](size_t index) NOEXCEPT
+        {
+            const auto& witness = programs.at(index);
+            auto& text = out.at(index);
+            text.size = bech32_encode(text.chars, checksum, witness.version,
+                witness.program, prefix);
+        });
+}
+
+bool bech32_decode(uint8_t& out_version, size_t& out_size,
+    bech32_bytes& out_program, const std::string_view& prefix,
+    const std::string_view& payload) NOEXCEPT
+{
+    if (payload.size() < bech32_version_size + bech32_checksum_size ||
+        payload.size() > bech32_maximum_length - two)
+        return false;
+
+    const auto end = payload.size() - bech32_checksum_size;
+    auto checksum = bech32_prefix_checksum(prefix);
+    auto lower = false;
+    auto upper = false;
+    uint32_t accumulator{};
+    size_t bits{};
+    out_size = zero;
+
+    for (size_t index = 0; index < payload.size(); ++index)
+    {
+        const auto character = payload[index];
+        lower |= ('a' <= character && character <= 'z');
+        upper |= ('A' <= character && character <= 'Z');
+
+        const auto value = base32_value(character);
+        if (value == 0xff)
+            return false;
+
+        checksum = bech32_polymod(checksum, value);
+
+        // Pack as base32_pack, payload size bounds program size.
+        if (is_zero(index))
+        {
+            out_version = value;
+        }
+        else if (index < end)
+        {
+            accumulator = ((accumulator << 5) | value) & 0x0fff;
+            if ((bits += 5u) >= byte_bits)
+                out_program[out_size++] = narrow_cast<uint8_t>(
+                    (accumulator >> (bits -= byte_bits)) & 0xff);
+        }
+    }
+
+    if (lower && upper)
+        return false;
+
+    // A partial byte must be zero padding, otherwise the program is empty.
+    if (!is_zero(bits) && !is_zero((accumulator << (byte_bits - bits)) & 0xff))
+        out_size = zero;
+
+    return checksum == bech32_constant(out_version);
+}
+
 } // namespace system
 } // namespace libbitcoin
@@ -0,0 +1,197 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/hash/merkle_tree.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <vector>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/algorithms.hpp>
+#include <bitcoin/system/hash/functions.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+BC_PUSH_WARNING(NO_DYNAMIC_ARRAY_INDEXING)
+
+// Constructors.
+// ----------------------------------------------------------------------------
+
+merkle_tree::merkle_tree() NOEXCEPT
+{
+}
+
+merkle_tree::merkle_tree(hashes&& leaves) NOEXCEPT
+{
+    append(std::move(leaves));
+}
+
+// Properties.
+// ----------------------------------------------------------------------------
+
+size_t merkle_tree::size() const NOEXCEPT
+{
+    return levels_.empty() ? zero : levels_.front().size();
+}
+
+hash_digest merkle_tree::root() const NOEXCEPT
+{
+    if (is_zero(size()))
+        return {};
+
+    // The partial right edge is carried up, paired with the last node of an
+    // odd level, or with itself (duplicated) as the last node of an odd level.
+    hash_digest carry{};
+    auto carried = false;
+
+    for (size_t depth = 0;; ++depth)
+    {
+        const auto nodes = depth < levels_.size() ? levels_[depth].size() :
+            zero;
+
+        if (is_one(nodes + (carried ? one : zero)))
+            return carried ? carry : levels_[depth].front();
+
+        if (carried)
+        {
+            carry = is_odd(nodes) ? bitcoin_hash(levels_[depth].back(), carry) :
+                bitcoin_hash(carry, carry);
+        }
+        else if (is_odd(nodes))
+        {
+            carry = bitcoin_hash(levels_[depth].back(), levels_[depth].back());
+            carried = true;
+        }
+    }
+}
+
+// Methods.
+// ----------------------------------------------------------------------------
+
+void merkle_tree::append(const hash_digest& leaf) NOEXCEPT
+{
+    if (levels_.empty())
+        levels_.emplace_back();
+
+    levels_.front().push_back(leaf);
+
+    // Each completed pair is hashed into the next level.
+    for (size_t depth = 0; is_even(levels_[depth].size()); ++depth)
+    {
+        if (depth == sub1(levels_.size()))
+            levels_.emplace_back();
+
+        const auto& level = levels_[depth];
+        const auto& right = level.back();
+        const auto& left = level[level.size() - two];
+        levels_[add1(depth)].push_back(bitcoin_hash(left, right));
+    }
+}
+
+void merkle_tree::append(hashes&& leaves) NOEXCEPT
+{
+    if (leaves.empty())
+        return;
+
+    if (is_zero(size()))
+    {
+        levels_.clear();
+        levels_.push_back(std::move(leaves));
+    }
+    else
+    {
+        auto& level = levels_.front();
+        level.insert(level.end(), leaves.begin(), leaves.end());
+    }
+
+    for (size_t depth = 0; levels_[depth].size() > one; ++depth)
+    {
+        if (depth == sub1(levels_.size()))
+            levels_.emplace_back();
+
+        reduce(levels_[add1(depth)], levels_[depth]);
+    }
+}
+
+bool merkle_tree::replace(size_t index, const hash_digest& leaf) NOEXCEPT
+{
+    if (index >= size())
+        return false;
+
+    levels_.front()[index] = leaf;
+
+    // Only complete pairs are retained, the partial edge is hashed by root().
+    for (size_t depth = 0; bit_or(index, one) < levels_[depth].size();
+        ++depth)
+    {
+        const auto& level = levels_[depth];
+        const auto& left = level[bit_and(index, bit_not(one))];
+        const auto& right = level[bit_or(index, one)];
+        index = to_half(index);
+        levels_[add1(depth)][index] = bitcoin_hash(left, right);
+    }
+
+    return true;
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+// Hash the complete pairs of from that are not yet hashed into to.
+void merkle_tree::reduce(hashes& to, const hashes& from) NOEXCEPT
+{
+    const auto offset = to.size();
+    const auto pairs = to_half(from.size()) - offset;
+    if (is_zero(pairs))
+        return;
+
+    to.resize(offset + pairs);
+    const auto hash = [&](size_t index) NOEXCEPT
+    {
+        const auto first = index * batch;
+        const auto last = std::min(first + batch, pairs);
+        const auto begin = std::next(from.begin(), two * (offset + first));
+        const auto end = std::next(from.begin(), two * (offset + last));
+
+        // Merkle hashing is vectorized over the pairs of the batch.
+        hashes digests(begin, end);
+        sha256::merkle_hash(digests);
+        std::move(digests.begin(), digests.end(),
+            std::next(to.begin(), offset + first));
+    };
+
+    // Batches are disjoint subtrees of the level and are hashed concurrently.
+    const auto batches = ceilinged_divide(pairs, batch);
+    if (is_one(batches))
+    {
+        hash(zero);
+        return;
+    }
+
+    std::for_each(poolstl::execution::par,
+        poolstl::iota_iter<size_t>(zero), poolstl::iota_iter<size_t>(batches),
+        hash);
+}
+
+BC_POP_WARNING()
+
+} // namespace system
+} // namespace libbitcoin
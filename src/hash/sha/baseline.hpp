@@ -0,0 +1,82 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_HASH_SHA_BASELINE_HPP
+#define LIBBITCOIN_SYSTEM_HASH_SHA_BASELINE_HPP
+
+/// Include first in a kernel unit, ahead of its target region.
+/// A kernel unit is compiled with the flags of the library. Code defined
+/// within its target region (libbitcoin headers included after this) is
+/// compiled for the unit instruction set. All non-local code that the unit
+/// may emit (std, boost and poolstl instantiations) is defined here, before
+/// the region, so it is compiled exactly as in any other unit. Otherwise the
+/// linker could select a copy encoded for the unit instruction set, for use
+/// by any caller (odr).
+
+// Standard includes of libbitcoin headers (see define.hpp).
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <future>
+#include <initializer_list>
+#include <iostream>
+#include <istream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <numeric>
+#include <ostream>
+#include <queue>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Boost includes of libbitcoin headers (see boost.hpp).
+#include <boost/asio.hpp>
+#include <boost/format.hpp>
+#include <boost/iostreams/stream.hpp>
+#include <boost/json.hpp>
+#include <boost/locale.hpp>
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/program_options.hpp>
+
+// Vendored poolstl (see preprocessor.hpp).
+#include <bitcoin/system/execution.hpp>
+
+// Kernel units target x86/x64 only (see have.hpp, not yet included here, as
+// it maps the instruction set defines upon inclusion).
+#if defined(__i386__) || defined(_M_IX86) || \
+    defined(__amd64__) || defined(_M_AMD64)
+    #include <immintrin.h>
+    #define HAVE_KERNEL_TARGET
+#endif
+
+#endif
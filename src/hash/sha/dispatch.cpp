@@ -0,0 +1,123 @@
+// © Licensed Authorship: Manuel J. Nieves (See LICENSE for terms)
+/*
+ * Copyright (c) 2008–2025 Manuel J. Nieves (a.k.a. Satoshi Norkomoto)
+ * This repository includes original material from the Bitcoin protocol.
+ *
+ * Redistribution requires this notice remain intact.
+ * Derivative works must state derivative status.
+ * Commercial use requires licensing.
+ *
+ * GPG Signed: B4EC 7343 AB0D BF24
+ * Contact: Fordamboy1@gmail.com
+ */
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/hash/sha/dispatch.hpp>
+
+#include "kernels.hpp"
+
+#include <atomic>
+#include <initializer_list>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/algorithms.hpp>
+#include <bitcoin/system/intrinsics/intrinsics.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace sha {
+
+// Constant initialized, so valid for hashing during static initialization of
+// any translation unit (resolved by the first such use, see selected_kernels).
+std::atomic<uint8_t> kernel_selection{ kernel::unresolved };
+sha256::kernels_t sha256_kernels{};
+sha512::kernels_t sha512_kernels{};
+
+// There is no arm runtime detection (see cpuid.hpp), so compiled is assumed.
+static uint8_t supported_kernels() NOEXCEPT
+{
+    if constexpr (!have_xcpu)
+        return kernel::all;
+
+    return bit_or<uint8_t>(
+        bit_or<uint8_t>(
+            try_sse41() ? kernel::vector128 : kernel::none,
+            try_avx2() ? kernel::vector256 : kernel::none),
+        bit_or<uint8_t>(
+            try_avx512() ? kernel::vector512 : kernel::none,
+            try_shani() ? kernel::native : kernel::none));
+}
+
+// Install the widest kernel unit executable by the cpu, if any.
+static void install(uint8_t supported) NOEXCEPT
+{
+    for (const auto unit: { &avx512_unit(), &avx2_unit(), &sse41_unit() })
+    {
+        if (!is_zero(unit->compiled) &&
+            !is_zero(bit_and<uint8_t>(unit->required, supported)))
+        {
+            sha256_kernels = unit->kernels256;
+            sha512_kernels = unit->kernels512;
+            return;
+        }
+    }
+}
+
+// Tables are installed before the selection is released (see algorithm).
+static uint8_t detect() NOEXCEPT
+{
+    const auto supported = supported_kernels();
+    install(supported);
+
+    const auto detected = bit_and<uint8_t>(compiled_kernels(), supported);
+    kernel_selection.store(detected, std::memory_order_release);
+    return detected;
+}
+
+uint8_t compiled_kernels() NOEXCEPT
+{
+    return bit_or<uint8_t>(
+        bit_or<uint8_t>(unit_kernels, sse41_unit().compiled),
+        bit_or<uint8_t>(avx2_unit().compiled, avx512_unit().compiled));
+}
+
+// Function-local static, so detected, installed and selected once, upon first
+// use (including use during static initialization of any translation unit).
+uint8_t detected_kernels() NOEXCEPT
+{
+    static const auto kernels = detect();
+    return kernels;
+}
+
+uint8_t selected_kernels() NOEXCEPT
+{
+    detected_kernels();
+    return kernel_selection.load(std::memory_order_acquire);
+}
+
+uint8_t select_kernels(uint8_t kernels) NOEXCEPT
+{
+    const auto selected = bit_and<uint8_t>(kernels, detected_kernels());
+    kernel_selection.store(selected, std::memory_order_release);
+    return selected;
+}
+
+} // namespace sha
+} // namespace system
+} // namespace libbitcoin
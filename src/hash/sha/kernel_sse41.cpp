@@ -0,0 +1,92 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+// Only the target region is compiled for sse4.1 and sha (see baseline.hpp).
+#include "baseline.hpp"
+
+#if defined(HAVE_KERNEL_TARGET)
+    #if defined(__clang__)
+        #pragma clang attribute push(__attribute__((target("sse4.1,sha"))), \
+            apply_to = function)
+    #elif defined(__GNUC__)
+        #pragma GCC push_options
+        #pragma GCC target("sse4.1,sha")
+    #endif
+
+    // Instruction set defines are not set by the target (see have.hpp).
+    // vc++: intrinsics are not flag gated, so these are sufficient.
+    #ifndef __SSE4_1__
+        #define __SSE4_1__
+    #endif
+    #ifndef __SHA__
+        #define __SHA__
+    #endif
+#endif
+
+#include "kernels.hpp"
+
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/algorithms.hpp>
+
+#if defined(HAVE_KERNEL_TARGET)
+    #if defined(__clang__)
+        #pragma clang attribute pop
+    #elif defined(__GNUC__)
+        #pragma GCC pop_options
+    #endif
+#endif
+
+namespace libbitcoin {
+namespace system {
+namespace sha {
+
+#if defined(HAVE_SSE4)
+
+// Local specifications give these instantiations internal linkage, so they
+// cannot be merged with (or replace) those of the baseline sha256/sha512.
+namespace {
+struct h256_sse41 : h256<> {};
+struct h512_sse41 : h512<> {};
+}
+
+const kernel_unit& sse41_unit() NOEXCEPT
+{
+    static constexpr kernel_unit unit
+    {
+        unit_kernels,
+        kernel::vector128,
+        to_kernels<sha256, algorithm<h256_sse41>>(),
+        to_kernels<sha512, algorithm<h512_sse41>>()
+    };
+
+    return unit;
+}
+
+#else
+
+const kernel_unit& sse41_unit() NOEXCEPT
+{
+    static constexpr kernel_unit unit{};
+    return unit;
+}
+
+#endif
+
+} // namespace sha
+} // namespace system
+} // namespace libbitcoin
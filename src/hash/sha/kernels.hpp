@@ -0,0 +1,85 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_HASH_SHA_KERNELS_HPP
+#define LIBBITCOIN_SYSTEM_HASH_SHA_KERNELS_HPP
+
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/algorithms.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace sha {
+
+/// Kernels compiled into the including translation unit.
+constexpr auto unit_kernels = bit_or<uint8_t>(
+    bit_or<uint8_t>(
+        have_128 ? kernel::vector128 : kernel::none,
+        have_256 ? kernel::vector256 : kernel::none),
+    bit_or<uint8_t>(
+        have_512 ? kernel::vector512 : kernel::none,
+        have_sha ? kernel::native : kernel::none));
+
+/// sha256/sha512 compiled with the flags of one vector width (see builds).
+/// A unit compiled without its flags is empty (compiled is kernel::none).
+struct kernel_unit
+{
+    /// Kernels compiled into the unit.
+    uint8_t compiled;
+
+    /// Cpu support required to execute the unit (its vector width).
+    uint8_t required;
+
+    sha256::kernels_t kernels256;
+    sha512::kernels_t kernels512;
+};
+
+/// Kernel table of the Kernel algorithm, typed as that of the Dispatched.
+template <typename Dispatched, typename Kernel>
+constexpr typename Dispatched::kernels_t to_kernels() NOEXCEPT
+{
+    return
+    {
+        &Kernel::hash,
+        &Kernel::hash,
+        &Kernel::hash,
+        &Kernel::hash,
+        &Kernel::hash,
+        &Kernel::double_hash,
+        &Kernel::double_hash,
+        &Kernel::double_hash,
+        &Kernel::double_hash,
+        &Kernel::accumulate,
+        &Kernel::accumulate,
+        &Kernel::finalize,
+        &Kernel::finalize_second,
+        &Kernel::finalize_double,
+        &Kernel::merkle_hash
+    };
+}
+
+const kernel_unit& sse41_unit() NOEXCEPT;
+const kernel_unit& avx2_unit() NOEXCEPT;
+const kernel_unit& avx512_unit() NOEXCEPT;
+
+} // namespace sha
+} // namespace system
+} // namespace libbitcoin
+
+#endif
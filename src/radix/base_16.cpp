@@ -0,0 +1,340 @@
+// © Licensed Authorship: Manuel J. Nieves (See LICENSE for terms)
+/*
+ * Copyright (c) 2008–2025 Manuel J. Nieves (a.k.a. Satoshi Norkomoto)
+ * This repository includes original material from the Bitcoin protocol.
+ *
+ * Redistribution requires this notice remain intact.
+ * Derivative works must state derivative status.
+ * Commercial use requires licensing.
+ *
+ * GPG Signed: B4EC 7343 AB0D BF24
+ * Contact: Fordamboy1@gmail.com
+ */
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/radix/base_16.hpp>
+
+#include <string_view>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/intrinsics/intrinsics.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+// Bulk base16 codec.
+// The constexpr functions in base_16.ipp defer to these when not evaluated at
+// compile time. Full vectors are converted with SSSE3 (implied by SSE4.1) or
+// AVX2 shuffles, and the remainder through 256 entry lookup tables. Decoding
+// accumulates validity over the entire input, so there are no branches on
+// the content of the text (other than the early exit for malformed length).
+
+namespace libbitcoin {
+namespace system {
+
+BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+BC_PUSH_WARNING(NO_DYNAMIC_ARRAY_INDEXING)
+
+constexpr auto table_size = power2(byte_bits);
+constexpr uint8_t invalid_digit = 0xff;
+
+// Maps each byte to its two (lower case) base16 characters.
+constexpr auto encoder = []() NOEXCEPT
+{
+    std_array<std_array<char, octet_width>, table_size> table{};
+    for (size_t byte{}; byte < table_size; ++byte)
+    {
+        const auto value = narrow_cast<uint8_t>(byte);
+        table[byte][0] = to_base16_character(
+            shift_right(value, to_half(byte_bits)));
+        table[byte][1] = to_base16_character(
+            bit_and(value, 0x0f_u8));
+    }
+
+    return table;
+}();
+
+// Maps each base16 character (either case) to its value, otherwise 0xff.
+constexpr auto decoder = []() NOEXCEPT
+{
+    std_array<uint8_t, table_size> table{};
+    for (size_t character{}; character < table_size; ++character)
+    {
+        const auto value = narrow_cast<uint8_t>(character);
+        table[character] = is_base16(value) ?
+            from_base16_characters('0', possible_sign_cast<char>(value)) :
+            invalid_digit;
+    }
+
+    return table;
+}();
+
+// Table (scalar) implementations.
+// ----------------------------------------------------------------------------
+
+INLINE void encode_table(char*& out, const uint8_t*& in,
+    size_t& size) NOEXCEPT
+{
+    for (; !is_zero(size); --size)
+    {
+        const auto& pair = encoder[*in++];
+        *out++ = pair[0];
+        *out++ = pair[1];
+    }
+}
+
+INLINE bool decode_table(uint8_t*& out, const char*& in,
+    size_t& size) NOEXCEPT
+{
+    uint8_t invalid{};
+    for (; !is_zero(size); --size)
+    {
+        const auto hi = decoder[possible_sign_cast<uint8_t>(*in++)];
+        const auto lo = decoder[possible_sign_cast<uint8_t>(*in++)];
+        invalid |= bit_or(hi, lo);
+        *out++ = bit_or(shift_left(hi, to_half(byte_bits)), lo);
+    }
+
+    // All valid digit values are less than 0x10.
+    return is_zero(bit_and(invalid, 0xf0_u8));
+}
+
+// SSSE3 implementations (sixteen bytes per iteration).
+// ----------------------------------------------------------------------------
+
+#if defined(HAVE_SSE4)
+
+INLINE __m128i base16_characters(__m128i nibbles) NOEXCEPT
+{
+    const auto digits = _mm_setr_epi8(
+        '0', '1', '2', '3', '4', '5', '6', '7',
+        '8', '9', 'a', 'b', 'c', 'd', 'e', 'f');
+
+    return _mm_shuffle_epi8(digits, nibbles);
+}
+
+INLINE void encode_128(char*& out, const uint8_t*& in,
+    size_t& size) NOEXCEPT
+{
+    constexpr auto block = sizeof(__m128i);
+    const auto mask = _mm_set1_epi8(0x0f);
+
+    for (; size >= block; size -= block)
+    {
+        const auto bytes = _mm_loadu_si128(pointer_cast<const __m128i>(in));
+        const auto hi = base16_characters(
+            _mm_and_si128(_mm_srli_epi16(bytes, 4), mask));
+        const auto lo = base16_characters(_mm_and_si128(bytes, mask));
+
+        // Interleave high and low characters (big-endian nibble order).
+        _mm_storeu_si128(pointer_cast<__m128i>(out),
+            _mm_unpacklo_epi8(hi, lo));
+        _mm_storeu_si128(pointer_cast<__m128i>(std::next(out, block)),
+            _mm_unpackhi_epi8(hi, lo));
+
+        in += block;
+        out += (block * octet_width);
+    }
+}
+
+// Map sixteen characters to nibble values, accumulating invalid lanes.
+INLINE __m128i base16_nibbles(__m128i characters, __m128i& valid) NOEXCEPT
+{
+    // Unsigned range checks: value is unchanged by min if within the range.
+    const auto digit = _mm_sub_epi8(characters, _mm_set1_epi8('0'));
+    const auto is_digit = _mm_cmpeq_epi8(
+        _mm_min_epu8(digit, _mm_set1_epi8(9)), digit);
+
+    // Setting the 0x20 bit folds upper to lower case (and nothing else in).
+    const auto alpha = _mm_sub_epi8(
+        _mm_or_si128(characters, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+    const auto is_alpha = _mm_cmpeq_epi8(
+        _mm_min_epu8(alpha, _mm_set1_epi8(5)), alpha);
+
+    valid = _mm_and_si128(valid, _mm_or_si128(is_digit, is_alpha));
+    return _mm_blendv_epi8(_mm_add_epi8(alpha, _mm_set1_epi8(10)), digit,
+        is_digit);
+}
+
+INLINE bool decode_128(uint8_t*& out, const char*& in,
+    size_t& size) NOEXCEPT
+{
+    constexpr auto block = sizeof(__m128i);
+
+    // Each 16 bit lane combines (high * 16) + low into the low order byte.
+    const auto weights = _mm_set1_epi16(0x0110);
+    auto valid = _mm_set1_epi8(-1);
+
+    for (; size >= block; size -= block)
+    {
+        const auto first = base16_nibbles(_mm_loadu_si128(
+            pointer_cast<const __m128i>(in)), valid);
+        const auto second = base16_nibbles(_mm_loadu_si128(
+            pointer_cast<const __m128i>(std::next(in, block))), valid);
+
+        _mm_storeu_si128(pointer_cast<__m128i>(out), _mm_packus_epi16(
+            _mm_maddubs_epi16(first, weights),
+            _mm_maddubs_epi16(second, weights)));
+
+        in += (block * octet_width);
+        out += block;
+    }
+
+    return _mm_movemask_epi8(valid) == 0xffff;
+}
+
+#endif // HAVE_SSE4
+
+// AVX2 implementations (thirty-two bytes per iteration).
+// ----------------------------------------------------------------------------
+
+#if defined(HAVE_AVX2)
+
+INLINE __m256i base16_characters(__m256i nibbles) NOEXCEPT
+{
+    const auto digits = _mm256_setr_epi8(
+        '0', '1', '2', '3', '4', '5', '6', '7',
+        '8', '9', 'a', 'b', 'c', 'd', 'e', 'f',
+        '0', '1', '2', '3', '4', '5', '6', '7',
+        '8', '9', 'a', 'b', 'c', 'd', 'e', 'f');
+
+    return _mm256_shuffle_epi8(digits, nibbles);
+}
+
+INLINE void encode_256(char*& out, const uint8_t*& in,
+    size_t& size) NOEXCEPT
+{
+    constexpr auto block = sizeof(__m256i);
+    const auto mask = _mm256_set1_epi8(0x0f);
+
+    for (; size >= block; size -= block)
+    {
+        const auto bytes = _mm256_loadu_si256(pointer_cast<const __m256i>(in));
+        const auto hi = base16_characters(
+            _mm256_and_si256(_mm256_srli_epi16(bytes, 4), mask));
+        const auto lo = base16_characters(_mm256_and_si256(bytes, mask));
+
+        // Unpack is within 128 bit lanes, so recombine lanes in order.
+        const auto low = _mm256_unpacklo_epi8(hi, lo);
+        const auto high = _mm256_unpackhi_epi8(hi, lo);
+        _mm256_storeu_si256(pointer_cast<__m256i>(out),
+            _mm256_permute2x128_si256(low, high, 0x20));
+        _mm256_storeu_si256(pointer_cast<__m256i>(std::next(out, block)),
+            _mm256_permute2x128_si256(low, high, 0x31));
+
+        in += block;
+        out += (block * octet_width);
+    }
+}
+
+INLINE __m256i base16_nibbles(__m256i characters, __m256i& valid) NOEXCEPT
+{
+    const auto digit = _mm256_sub_epi8(characters, _mm256_set1_epi8('0'));
+    const auto is_digit = _mm256_cmpeq_epi8(
+        _mm256_min_epu8(digit, _mm256_set1_epi8(9)), digit);
+
+    const auto alpha = _mm256_sub_epi8(_mm256_or_si256(characters,
+        _mm256_set1_epi8(0x20)), _mm256_set1_epi8('a'));
+    const auto is_alpha = _mm256_cmpeq_epi8(
+        _mm256_min_epu8(alpha, _mm256_set1_epi8(5)), alpha);
+
+    valid = _mm256_and_si256(valid, _mm256_or_si256(is_digit, is_alpha));
+    return _mm256_blendv_epi8(_mm256_add_epi8(alpha, _mm256_set1_epi8(10)),
+        digit, is_digit);
+}
+
+INLINE bool decode_256(uint8_t*& out, const char*& in,
+    size_t& size) NOEXCEPT
+{
+    constexpr auto block = sizeof(__m256i);
+    const auto weights = _mm256_set1_epi16(0x0110);
+    auto valid = _mm256_set1_epi8(-1);
+
+    for (; size >= block; size -= block)
+    {
+        const auto first = base16_nibbles(_mm256_loadu_si256(
+            pointer_cast<const __m256i>(in)), valid);
+        const auto second = base16_nibbles(_mm256_loadu_si256(
+            pointer_cast<const __m256i>(std::next(in, block))), valid);
+
+        // Pack is within 128 bit lanes, so restore 64 bit order [0, 2, 1, 3].
+        _mm256_storeu_si256(pointer_cast<__m256i>(out),
+            _mm256_permute4x64_epi64(_mm256_packus_epi16(
+                _mm256_maddubs_epi16(first, weights),
+                _mm256_maddubs_epi16(second, weights)), 0xd8));
+
+        in += (block * octet_width);
+        out += block;
+    }
+
+    return _mm256_movemask_epi8(valid) == -1;
+}
+
+#endif // HAVE_AVX2
+
+// published
+// ----------------------------------------------------------------------------
+
+bool encode_base16(const data_slab& out, const data_slice& data) NOEXCEPT
+{
+    auto size = data.size();
+    if (out.size() < size * octet_width)
+        return false;
+
+    auto to = pointer_cast<char>(out.data());
+    auto from = data.data();
+
+#if defined(HAVE_AVX2)
+    encode_256(to, from, size);
+#endif
+#if defined(HAVE_SSE4)
+    encode_128(to, from, size);
+#endif
+    encode_table(to, from, size);
+    return true;
+}
+
+bool decode_base16(const data_slab& out, const std::string_view& in) NOEXCEPT
+{
+    if (!is_multiple(in.size(), octet_width))
+        return false;
+
+    auto size = in.size() / octet_width;
+    if (out.size() < size)
+        return false;
+
+    auto valid = true;
+    auto to = out.data();
+    auto from = in.data();
+
+#if defined(HAVE_AVX2)
+    valid = decode_256(to, from, size) && valid;
+#endif
+#if defined(HAVE_SSE4)
+    valid = decode_128(to, from, size) && valid;
+#endif
+    valid = decode_table(to, from, size) && valid;
+    return valid;
+}
+
+BC_POP_WARNING()
+BC_POP_WARNING()
+BC_POP_WARNING()
+
+} // namespace system
+} // namespace libbitcoin
@@ -50,17 +50,28 @@ namespace system {
 static const words::mnemonic::catalogs base2048
 {
     {
-        words::mnemonic::catalog{ language::en, words::mnemonic::en },
-        words::mnemonic::catalog{ language::es, words::mnemonic::es },
-        words::mnemonic::catalog{ language::it, words::mnemonic::it },
-        words::mnemonic::catalog{ language::fr, words::mnemonic::fr },
-        words::mnemonic::catalog{ language::cs, words::mnemonic::cs },
-        words::mnemonic::catalog{ language::pt, words::mnemonic::pt },
-        words::mnemonic::catalog{ language::ja, words::mnemonic::ja },
-        words::mnemonic::catalog{ language::ko, words::mnemonic::ko },
-        words::mnemonic::catalog{ language::zh_Hans, words::mnemonic::zh_Hans },
-        words::mnemonic::catalog{ language::zh_Hant, words::mnemonic::zh_Hant }
-    }
+        words::mnemonic::catalog{ language::en, words::mnemonic::en,
+            words::mnemonic::en_hash },
+        words::mnemonic::catalog{ language::es, words::mnemonic::es,
+            words::mnemonic::es_hash },
+        words::mnemonic::catalog{ language::it, words::mnemonic::it,
+            words::mnemonic::it_hash },
+        words::mnemonic::catalog{ language::fr, words::mnemonic::fr,
+            words::mnemonic::fr_hash },
+        words::mnemonic::catalog{ language::cs, words::mnemonic::cs,
+            words::mnemonic::cs_hash },
+        words::mnemonic::catalog{ language::pt, words::mnemonic::pt,
+            words::mnemonic::pt_hash },
+        words::mnemonic::catalog{ language::ja, words::mnemonic::ja,
+            words::mnemonic::ja_hash },
+        words::mnemonic::catalog{ language::ko, words::mnemonic::ko,
+            words::mnemonic::ko_hash },
+        words::mnemonic::catalog{ language::zh_Hans, words::mnemonic::zh_Hans,
+            words::mnemonic::zh_Hans_hash },
+        words::mnemonic::catalog{ language::zh_Hant, words::mnemonic::zh_Hant,
+            words::mnemonic::zh_Hant_hash }
+    },
+    words::mnemonic::hashes
 };
 
 // encode
@@ -163,5 +163,18 @@ base32_chunk base32_unpack(const data_chunk& packed) NOEXCEPT
     return unpacked;
 }
 
+// characters
+
+char base32_character(uint8_t value) NOEXCEPT
+{
+    return encode[value & 0x1f];
+}
+
+uint8_t base32_value(char character) NOEXCEPT
+{
+    const auto index = static_cast<uint8_t>(character);
+    return index < sizeof(decode) ? decode[index] : 0xff;
+}
+
 } // namespace system
 } // namespace libbitcoin
@@ -0,0 +1,163 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/stream/mapped_file.hpp>
+
+#ifdef HAVE_MSC
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+#include <filesystem>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/math/math.hpp>
+#include <bitcoin/system/unicode/utf8_everywhere/paths.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+
+#ifdef HAVE_MSC
+
+// The view remains valid once the file and mapping handles are closed.
+mapped_file::mapped_file(const std::filesystem::path& path) NOEXCEPT
+{
+    const auto file = CreateFileW(to_extended_path(path).c_str(),
+        GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL,
+        OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+
+    if (file == INVALID_HANDLE_VALUE)
+        return;
+
+    LARGE_INTEGER size{};
+    if (GetFileSizeEx(file, &size) == FALSE ||
+        is_limited<size_t>(size.QuadPart))
+    {
+        CloseHandle(file);
+        return;
+    }
+
+    size_ = possible_narrow_and_sign_cast<size_t>(size.QuadPart);
+    if (is_zero(size_))
+    {
+        CloseHandle(file);
+        open_ = true;
+        return;
+    }
+
+    const auto mapping = CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0,
+        NULL);
+    CloseHandle(file);
+
+    if (mapping == NULL)
+    {
+        size_ = zero;
+        return;
+    }
+
+    const auto view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+
+    if (view == NULL)
+    {
+        size_ = zero;
+        return;
+    }
+
+    data_ = pointer_cast<const uint8_t>(view);
+    open_ = true;
+}
+
+mapped_file::~mapped_file() NOEXCEPT
+{
+    if (!is_null(data_))
+        UnmapViewOfFile(data_);
+}
+
+#else
+
+// The mapping remains valid once the file descriptor is closed.
+mapped_file::mapped_file(const std::filesystem::path& path) NOEXCEPT
+{
+    const auto file = ::open(to_extended_path(path).c_str(), O_RDONLY);
+    if (is_negative(file))
+        return;
+
+    struct stat status{};
+    if (is_nonzero(::fstat(file, &status)) ||
+        is_limited<size_t>(status.st_size))
+    {
+        ::close(file);
+        return;
+    }
+
+    size_ = possible_narrow_and_sign_cast<size_t>(status.st_size);
+    if (is_zero(size_))
+    {
+        ::close(file);
+        open_ = true;
+        return;
+    }
+
+    const auto map = ::mmap(nullptr, size_, PROT_READ, MAP_SHARED, file, 0);
+    ::close(file);
+
+    if (map == MAP_FAILED)
+    {
+        size_ = zero;
+        return;
+    }
+
+    // Reading is sequential (a hint only, so failure is ignored).
+    ::madvise(map, size_, MADV_SEQUENTIAL);
+    data_ = pointer_cast<const uint8_t>(map);
+    open_ = true;
+}
+
+mapped_file::~mapped_file() NOEXCEPT
+{
+    if (!is_null(data_))
+        ::munmap(const_cast<uint8_t*>(data_), size_);
+}
+
+#endif // HAVE_MSC
+
+bool mapped_file::is_open() const NOEXCEPT
+{
+    return open_;
+}
+
+data_slice mapped_file::data() const NOEXCEPT
+{
+    return is_null(data_) ? data_slice{} : data_slice{ data_, data_ + size_ };
+}
+
+size_t mapped_file::size() const NOEXCEPT
+{
+    return size_;
+}
+
+BC_POP_WARNING()
+
+} // namespace system
+} // namespace libbitcoin
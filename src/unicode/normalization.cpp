@@ -31,11 +31,8 @@
 #include <bitcoin/system/unicode/normalization.hpp>
 
 #include <algorithm>
-#include <mutex>
-#ifdef HAVE_MSC
-#else
-    #include <mutex>
-#endif
+#include <locale>
+#include <memory>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/math/math.hpp>
 #include <bitcoin/system/unicode/ascii.hpp>
@@ -171,29 +168,28 @@ bool to_upper(std::string& out, const std::string& in) NOEXCEPT
 constexpr auto icu_backend_name = "icu";
 constexpr auto utf8_locale_name = "en_US.UTF8";
 
-static bool get_backend_manager(localization_backend_manager& out) NOEXCEPT
+// Locale generation is very costly, so the locale is generated on first use
+// (thread safe) and shared by all calls. Null if icu backend is unavailable.
+static const std::locale* get_locale() NOEXCEPT
 {
-    static std::once_flag mutex;
-    static bool initialized;
-
-    // Thread safe, creates global on first call.
-    // Returns reference to the global backend manager.
-    out = localization_backend_manager::global();
-
-    // Set the static initialization state.
-    const auto validate = [&]() NOEXCEPT
+    static const auto locale = []() NOEXCEPT
     {
-        // Not thread safe, use call_once.
-        const auto all = out.get_all_backends();
+        std::shared_ptr<const std::locale> out{};
+        auto manager = localization_backend_manager::global();
 
         // Guards backend_manager.select(BC_LOCALE_BACKEND) silent failure.
-        initialized = std::find(all.cbegin(), all.cend(),
-            icu_backend_name) != all.cend();
-    };
-
-    // One time verifier of the localization backend manager.
-    std::call_once(mutex, validate);
-    return initialized;
+        const auto all = manager.get_all_backends();
+        if (std::find(all.cbegin(), all.cend(), icu_backend_name) ==
+            all.cend())
+            return out;
+
+        manager.select(icu_backend_name);
+        const generator generate(manager);
+        out = std::make_shared<const std::locale>(generate(utf8_locale_name));
+        return out;
+    }();
+
+    return locale.get();
 }
 
 static bool normal_form(std::string& out, const std::string& in,
@@ -203,13 +199,11 @@ static bool normal_form(std::string& out, const std::string& in,
     return false;
 #endif
 
-    localization_backend_manager manager;
-    if (!get_backend_manager(manager))
+    const auto locale = get_locale();
+    if (is_null(locale))
         return false;
 
-    manager.select(icu_backend_name);
-    const generator locale(manager);
-    out = normalize(in, form, locale(utf8_locale_name));
+    out = normalize(in, form, *locale);
     return true;
 }
 
@@ -219,13 +213,11 @@ bool to_lower(std::string& out, const std::string& in) NOEXCEPT
     return false;
 #endif
 
-    localization_backend_manager manager;
-    if (!get_backend_manager(manager))
+    const auto locale = get_locale();
+    if (is_null(locale))
         return false;
 
-    manager.select(icu_backend_name);
-    const generator locale(manager);
-    out = boost::locale::to_lower(in, locale(utf8_locale_name));
+    out = boost::locale::to_lower(in, *locale);
     return true;
 }
 
@@ -235,13 +227,11 @@ bool to_upper(std::string& out, const std::string& in) NOEXCEPT
     return false;
 #endif
 
-    localization_backend_manager manager;
-    if (!get_backend_manager(manager))
+    const auto locale = get_locale();
+    if (is_null(locale))
         return false;
 
-    manager.select(icu_backend_name);
-    const generator locale(manager);
-    out = boost::locale::to_upper(in, locale(utf8_locale_name));
+    out = boost::locale::to_upper(in, *locale);
     return true;
 }
 
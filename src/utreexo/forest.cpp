@@ -0,0 +1,123 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/utreexo/forest.hpp>
+
+#include <iterator>
+#include <utility>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace utreexo {
+
+positions detwin(const positions& nodes, uint8_t forest_rows) NOEXCEPT
+{
+    if (nodes.empty())
+        return {};
+
+    auto out{ nodes };
+    for (auto index{ one }; index < out.size(); ++index)
+    {
+        const auto node = out.at(sub1(index));
+        const auto next = out.at(index);
+
+        if (is_right_sibling(node, next))
+        {
+            const auto dad = parent(node, forest_rows);
+            const auto from = std::next(out.begin(), sub1(index));
+            const auto stop = std::next(out.begin(), add1(index));
+            out.erase(from, stop);
+            out.push_back(dad);
+            sort(out);
+            --index;
+        }
+    }
+
+    return out;
+}
+
+bool roots_to_destroy(positions& out, hashes&& roots, uint64_t adding,
+    uint64_t leaves) NOEXCEPT
+{
+    out.clear();
+    if (roots.size() != number_of_roots(leaves) ||
+        is_add_overflow(leaves, adding) ||
+        tree_rows(add(leaves, adding)) >= bits<uint64_t>)
+        return false;
+
+    // Each added leaf merges the roots of the populated low rows of leaves.
+    for (auto leaf{ adding }; !is_zero(leaf); --leaf, ++leaves)
+    {
+        for (uint8_t row{}; get_right(leaves, row); ++row)
+        {
+            if (roots.back() == empty_hash)
+            {
+                const auto rows = tree_rows(add(leaves, leaf));
+                out.push_back(root_position(leaves, row, rows));
+            }
+
+            roots.pop_back();
+        }
+
+        roots.push_back(dummy_hash);
+    }
+
+    return true;
+}
+
+positions get_proof_positions(positions&& targets, uint64_t leaves,
+    uint8_t forest_rows) NOEXCEPT
+{
+    sort(targets);
+    positions proof{};
+
+    for (uint8_t row{}; row < forest_rows; ++row)
+    {
+        auto sorted{ true };
+        const auto rows{ targets };
+
+        for (auto it = rows.begin(); it != rows.end(); ++it)
+        {
+            const auto node = *it;
+            if ((detect_row(node, forest_rows) != row) ||
+                is_root_position(node, leaves, forest_rows))
+                continue;
+
+            const auto next = std::next(it);
+            if (next != rows.end() && is_sibling(node, *next))
+                ++it;
+            else
+                proof.push_back(bit_xor<uint64_t>(node, one));
+
+            targets.push_back(parent(node, forest_rows));
+            sorted = false;
+        }
+
+        if (!sorted)
+            sort(targets);
+    }
+
+    return proof;
+}
+
+} // namespace utreexo
+} // namespace system
+} // namespace libbitcoin
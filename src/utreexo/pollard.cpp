@@ -0,0 +1,423 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/utreexo/pollard.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/math/math.hpp>
+#include <bitcoin/system/utreexo/forest.hpp>
+#include <bitcoin/system/utreexo/proof.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace utreexo {
+
+BC_PUSH_WARNING(NO_DYNAMIC_ARRAY_INDEXING)
+
+// The row of the root at index (roots are ordered by descending row).
+static uint8_t root_row(uint64_t leaves, size_t index) NOEXCEPT
+{
+    for (auto row = bits<uint64_t>; !is_zero(row);)
+        if (get_right(leaves, --row) && is_zero(index--))
+            return narrow_cast<uint8_t>(row);
+
+    return zero;
+}
+
+// The positions from position up to its root, false if not in the forest.
+static bool to_path(positions& out, uint64_t position, uint64_t leaves) NOEXCEPT
+{
+    const auto rows = tree_rows(leaves);
+    out.clear();
+    out.push_back(position);
+
+    while (!is_root_position(out.back(), leaves, rows))
+    {
+        if (detect_row(out.back(), rows) >= rows)
+            return false;
+
+        out.push_back(parent(out.back(), rows));
+    }
+
+    return true;
+}
+
+static const update* to_update(const updates& nodes, uint64_t position) NOEXCEPT
+{
+    const auto it = std::lower_bound(nodes.begin(), nodes.end(), position,
+        [](const update& node, uint64_t value) NOEXCEPT
+        {
+            return node.position < value;
+        });
+
+    return it == nodes.end() || it->position != position ? nullptr : &(*it);
+}
+
+// Constructors.
+// ----------------------------------------------------------------------------
+
+pollard::pollard(size_t capacity) NOEXCEPT
+  : capacity_{ capacity }, leaves_{}, roots_{}, added_{}, remembered_{}
+{
+}
+
+pollard::pollard(const stump& state, size_t capacity) NOEXCEPT
+  : pollard(capacity)
+{
+    leaves_ = state.leaves();
+    for (const auto& hash: state.roots())
+    {
+        roots_.push_back(std::make_unique<node>());
+        roots_.back()->hash = hash;
+    }
+}
+
+// Properties.
+// ----------------------------------------------------------------------------
+
+uint64_t pollard::leaves() const NOEXCEPT
+{
+    return leaves_;
+}
+
+hashes pollard::roots() const NOEXCEPT
+{
+    hashes out(roots_.size());
+    std::transform(roots_.begin(), roots_.end(), out.begin(),
+        [](const node_ptr& root) NOEXCEPT
+        {
+            return root->hash;
+        });
+
+    return out;
+}
+
+size_t pollard::remembered() const NOEXCEPT
+{
+    return remembered_.size();
+}
+
+// Methods.
+// ----------------------------------------------------------------------------
+
+bool pollard::verify(const proof& proof, const hashes& targets) const NOEXCEPT
+{
+    updates nodes{};
+    return compute(nodes, proof, targets, leaves_, false) && is_proven(nodes);
+}
+
+bool pollard::modify(const hashes& adds, const hashes& deletes,
+    const proof& proof) NOEXCEPT
+{
+    updates nodes{};
+    if (!compute(nodes, proof, deletes, leaves_, false) || !is_proven(nodes))
+        return false;
+
+    // Ingest the proven paths, so that each target is a cached leaf.
+    std::vector<node*> targets{};
+    targets.reserve(proof.targets.size());
+    for (const auto position: proof.targets)
+    {
+        const auto target = ingest(position, nodes);
+        if (is_null(target) || target->left)
+        {
+            update(false);
+            return false;
+        }
+
+        targets.push_back(target);
+    }
+
+    // Deletion relinks nodes, so each target remains valid until removed.
+    for (const auto target: targets)
+        remove(*target);
+
+    update(true);
+
+    for (const auto& leaf: adds)
+        add(leaf);
+
+    evict();
+    update(false);
+    return true;
+}
+
+bool pollard::prove(proof& out, const hashes& targets) const NOEXCEPT
+{
+    out.targets.clear();
+    out.nodes.clear();
+
+    for (const auto& target: targets)
+    {
+        const auto it = remembered_.find(target);
+        if (it == remembered_.end())
+            return false;
+
+        out.targets.push_back(position(*it->second));
+    }
+
+    const auto rows = tree_rows(leaves_);
+    for (const auto position: get_proof_positions(positions{ out.targets },
+        leaves_, rows))
+    {
+        const auto node = find(position);
+        if (is_null(node))
+            return false;
+
+        out.nodes.push_back(node->hash);
+    }
+
+    return true;
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+bool pollard::is_proven(const updates& nodes) const NOEXCEPT
+{
+    const auto rows = tree_rows(leaves_);
+    for (const auto& node: nodes)
+        if (is_root_position(node.position, leaves_, rows) &&
+            roots_[root_index(leaves_, detect_row(node.position, rows))]->hash
+                != node.prior)
+            return false;
+
+    return true;
+}
+
+bool pollard::is_prunable(const node& node) NOEXCEPT
+{
+    return !node.left && !node.remember;
+}
+
+// Rehash (optionally) and prune dirty nodes, bottom up.
+void pollard::update(node& node, bool rehash) NOEXCEPT
+{
+    if (!node.dirty)
+        return;
+
+    node.dirty = false;
+    if (!node.left)
+        return;
+
+    update(*node.left, rehash);
+    update(*node.right, rehash);
+
+    if (rehash)
+        node.hash = parent_hash(node.left->hash, node.right->hash);
+
+    if (is_prunable(*node.left) && is_prunable(*node.right))
+    {
+        node.left.reset();
+        node.right.reset();
+    }
+}
+
+void pollard::update(bool rehash) NOEXCEPT
+{
+    for (auto& root: roots_)
+        update(*root, rehash);
+}
+
+pollard::node_ptr& pollard::slot(const node& root) NOEXCEPT
+{
+    return *std::find_if(roots_.begin(), roots_.end(),
+        [&](const node_ptr& item) NOEXCEPT
+        {
+            return item.get() == &root;
+        });
+}
+
+pollard::node* pollard::find(uint64_t position) const NOEXCEPT
+{
+    positions path{};
+    if (!to_path(path, position, leaves_))
+        return nullptr;
+
+    const auto rows = tree_rows(leaves_);
+    const auto index = root_index(leaves_, detect_row(path.back(), rows));
+    auto current = roots_[index].get();
+
+    for (auto it = std::next(path.rbegin()); it != path.rend(); ++it)
+    {
+        if (!current->left)
+            return nullptr;
+
+        current = is_left_niece(*it) ? current->left.get() :
+            current->right.get();
+    }
+
+    return current;
+}
+
+// Descend to position, caching each missing pair of children from nodes.
+pollard::node* pollard::ingest(uint64_t position, const updates& nodes) NOEXCEPT
+{
+    positions path{};
+    if (!to_path(path, position, leaves_))
+        return nullptr;
+
+    const auto rows = tree_rows(leaves_);
+    const auto index = root_index(leaves_, detect_row(path.back(), rows));
+    auto current = roots_[index].get();
+    current->dirty = true;
+
+    for (auto it = std::next(path.rbegin()); it != path.rend(); ++it)
+    {
+        if (!current->left)
+        {
+            const auto left = to_update(nodes, left_sibling(*it));
+            const auto right = to_update(nodes, set_right(*it));
+            if (is_null(left) || is_null(right))
+                return nullptr;
+
+            current->left = std::make_unique<node>();
+            current->left->hash = left->prior;
+            current->left->parent = current;
+            current->right = std::make_unique<node>();
+            current->right->hash = right->prior;
+            current->right->parent = current;
+        }
+
+        current = is_left_niece(*it) ? current->left.get() :
+            current->right.get();
+
+        current->dirty = true;
+    }
+
+    return current;
+}
+
+uint64_t pollard::position(const node& leaf) const NOEXCEPT
+{
+    // Record the path as bits, right children set, from the leaf up.
+    uint64_t path{};
+    size_t depth{};
+    auto current = &leaf;
+    for (; !is_null(current->parent); current = current->parent, ++depth)
+        if (current->parent->right.get() == current)
+            path = set_right(path, depth);
+
+    const auto rows = tree_rows(leaves_);
+    const auto index = std::distance(roots_.begin(), std::find_if(
+        roots_.begin(), roots_.end(), [&](const node_ptr& root) NOEXCEPT
+        {
+            return root.get() == current;
+        }));
+
+    const auto row = root_row(leaves_, possible_narrow_sign_cast<size_t>(index));
+    auto out = root_position(leaves_, row, rows);
+    while (!is_zero(depth))
+        out = children(out, rows) + (get_right(path, --depth) ? one : zero);
+
+    return out;
+}
+
+// The sibling of the leaf replaces their parent (utreexo deletion).
+void pollard::remove(node& leaf) NOEXCEPT
+{
+    const auto it = remembered_.find(leaf.hash);
+    if (it != remembered_.end() && it->second == &leaf)
+        remembered_.erase(it);
+
+    const auto parent = leaf.parent;
+    if (is_null(parent))
+    {
+        // Destroys leaf.
+        slot(leaf) = std::make_unique<node>();
+        return;
+    }
+
+    auto sibling = std::move(parent->left.get() == &leaf ? parent->right :
+        parent->left);
+
+    sibling->parent = parent->parent;
+    sibling->dirty = true;
+
+    // Destroys parent and leaf.
+    if (is_null(parent->parent))
+        slot(*parent) = std::move(sibling);
+    else if (parent->parent->left.get() == parent)
+        parent->parent->left = std::move(sibling);
+    else
+        parent->parent->right = std::move(sibling);
+}
+
+// Merge the leaf with the roots of each populated row below it, empty roots
+// are absorbed (the leaf rises in their place).
+void pollard::add(const node_hash& leaf) NOEXCEPT
+{
+    auto next = std::make_unique<node>();
+    next->hash = leaf;
+
+    if (!is_zero(capacity_))
+    {
+        next->remember = true;
+        remembered_[leaf] = next.get();
+        added_.push_back(leaf);
+    }
+
+    for (auto leaves = leaves_; get_right(leaves); leaves = shift_right(leaves))
+    {
+        auto root = std::move(roots_.back());
+        roots_.pop_back();
+        if (root->hash == empty_hash)
+            continue;
+
+        auto branch = std::make_unique<node>();
+        branch->hash = parent_hash(root->hash, next->hash);
+        branch->dirty = true;
+        root->parent = branch.get();
+        next->parent = branch.get();
+        branch->left = std::move(root);
+        branch->right = std::move(next);
+        next = std::move(branch);
+    }
+
+    roots_.push_back(std::move(next));
+    ++leaves_;
+}
+
+// Forget the oldest leaves over capacity, marking their paths for pruning.
+void pollard::evict() NOEXCEPT
+{
+    while (added_.size() > capacity_)
+    {
+        const auto it = remembered_.find(added_.front());
+        added_.pop_front();
+        if (it == remembered_.end())
+            continue;
+
+        it->second->remember = false;
+        for (auto node = it->second; !is_null(node) && !node->dirty;
+            node = node->parent)
+            node->dirty = true;
+
+        remembered_.erase(it);
+    }
+}
+
+BC_POP_WARNING()
+
+} // namespace utreexo
+} // namespace system
+} // namespace libbitcoin
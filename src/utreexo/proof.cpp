@@ -0,0 +1,165 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/utreexo/proof.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/math/math.hpp>
+#include <bitcoin/system/utreexo/forest.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace utreexo {
+
+BC_PUSH_WARNING(NO_DYNAMIC_ARRAY_INDEXING)
+
+// Parents per row above which the row is hashed concurrently.
+constexpr size_t concurrent_parents = 1024;
+
+static bool is_before(const update& left, const update& right) NOEXCEPT
+{
+    return left.position < right.position;
+}
+
+// Hash the parent of each left node in row (indexed by lefts).
+static void hash_parents(updates& parents, const updates& row,
+    const positions& lefts, uint8_t forest_rows) NOEXCEPT
+{
+    parents.resize(lefts.size());
+    const auto hash = [&](size_t index) NOEXCEPT
+    {
+        const auto& left = row[lefts[index]];
+        const auto& right = row[add1(lefts[index])];
+        auto& out = parents[index];
+
+        out.position = parent(left.position, forest_rows);
+        out.prior = parent_hash(left.prior, right.prior);
+
+        // An empty (deleted) node is replaced by its sibling.
+        if (left.hash == empty_hash)
+            out.hash = right.hash;
+        else if (right.hash == empty_hash)
+            out.hash = left.hash;
+        else if (left.hash == left.prior && right.hash == right.prior)
+            out.hash = out.prior;
+        else
+            out.hash = parent_hash(left.hash, right.hash);
+    };
+
+    if (lefts.size() < concurrent_parents)
+    {
+        for (size_t index = 0; index < lefts.size(); ++index)
+            hash(index);
+
+        return;
+    }
+
+    std::for_each(poolstl::execution::par,
+        poolstl::iota_iter<size_t>(zero),
+        poolstl::iota_iter<size_t>(lefts.size()), hash);
+}
+
+bool compute(updates& out, const proof& proof, const hashes& targets,
+    uint64_t leaves, bool remove) NOEXCEPT
+{
+    out.clear();
+    const auto rows = tree_rows(leaves);
+    if (proof.targets.size() != targets.size() || rows >= sub1(bits<uint64_t>))
+        return false;
+
+    const auto proofs = get_proof_positions(positions{ proof.targets },
+        leaves, rows);
+
+    if (proofs.size() != proof.nodes.size())
+        return false;
+
+    updates given{};
+    given.reserve(targets.size() + proofs.size());
+    for (size_t index = 0; index < targets.size(); ++index)
+        given.push_back({ proof.targets[index], targets[index],
+            remove ? empty_hash : targets[index] });
+
+    for (size_t index = 0; index < proofs.size(); ++index)
+        given.push_back({ proofs[index], proof.nodes[index],
+            proof.nodes[index] });
+
+    // Positions are ascending by row, so rows are contiguous once sorted.
+    std::sort(given.begin(), given.end(), is_before);
+    const auto limit = sub1(bit_right<uint64_t>(add1<size_t>(rows)));
+    if (!given.empty() && given.back().position >= limit)
+        return false;
+
+    updates row{};
+    updates parents{};
+    positions lefts{};
+    auto next = given.begin();
+
+    for (uint8_t height = 0; height <= rows; ++height)
+    {
+        const auto end = std::find_if(next, given.end(),
+            [&](const update& node) NOEXCEPT
+            {
+                return detect_row(node.position, rows) != height;
+            });
+
+        row.clear();
+        std::merge(parents.begin(), parents.end(), next, end,
+            std::back_inserter(row), is_before);
+        next = end;
+
+        // Each node that is not a root requires its sibling (to its right).
+        lefts.clear();
+        for (size_t index = 0; index < row.size(); ++index)
+        {
+            const auto position = row[index].position;
+            if (is_root_position(position, leaves, rows))
+                continue;
+
+            const auto sibling = add1(index);
+            if (sibling == row.size() ||
+                !is_right_sibling(position, row[sibling].position) ||
+                !is_left_niece(position))
+                return false;
+
+            lefts.push_back(index);
+            ++index;
+        }
+
+        // Duplicated positions are not siblings, but roots may be duplicated.
+        if (std::adjacent_find(row.begin(), row.end(),
+            [](const update& left, const update& right) NOEXCEPT
+            {
+                return left.position == right.position;
+            }) != row.end())
+            return false;
+
+        hash_parents(parents, row, lefts, rows);
+        out.insert(out.end(), row.begin(), row.end());
+    }
+
+    return parents.empty() && next == given.end();
+}
+
+BC_POP_WARNING()
+
+} // namespace utreexo
+} // namespace system
+} // namespace libbitcoin
@@ -0,0 +1,121 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/utreexo/stump.hpp>
+
+#include <utility>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/math/math.hpp>
+#include <bitcoin/system/utreexo/forest.hpp>
+#include <bitcoin/system/utreexo/proof.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace utreexo {
+
+BC_PUSH_WARNING(NO_DYNAMIC_ARRAY_INDEXING)
+
+stump::stump() NOEXCEPT
+  : leaves_{}, roots_{}
+{
+}
+
+stump::stump(uint64_t leaves, hashes&& roots) NOEXCEPT
+  : leaves_{ leaves }, roots_{ std::move(roots) }
+{
+    BC_ASSERT(roots_.size() == number_of_roots(leaves_));
+}
+
+// Properties.
+// ----------------------------------------------------------------------------
+
+uint64_t stump::leaves() const NOEXCEPT
+{
+    return leaves_;
+}
+
+const hashes& stump::roots() const NOEXCEPT
+{
+    return roots_;
+}
+
+// Methods.
+// ----------------------------------------------------------------------------
+
+bool stump::verify(const proof& proof, const hashes& targets) const NOEXCEPT
+{
+    updates nodes{};
+    return compute(nodes, proof, targets, leaves_, false) && is_proven(nodes);
+}
+
+bool stump::modify(const hashes& adds, const hashes& deletes,
+    const proof& proof) NOEXCEPT
+{
+    updates nodes{};
+    if (!compute(nodes, proof, deletes, leaves_, true) || !is_proven(nodes))
+        return false;
+
+    const auto rows = tree_rows(leaves_);
+    for (const auto& node: nodes)
+        if (is_root_position(node.position, leaves_, rows))
+            roots_[root_index(leaves_, detect_row(node.position, rows))] =
+                node.hash;
+
+    for (const auto& leaf: adds)
+        add(leaf);
+
+    return true;
+}
+
+// protected
+// ----------------------------------------------------------------------------
+
+bool stump::is_proven(const updates& nodes) const NOEXCEPT
+{
+    const auto rows = tree_rows(leaves_);
+    for (const auto& node: nodes)
+        if (is_root_position(node.position, leaves_, rows) &&
+            roots_[root_index(leaves_, detect_row(node.position, rows))] !=
+                node.prior)
+            return false;
+
+    return true;
+}
+
+// Merge the leaf with the roots of each populated row below it, empty roots
+// are absorbed (the leaf rises in their place).
+void stump::add(const node_hash& leaf) NOEXCEPT
+{
+    auto node = leaf;
+    for (auto leaves = leaves_; get_right(leaves); leaves = shift_right(leaves))
+    {
+        if (roots_.back() != empty_hash)
+            node = parent_hash(roots_.back(), node);
+
+        roots_.pop_back();
+    }
+
+    roots_.push_back(node);
+    ++leaves_;
+}
+
+BC_POP_WARNING()
+
+} // namespace utreexo
+} // namespace system
+} // namespace libbitcoin
@@ -0,0 +1,193 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/wallet/addresses/address_batch.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <bitcoin/system/chain/chain.hpp>
+#include <bitcoin/system/crypto/crypto.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+#include <bitcoin/system/radix/radix.hpp>
+#include <bitcoin/system/unicode/unicode.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace wallet {
+
+using namespace system::chain;
+
+constexpr auto base58check_size = add1(short_hash_size) + checksum_default_size;
+constexpr uint8_t version0 = 0;
+constexpr uint8_t version1 = 1;
+
+// [prefix:1][hash:20][checksum:4], base58.
+static std::string to_base58check(uint8_t prefix,
+    const data_slice& hash) NOEXCEPT
+{
+    return encode_base58(insert_checksum<base58check_size>(
+    {
+        to_array(prefix), hash
+    }));
+}
+
+// [version0:1][push_size_20:1][hash:20], the nested p2wpkh script.
+static short_hash to_nested_hash(const short_hash& key_hash) NOEXCEPT
+{
+    return bitcoin_short_hash(splice(
+        data_array<two>{ version0, short_hash_size }, key_hash));
+}
+
+static std::string to_string(const bech32_text& text) NOEXCEPT
+{
+    return { text.chars.data(), text.size };
+}
+
+// Base58 addresses are hashed and encoded in one concurrent pass.
+static string_list encode_base58_addresses(const compressed_list& keys,
+    address_type type, const address_prefixes& prefixes) NOEXCEPT
+{
+    string_list out(keys.size());
+    const auto nested = (type == address_type::p2sh_p2wpkh);
+    const auto prefix = nested ? prefixes.p2sh : prefixes.p2kh;
+
+    std::transform(poolstl::execution::par, keys.begin(), keys.end(),
+        out.begin(), [&](const ec_compressed& key) NOEXCEPT
+        {
+            const auto hash = bitcoin_short_hash(key);
+            return to_base58check(prefix, nested ? to_nested_hash(hash) : hash);
+        });
+
+    return out;
+}
+
+// Witness programs are derived concurrently and then bech32 encoded as a
+// batch, so that the prefix is checksummed once for all keys.
+static string_list encode_witness_addresses(const compressed_list& keys,
+    address_type type, const address_prefixes& prefixes) NOEXCEPT
+{
+    const auto count = keys.size();
+    const auto taproot = (type == address_type::p2tr);
+    const auto version = taproot ? version1 : version0;
+    std_vector<hash_digest> programs(count);
+    std_vector<bech32_witness> witnesses(count);
+
+    std::for_each(poolstl::execution::par, poolstl::iota_iter<size_t>(zero),
+        poolstl::iota_iter<size_t>(count), [&](size_t index) NOEXCEPT
+        {
+            const auto& key = keys.at(index);
+            auto& program = programs.at(index);
+            auto& witness = witnesses.at(index);
+            witness.version = version;
+
+            if (!taproot)
+            {
+                const auto hash = bitcoin_short_hash(key);
+                std::copy(hash.begin(), hash.end(), program.begin());
+                witness.program = data_slice(program.begin(),
+                    std::next(program.begin(), short_hash_size));
+                return;
+            }
+
+            // The internal key is the x coordinate of the point [bip86].
+            taproot::commitment commitment{};
+            const auto internal = slice<one, ec_compressed_size>(key);
+            if (taproot::commit(commitment, internal, {}))
+            {
+                program = commitment.output_key;
+                witness.program = program;
+            }
+        });
+
+    std_vector<bech32_text> texts{};
+    bech32_encode(texts, witnesses, prefixes.witness);
+
+    // An invalid taproot key has no program, and so no address.
+    string_list out(count);
+    std::for_each(poolstl::execution::par, poolstl::iota_iter<size_t>(zero),
+        poolstl::iota_iter<size_t>(count), [&](size_t index) NOEXCEPT
+        {
+            if (!witnesses.at(index).program.empty())
+                out.at(index) = to_string(texts.at(index));
+        });
+
+    return out;
+}
+
+string_list encode_addresses(const compressed_list& keys, address_type type,
+    const address_prefixes& prefixes) NOEXCEPT
+{
+    switch (type)
+    {
+        case address_type::p2pkh:
+        case address_type::p2sh_p2wpkh:
+            return encode_base58_addresses(keys, type, prefixes);
+        case address_type::p2wpkh:
+        case address_type::p2tr:
+            return encode_witness_addresses(keys, type, prefixes);
+        default:
+            return string_list(keys.size());
+    }
+}
+
+string_list encode_addresses(const scripts& scripts,
+    const address_prefixes& prefixes) NOEXCEPT
+{
+    string_list out(scripts.size());
+    std::transform(poolstl::execution::par, scripts.begin(), scripts.end(),
+        out.begin(), [&](const script& script) NOEXCEPT -> std::string
+        {
+            const auto& ops = script.ops();
+
+            if (script::is_pay_key_hash_pattern(ops))
+                return to_base58check(prefixes.p2kh, ops.at(2).data());
+
+            if (script::is_pay_script_hash_pattern(ops))
+                return to_base58check(prefixes.p2sh, ops.at(1).data());
+
+            if (script::is_witness_program_pattern(ops))
+            {
+                // The pattern requires a version of op_0 or op_1..op_16.
+                const auto& code = ops.front();
+                const auto version = code.is_positive() ?
+                    operation::opcode_to_positive(code.code()) : version0;
+                const auto& program = ops.at(1).data();
+
+                // Version zero programs are either key hash or script hash.
+                if (witness_address::parse_program(version, program, false) ==
+                    witness_address::program_type::invalid)
+                    return {};
+
+                bech32_chars chars{};
+                const auto size = bech32_encode(chars, version, program,
+                    prefixes.witness);
+                return { chars.data(), size };
+            }
+
+            return {};
+        });
+
+    return out;
+}
+
+} // namespace wallet
+} // namespace system
+} // namespace libbitcoin
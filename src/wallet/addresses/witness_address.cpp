@@ -254,14 +254,23 @@ witness_address::parse_result witness_address::parse_address(
     if (payload.length() > (one + program_maximum_length + checksum_length))
         return parse_result::payload_too_long;
 
-    base32_chunk checked;
-    if (!decode_base32(checked, payload))
+    // Payload size is limited above (by address and program lengths).
+    const auto is_base32 = [](char character) NOEXCEPT
+    {
+        return base32_value(character) != 0xff;
+    };
+
+    if (!std::all_of(payload.begin(), payload.end(), is_base32))
         return parse_result::payload_not_base32;
 
     // Verify the bech32 checksum and extract version and program.
-    if (!bech32_verify_checked(out_version, out_program, out_prefix, checked))
+    size_t size{};
+    bech32_bytes program{};
+    if (!bech32_decode(out_version, size, program, out_prefix, payload))
         return parse_result::checksum_invalid;
 
+    out_program.assign(program.begin(), std::next(program.begin(), size));
+
     // Rejects versions above 16.
     if (!is_valid_version(out_version))
         return parse_result::version_invalid;
@@ -391,6 +400,12 @@ std::string witness_address::encoded() const NOEXCEPT
     if (!(*this))
         return {};
 
+    // Prefix may be too long for the bech32 limit (not enforced here).
+    bech32_chars chars{};
+    const auto size = bech32_encode(chars, version_, program_, prefix_);
+    if (!is_zero(size))
+        return { chars.data(), size };
+
     const auto checked = bech32_build_checked(version_, program_, prefix_);
     return prefix_ + separator + encode_base32(checked);
 }
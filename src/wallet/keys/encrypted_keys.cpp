@@ -224,11 +224,9 @@ static bool create_public_key(encrypted_public& out_public,
     const auto prefix = parse_encrypted_public::prefix_factory(version);
     const auto hash = point_hash(point);
 
-    auto encrypted1 = xor_data<half>(hash, derived1);
-    aes256::encrypt(encrypted1, derived2);
-
-    auto encrypted2 = xor_offset<half, half, half>(hash, derived1);
-    aes256::encrypt(encrypted2, derived2);
+    // Both (independent) blocks are encrypted with one key expansion.
+    auto encrypted = xor_data<hash_size>(hash, derived1);
+    aes256::encrypt_ecb(encrypted, derived2);
 
     const auto sign = point_sign(point.front(), derived2);
     out_public = insert_checksum<encrypted_public_decoded_size>(
@@ -238,8 +236,7 @@ static bool create_public_key(encrypted_public& out_public,
         salt,
         entropy,
         sign,
-        encrypted1,
-        encrypted2
+        encrypted
     });
 
     return true;
@@ -370,19 +367,16 @@ bool encrypt(encrypted_private& out_private, const ec_secret& secret,
     const auto prefix = parse_encrypted_private::prefix_factory(version,
         false);
 
-    auto encrypted1 = xor_data<half>(secret, derived.first);
-    aes256::encrypt(encrypted1, derived.second);
-
-    auto encrypted2 = xor_offset<half, half, half>(secret, derived.first);
-    aes256::encrypt(encrypted2, derived.second);
+    // Both (independent) blocks are encrypted with one key expansion.
+    auto encrypted = xor_data<hash_size>(secret, derived.first);
+    aes256::encrypt_ecb(encrypted, derived.second);
 
     out_private = insert_checksum<ek_private_decoded_size>(
     {
         prefix,
         set_flags(compressed),
         salt,
-        encrypted1,
-        encrypted2
+        encrypted
     });
 
     return true;
@@ -434,15 +428,12 @@ static bool decrypt_secret(ec_secret& out_secret,
     const parse_encrypted_private& parse,
     const std::string& passphrase) NOEXCEPT
 {
-    auto encrypt1 = splice(parse.entropy(), parse.data1());
-    auto encrypt2 = parse.data2();
+    auto encrypted = splice(parse.entropy(), parse.data1(), parse.data2());
     const auto derived = split(scrypt_private(normal(passphrase),
         parse.salt()));
 
-    aes256::decrypt(encrypt1, derived.second);
-    aes256::decrypt(encrypt2, derived.second);
-
-    const auto encrypted = splice(encrypt1, encrypt2);
+    // Both (independent) blocks are decrypted with one key expansion.
+    aes256::decrypt_ecb(encrypted, derived.second);
     const auto secret = xor_data<hash_size>(encrypted, derived.first);
 
     const auto compressed = parse.compressed();
@@ -498,16 +489,14 @@ bool decrypt(ec_compressed& out_point, uint8_t& out_version,
 
     const auto salt_entropy = splice(parse.salt(), parse.entropy());
     const auto derived = split(scrypt_pair(point, salt_entropy));
-    auto encrypt = split(parse.data());
-
-    aes256::decrypt(encrypt.first, derived.second);
-    const auto decrypt1 = xor_data<half>(encrypt.first, derived.first);
+    auto encrypt = parse.data();
 
-    aes256::decrypt(encrypt.second, derived.second);
-    const auto decrypt2 = xor_offset<half, zero, half>(encrypt.second, derived.first);
+    // Both (independent) blocks are decrypted with one key expansion.
+    aes256::decrypt_ecb(encrypt, derived.second);
+    const auto decrypt = xor_data<hash_size>(encrypt, derived.first);
 
     const auto sign_byte = point_sign(parse.sign(), derived.second);
-    auto product = splice(sign_byte, decrypt1, decrypt2);
+    auto product = splice(sign_byte, decrypt);
     if (!ec_multiply(product, factor))
         return false;
 
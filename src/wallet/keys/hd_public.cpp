@@ -30,6 +30,7 @@
  */
 #include <bitcoin/system/wallet/keys/hd_public.hpp>
 
+#include <iterator>
 #include <bitcoin/system/crypto/crypto.hpp>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
@@ -240,6 +241,50 @@ hd_public hd_public::derive_public(uint32_t index) const NOEXCEPT
     return { child, intermediate.second, lineage };
 }
 
+bool hd_public::derive_children(hd_children& out, uint32_t first,
+    size_t count) const NOEXCEPT
+{
+    out.clear();
+    if (!valid_ || lineage_.depth == max_uint8)
+        return false;
+
+    if (first >= hd_first_hardened_key ||
+        count > (hd_first_hardened_key - first))
+        return false;
+
+    // The keyed hmac is copied for each index, avoiding the rehash of the
+    // chain code pads. The message (point || index) is always one block.
+    const hmac<sha512> keyed{ chain_ };
+    auto data = splice(point_, to_big_endian(first));
+    const auto serial = std::next(data.data(), ec_compressed_size);
+
+    auto index = first;
+    secret_list tweaks(count);
+    for (auto& tweak: tweaks)
+    {
+        unsafe_to_big_endian(serial, index++);
+        auto mac = keyed;
+        mac.write(data);
+        tweak = split(mac.flush()).first;
+    }
+
+    // The returned child keys Ki are point(parse256(IL)) + Kpar.
+    compressed_list points;
+    if (!ec_add(points, point_, tweaks))
+        return false;
+
+    out.resize(count);
+    auto child = out.begin();
+    for (const auto& point: points)
+    {
+        child->point = point;
+        child->hash = bitcoin_short_hash(point);
+        ++child;
+    }
+
+    return true;
+}
+
 // Helpers.
 // ----------------------------------------------------------------------------
 
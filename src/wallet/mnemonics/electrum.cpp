@@ -30,6 +30,8 @@
  */
 #include <bitcoin/system/wallet/mnemonics/electrum.hpp>
 
+#include <algorithm>
+#include <iterator>
 #include <bitcoin/system/crypto/crypto.hpp>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/hash/hash.hpp>
@@ -62,6 +64,9 @@ static const auto version_two_factor_authentication = "101";
 static const auto version_two_factor_authentication_witness = "102";
 static const auto version_none = "none";
 
+// Grinding candidates evaluated concurrently per pass.
+constexpr size_t grind_batch = 64;
+
 // 2^11 = 2048 implies 11 bits exactly indexes every possible dictionary word.
 static const auto index_bits = narrow_cast<uint8_t>(floored_log2(
     electrum::dictionary::size()));
@@ -72,17 +77,28 @@ static const auto index_bits = narrow_cast<uint8_t>(floored_log2(
 const electrum::dictionaries electrum::dictionaries_
 {
     {
-        electrum::dictionary{ language::en, words::electrum::en },
-        electrum::dictionary{ language::es, words::electrum::es },
-        electrum::dictionary{ language::it, words::electrum::it },
-        electrum::dictionary{ language::fr, words::electrum::fr },
-        electrum::dictionary{ language::cs, words::electrum::cs },
-        electrum::dictionary{ language::pt, words::electrum::pt },
-        electrum::dictionary{ language::ja, words::electrum::ja },
-        electrum::dictionary{ language::ko, words::electrum::ko },
-        electrum::dictionary{ language::zh_Hans, words::electrum::zh_Hans },
-        electrum::dictionary{ language::zh_Hant, words::electrum::zh_Hant }
-    }
+        electrum::dictionary{ language::en, words::electrum::en,
+            words::electrum::en_hash },
+        electrum::dictionary{ language::es, words::electrum::es,
+            words::electrum::es_hash },
+        electrum::dictionary{ language::it, words::electrum::it,
+            words::electrum::it_hash },
+        electrum::dictionary{ language::fr, words::electrum::fr,
+            words::electrum::fr_hash },
+        electrum::dictionary{ language::cs, words::electrum::cs,
+            words::electrum::cs_hash },
+        electrum::dictionary{ language::pt, words::electrum::pt,
+            words::electrum::pt_hash },
+        electrum::dictionary{ language::ja, words::electrum::ja,
+            words::electrum::ja_hash },
+        electrum::dictionary{ language::ko, words::electrum::ko,
+            words::electrum::ko_hash },
+        electrum::dictionary{ language::zh_Hans, words::electrum::zh_Hans,
+            words::electrum::zh_Hans_hash },
+        electrum::dictionary{ language::zh_Hant, words::electrum::zh_Hant,
+            words::electrum::zh_Hant_hash }
+    },
+    words::electrum::hashes
 };
 
 // protected static (coders)
@@ -118,9 +134,7 @@ data_chunk electrum::decoder(const string_list& words,
 electrum::grinding electrum::grinder(const data_chunk& entropy,
     seed_prefix prefix, language identifier, size_t limit) NOEXCEPT
 {
-    string_list words;
     data_chunk hash(entropy);
-    const auto start = limit;
 
     // Remove unusable entropy bytes.
     const auto entropy_size = usable_size(hash);
@@ -129,41 +143,89 @@ electrum::grinding electrum::grinder(const data_chunk& entropy,
     // Create a byte mask for zeroizing entropy pad bits.
     const auto padding_mask = 0xff << unused_bits(hash);
 
-    // This just grinds away until exhausted or prefix found.
-    // Previously-discovered entropy round-trips, matching on the first pass.
-    do
+    // Normalize entropy to the wordlist by managing its pad bits.
+    // Electrum pads to the left, but entropy is a private format for
+    // electrum and public for bip39, so we use the bip39/mnemonic format.
+    // This results in any electrum entropy/prefix value producing the same
+    // words as that same entropy/checksum value in bip39/mnemonic.
+    hash[sub1(entropy_size)] &= padding_mask;
+
+    // Candidate evaluation is independent of all other candidates.
+    const auto evaluate = [=](const data_chunk& candidate) NOEXCEPT
     {
-        // Normalize entropy to the wordlist by managing its pad bits.
-        // Electrum pads to the left, but entropy is a private format for
-        // electrum and public for bip39, so we use the bip39/mnemonic format.
-        // This results in any electrum entropy/prefix value producing the same
-        // words as that same entropy/checksum value in bip39/mnemonic.
-        hash[sub1(entropy_size)] &= padding_mask;
-        words = encoder(hash, identifier);
+        auto words = encoder(candidate, identifier);
 
         // Avoid collisions with Electrum v1 (en) and BIP39 mnemonics.
         // Run validator first because conflict checks can be costly.
         if (validator(words, prefix) && !is_conflict(words))
-            return { hash, words, start - limit };
+            return words;
 
-        // This replaces Electrum's prng with determinism.
-        hash = to_chunk(sha512_hash(hash));
-        hash.resize(entropy_size);
+        return string_list{};
+    };
+
+    // Previously-discovered entropy round-trips, matching on the first pass.
+    auto words = evaluate(hash);
+    if (!words.empty())
+        return { hash, words, zero };
+
+    // This grinds away in batches until exhausted or prefix found. Candidates
+    // are a hash chain, so they are generated sequentially (cheap) and then
+    // evaluated concurrently (costly). The first match in the first matching
+    // batch is the match that a sequential search would find.
+    std_vector<data_chunk> batch{};
+    std_vector<string_list> found{};
+    for (auto remaining = limit; !is_zero(remaining);)
+    {
+        const auto count = std::min(grind_batch, remaining);
+        batch.resize(count);
+        found.resize(count);
+
+        for (auto& candidate: batch)
+        {
+            // This replaces Electrum's prng with determinism.
+            hash = to_chunk(sha512_hash(hash));
+            hash.resize(entropy_size);
+            hash[sub1(entropy_size)] &= padding_mask;
+            candidate = hash;
+        }
+
+        std::transform(poolstl::execution::par, batch.begin(), batch.end(),
+            found.begin(), evaluate);
+
+        const auto match = std::find_if(found.begin(), found.end(),
+            [](const string_list& candidate) NOEXCEPT
+            {
+                return !candidate.empty();
+            });
+
+        if (match != found.end())
+        {
+            const auto offset = possible_narrow_and_sign_cast<size_t>(
+                std::distance(found.begin(), match));
+            return { batch.at(offset), *match,
+                add1(limit - remaining) + offset };
+        }
+
+        remaining -= count;
     }
-    while (!is_zero(limit--));
 
-    return { {}, {}, start };
+    return { {}, {}, limit };
 }
 
 // This cannot match electrum_v1 or mnemonic.
 bool electrum::validator(const string_list& words, seed_prefix prefix) NOEXCEPT
 {
+    // The key is constant, so its pads are absorbed once and copied per call.
+    static const hmac<sha512> keyed{ "Seed version" };
+
     // Words are in normal (lower, nfkd) form, even without ICU.
     auto sentence = system::join(words);
     sentence = to_non_combining_form(sentence);
     sentence = to_compressed_form(sentence);
 
-    const auto seed = hmac<sha512>::code(sentence, "Seed version");
+    auto mac = keyed;
+    mac.write(sentence);
+    const auto seed = mac.flush();
     return starts_with(encode_base16(seed), to_version(prefix));
 }
 
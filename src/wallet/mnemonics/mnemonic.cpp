@@ -56,17 +56,28 @@ static const auto index_bits = narrow_cast<uint8_t>(
 const mnemonic::dictionaries mnemonic::dictionaries_
 {
     {
-        mnemonic::dictionary{ language::en, words::mnemonic::en },
-        mnemonic::dictionary{ language::es, words::mnemonic::es },
-        mnemonic::dictionary{ language::it, words::mnemonic::it },
-        mnemonic::dictionary{ language::fr, words::mnemonic::fr },
-        mnemonic::dictionary{ language::cs, words::mnemonic::cs },
-        mnemonic::dictionary{ language::pt, words::mnemonic::pt },
-        mnemonic::dictionary{ language::ja, words::mnemonic::ja },
-        mnemonic::dictionary{ language::ko, words::mnemonic::ko },
-        mnemonic::dictionary{ language::zh_Hans, words::mnemonic::zh_Hans },
-        mnemonic::dictionary{ language::zh_Hant, words::mnemonic::zh_Hant }
-    }
+        mnemonic::dictionary{ language::en, words::mnemonic::en,
+            words::mnemonic::en_hash },
+        mnemonic::dictionary{ language::es, words::mnemonic::es,
+            words::mnemonic::es_hash },
+        mnemonic::dictionary{ language::it, words::mnemonic::it,
+            words::mnemonic::it_hash },
+        mnemonic::dictionary{ language::fr, words::mnemonic::fr,
+            words::mnemonic::fr_hash },
+        mnemonic::dictionary{ language::cs, words::mnemonic::cs,
+            words::mnemonic::cs_hash },
+        mnemonic::dictionary{ language::pt, words::mnemonic::pt,
+            words::mnemonic::pt_hash },
+        mnemonic::dictionary{ language::ja, words::mnemonic::ja,
+            words::mnemonic::ja_hash },
+        mnemonic::dictionary{ language::ko, words::mnemonic::ko,
+            words::mnemonic::ko_hash },
+        mnemonic::dictionary{ language::zh_Hans, words::mnemonic::zh_Hans,
+            words::mnemonic::zh_Hans_hash },
+        mnemonic::dictionary{ language::zh_Hant, words::mnemonic::zh_Hant,
+            words::mnemonic::zh_Hant_hash }
+    },
+    words::mnemonic::hashes
 };
 
 // protected static (coders)
@@ -34,6 +34,7 @@
 #include <bitcoin/system/wallet/neutrino.hpp>
 
 #include <algorithm>
+#include <iterator>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/filter/filter.hpp>
@@ -49,12 +50,11 @@ constexpr uint8_t golomb_bits = 19;
 constexpr uint64_t golomb_target_false_positive_rate = 784931;
 constexpr auto rate = golomb_target_false_positive_rate;
 
-bool compute_filter(data_chunk& out, const chain::block& block) NOEXCEPT
+// Invoke handler for each filter script, false if any prevout is missing.
+template <typename Handler>
+static bool for_each_script(const chain::block& block,
+    Handler&& handler) NOEXCEPT
 {
-    const auto hash = block.hash();
-    const auto key = to_siphash_key(slice<zero, to_half(hash_size)>(hash));
-    data_stack scripts{};
-
     for (const auto& tx: *block.transactions_ptr())
     {
         if (!tx->is_coinbase())
@@ -66,7 +66,7 @@ bool compute_filter(data_chunk& out, const chain::block& block) NOEXCEPT
 
                 const auto& script = input->prevout->script();
                 if (!script.ops().empty())
-                    scripts.push_back(script.to_data(false));
+                    handler(script);
             }
         }
 
@@ -77,18 +77,64 @@ bool compute_filter(data_chunk& out, const chain::block& block) NOEXCEPT
             const auto& script = output->script();
             if (!script.ops().empty() &&
                 !chain::script::is_pay_op_return_pattern(script.ops()))
-                scripts.push_back(script.to_data(false));
+                handler(script);
         }
     }
 
-    distinct(scripts);
+    return true;
+}
+
+bool compute_filter(data_chunk& out, const chain::block& block) NOEXCEPT
+{
+    // Scripts are serialized into one pooled buffer and the items are slices
+    // of it. The slice list is local, so it cannot outlive the buffer.
+    size_t size{};
+    size_t count{};
+    if (!for_each_script(block, [&](const chain::script& script) NOEXCEPT
+        {
+            size += script.serialized_size(false);
+            ++count;
+        }))
+        return false;
+
+    auto buffer = buffer_pool::local().get(size);
+    buffer->resize(size);
+
+    // Declared after the buffer, so destroyed before it returns to the pool.
+    std_vector<data_slice> items{};
+    items.reserve(count);
+
+    stream::out::fast sink(*buffer);
+    write::bytes::fast scripts(sink);
+    auto position = buffer->data();
+
+    for_each_script(block, [&](const chain::script& script) NOEXCEPT
+    {
+        const auto end = std::next(position, script.serialized_size(false));
+        script.to_data(scripts, false);
+        items.emplace_back(position, end);
+        position = end;
+    });
+
+    // Sort by value and remove duplicates (see distinct()).
+    std::sort(items.begin(), items.end(),
+        [](const data_slice& left, const data_slice& right) NOEXCEPT
+        {
+            return std::lexicographical_compare(left.begin(), left.end(),
+                right.begin(), right.end());
+        });
+
+    items.erase(std::unique(items.begin(), items.end()), items.end());
+
+    const auto hash = block.hash();
+    const auto key = to_siphash_key(slice<zero, to_half(hash_size)>(hash));
 
     // A vector (push) stream is used because the size is not known a-priori.
     stream::out::data stream(out);
     write::bits::ostream writer(stream);
 
-    writer.write_variable(scripts.size());
-    golomb::construct(writer, scripts, golomb_bits, key, rate);
+    writer.write_variable(items.size());
+    golomb::construct(writer, items, golomb_bits, key, rate);
     writer.flush();
     return !!writer;
 }
@@ -112,11 +158,13 @@ bool match_filter(const block_filter& filter,
     if (!reader)
         return false;
 
-    const auto target = script.to_data(false);
+    auto target = buffer_pool::local().get(script.serialized_size(false));
+    script.to_data(*target, false);
     const auto hash = slice<zero, to_half(hash_size)>(filter.hash);
     const auto key = to_siphash_key(hash);
 
-    return golomb::match_single(reader, target, set_size, key, golomb_bits, rate);
+    return golomb::match_single(reader, *target, set_size, key, golomb_bits,
+        rate);
 }
 
 bool match_filter(const block_filter& filter,
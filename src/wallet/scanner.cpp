@@ -0,0 +1,291 @@
+// © Licensed Authorship: Manuel J. Nieves (See LICENSE for terms)
+/*
+ * Copyright (c) 2008–2025 Manuel J. Nieves (a.k.a. Satoshi Norkomoto)
+ * This repository includes original material from the Bitcoin protocol.
+ *
+ * Redistribution requires this notice remain intact.
+ * Derivative works must state derivative status.
+ * Commercial use requires licensing.
+ *
+ * GPG Signed: B4EC 7343 AB0D BF24
+ * Contact: Fordamboy1@gmail.com
+ */
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/wallet/scanner.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <iterator>
+#include <bitcoin/system/chain/chain.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/endian/endian.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+#include <bitcoin/system/math/math.hpp>
+#include <bitcoin/system/wallet/addresses/payment_address.hpp>
+#include <bitcoin/system/wallet/addresses/witness_address.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace wallet {
+
+// Each screen probe consumes a distinct 64 bits of script hash entropy.
+constexpr size_t probes = 3;
+static_assert(probes * sizeof(uint64_t) <= hash_size);
+
+BC_PUSH_WARNING(NO_DYNAMIC_ARRAY_INDEXING)
+
+// Bit of the screen selected by the given probe of the script hash.
+static inline size_t screen_bit(const hash_digest& script_hash, size_t probe,
+    size_t mask) NOEXCEPT
+{
+    const auto entropy = std::next(script_hash.data(),
+        probe * sizeof(uint64_t));
+
+    return possible_narrow_cast<size_t>(
+        unsafe_from_little_endian<uint64_t>(entropy) & mask);
+}
+
+// Constructors.
+// ----------------------------------------------------------------------------
+
+scanner::scanner() NOEXCEPT
+  : hashes_{}, screen_{}, points_{}, indexed_(false)
+{
+}
+
+// Watch.
+// ----------------------------------------------------------------------------
+
+bool scanner::watch(const hash_digest& script_hash) NOEXCEPT
+{
+    hashes_.push_back(script_hash);
+    indexed_ = false;
+    return true;
+}
+
+bool scanner::watch(const chain::script& script) NOEXCEPT
+{
+    return script.is_valid() && watch(script.hash());
+}
+
+bool scanner::watch(const payment_address& address) NOEXCEPT
+{
+    return address && watch(address.output_script());
+}
+
+bool scanner::watch(const witness_address& address) NOEXCEPT
+{
+    return address && watch(address.script());
+}
+
+void scanner::watch(const chain::point& point) NOEXCEPT
+{
+    points_.insert(point);
+}
+
+size_t scanner::scripts() const NOEXCEPT
+{
+    return hashes_.size();
+}
+
+size_t scanner::points() const NOEXCEPT
+{
+    return points_.size();
+}
+
+// Scan.
+// ----------------------------------------------------------------------------
+
+void scanner::scan(matches& out, const chain::block& block) NOEXCEPT
+{
+    index();
+    out = payments(block);
+    retain(out, block);
+
+    // Spends follow retention, as outputs may be spent within their block.
+    merge(out, spends(block));
+}
+
+void scanner::scan(std_vector<matches>& out,
+    const chain::blocks& blocks) NOEXCEPT
+{
+    index();
+    out.resize(blocks.size());
+
+    // Payments are independent of all other blocks.
+    std::transform(poolstl::execution::par, blocks.begin(), blocks.end(),
+        out.begin(), [this](const chain::block& block) NOEXCEPT
+        {
+            return payments(block);
+        });
+
+    // Retention is cheap (matches only) and mutates the point set.
+    auto found = out.begin();
+    for (const auto& block: blocks)
+        retain(*found++, block);
+
+    // A block cannot spend an output of a later block, so all spends in the
+    // set may be matched against all outputs in the set.
+    std_vector<matches> spent(blocks.size());
+    std::transform(poolstl::execution::par, blocks.begin(), blocks.end(),
+        spent.begin(), [this](const chain::block& block) NOEXCEPT
+        {
+            return spends(block);
+        });
+
+    found = out.begin();
+    for (const auto& matches: spent)
+        merge(*found++, matches);
+}
+
+// protected
+// ----------------------------------------------------------------------------
+
+void scanner::index() NOEXCEPT
+{
+    if (indexed_)
+        return;
+
+    std::sort(hashes_.begin(), hashes_.end());
+    hashes_.erase(std::unique(hashes_.begin(), hashes_.end()), hashes_.end());
+
+    // The screen is a power of two bits, so that probes are masked.
+    const auto size = std::bit_ceil(std::max(bits<uint64_t>,
+        hashes_.size() * screen_bits));
+
+    screen_.assign(size / bits<uint64_t>, 0);
+    const auto mask = sub1(size);
+
+    for (const auto& hash: hashes_)
+    {
+        for (size_t probe = 0; probe < probes; ++probe)
+        {
+            const auto bit = screen_bit(hash, probe, mask);
+            screen_[bit / bits<uint64_t>] |= bit_right<uint64_t>(
+                bit % bits<uint64_t>);
+        }
+    }
+
+    indexed_ = true;
+}
+
+bool scanner::is_screened(const hash_digest& script_hash) const NOEXCEPT
+{
+    const auto mask = sub1(screen_.size() * bits<uint64_t>);
+
+    for (size_t probe = 0; probe < probes; ++probe)
+    {
+        const auto bit = screen_bit(script_hash, probe, mask);
+        if (!get_right(screen_[bit / bits<uint64_t>], bit % bits<uint64_t>))
+            return false;
+    }
+
+    return true;
+}
+
+bool scanner::is_watched(const hash_digest& script_hash) const NOEXCEPT
+{
+    return is_screened(script_hash) &&
+        std::binary_search(hashes_.begin(), hashes_.end(), script_hash);
+}
+
+scanner::matches scanner::payments(const chain::block& block) const NOEXCEPT
+{
+    matches out{};
+    if (hashes_.empty())
+        return out;
+
+    size_t position{};
+    for (const auto& tx: *block.transactions_ptr())
+    {
+        uint32_t index{};
+        for (const auto& output: *tx->outputs_ptr())
+        {
+            if (is_watched(output->script().hash()))
+                out.push_back({ position, index, false });
+
+            ++index;
+        }
+
+        ++position;
+    }
+
+    return out;
+}
+
+scanner::matches scanner::spends(const chain::block& block) const NOEXCEPT
+{
+    matches out{};
+    if (points_.empty())
+        return out;
+
+    size_t position{};
+    for (const auto& tx: *block.transactions_ptr())
+    {
+        if (!tx->is_coinbase())
+        {
+            uint32_t index{};
+            for (const auto& input: *tx->inputs_ptr())
+            {
+                if (points_.contains(input->point()))
+                    out.push_back({ position, index, true });
+
+                ++index;
+            }
+        }
+
+        ++position;
+    }
+
+    return out;
+}
+
+void scanner::retain(const matches& payments,
+    const chain::block& block) NOEXCEPT
+{
+    const auto& txs = *block.transactions_ptr();
+    for (const auto& payment: payments)
+        points_.emplace(txs[payment.position]->hash(false), payment.index);
+}
+
+// Both sets are in block order, so the spends are merged into place.
+// Within a transaction, payments (outputs) precede spends (inputs).
+void scanner::merge(matches& out, const matches& spends) NOEXCEPT
+{
+    const auto middle = out.size();
+    out.insert(out.end(), spends.begin(), spends.end());
+    std::inplace_merge(out.begin(), std::next(out.begin(), middle), out.end(),
+        [](const match& left, const match& right) NOEXCEPT
+        {
+            if (left.position != right.position)
+                return left.position < right.position;
+
+            if (left.spend != right.spend)
+                return right.spend;
+
+            return left.index < right.index;
+        });
+}
+
+BC_POP_WARNING()
+
+} // namespace wallet
+} // namespace system
+} // namespace libbitcoin
@@ -54,6 +54,62 @@ const catalog::words& ko = mnemonic::ko;
 const catalog::words& zh_Hans = mnemonic::zh_Hans;
 const catalog::words& zh_Hant = mnemonic::zh_Hant;
 
+// Electrum v2 word lists share the BIP39 word list hashes.
+const catalog::hash& en_hash() NOEXCEPT
+{
+    return mnemonic::en_hash();
+}
+
+const catalog::hash& es_hash() NOEXCEPT
+{
+    return mnemonic::es_hash();
+}
+
+const catalog::hash& it_hash() NOEXCEPT
+{
+    return mnemonic::it_hash();
+}
+
+const catalog::hash& fr_hash() NOEXCEPT
+{
+    return mnemonic::fr_hash();
+}
+
+const catalog::hash& cs_hash() NOEXCEPT
+{
+    return mnemonic::cs_hash();
+}
+
+const catalog::hash& pt_hash() NOEXCEPT
+{
+    return mnemonic::pt_hash();
+}
+
+const catalog::hash& ja_hash() NOEXCEPT
+{
+    return mnemonic::ja_hash();
+}
+
+const catalog::hash& ko_hash() NOEXCEPT
+{
+    return mnemonic::ko_hash();
+}
+
+const catalog::hash& zh_Hans_hash() NOEXCEPT
+{
+    return mnemonic::zh_Hans_hash();
+}
+
+const catalog::hash& zh_Hant_hash() NOEXCEPT
+{
+    return mnemonic::zh_Hant_hash();
+}
+
+const catalogs::hashes& hashes() NOEXCEPT
+{
+    return mnemonic::hashes();
+}
+
 } // namespace electrum
 } // namespace words
 } // namespace system
@@ -3303,6 +3303,40 @@ const catalog::words pt
     }
 };
 
+// Word list hashes.
+// ----------------------------------------------------------------------------
+// Hash construction is constexpr, but its evaluation exceeds the constexpr
+// step limits of common compilers, so each hash is created on first use.
+
+const catalog::hash& en_hash() NOEXCEPT
+{
+    static const catalog::hash hash{ en.word };
+    return hash;
+}
+
+const catalog::hash& pt_hash() NOEXCEPT
+{
+    static const catalog::hash hash{ pt.word };
+    return hash;
+}
+
+const catalogs::hashes& hashes() NOEXCEPT
+{
+    static const catalogs::hashes hashes
+    {
+        {
+            &en.word,
+            &pt.word
+        },
+        {
+            &en_hash(),
+            &pt_hash()
+        }
+    };
+
+    return hashes;
+}
+
 } // namespace electrum_v1
 } // namespace words
 } // namespace system
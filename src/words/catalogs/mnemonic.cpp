@@ -20588,6 +20588,104 @@ const catalog::words zh_Hant
     }
 };
 
+// Word list hashes.
+// ----------------------------------------------------------------------------
+// Hash construction is constexpr, but its evaluation exceeds the constexpr
+// step limits of common compilers, so each hash is created on first use.
+
+const catalog::hash& en_hash() NOEXCEPT
+{
+    static const catalog::hash hash{ en.word };
+    return hash;
+}
+
+const catalog::hash& es_hash() NOEXCEPT
+{
+    static const catalog::hash hash{ es.word };
+    return hash;
+}
+
+const catalog::hash& it_hash() NOEXCEPT
+{
+    static const catalog::hash hash{ it.word };
+    return hash;
+}
+
+const catalog::hash& fr_hash() NOEXCEPT
+{
+    static const catalog::hash hash{ fr.word };
+    return hash;
+}
+
+const catalog::hash& cs_hash() NOEXCEPT
+{
+    static const catalog::hash hash{ cs.word };
+    return hash;
+}
+
+const catalog::hash& pt_hash() NOEXCEPT
+{
+    static const catalog::hash hash{ pt.word };
+    return hash;
+}
+
+const catalog::hash& ja_hash() NOEXCEPT
+{
+    static const catalog::hash hash{ ja.word };
+    return hash;
+}
+
+const catalog::hash& ko_hash() NOEXCEPT
+{
+    static const catalog::hash hash{ ko.word };
+    return hash;
+}
+
+const catalog::hash& zh_Hans_hash() NOEXCEPT
+{
+    static const catalog::hash hash{ zh_Hans.word };
+    return hash;
+}
+
+const catalog::hash& zh_Hant_hash() NOEXCEPT
+{
+    static const catalog::hash hash{ zh_Hant.word };
+    return hash;
+}
+
+const catalogs::hashes& hashes() NOEXCEPT
+{
+    static const catalogs::hashes hashes
+    {
+        {
+            &en.word,
+            &es.word,
+            &it.word,
+            &fr.word,
+            &cs.word,
+            &pt.word,
+            &ja.word,
+            &ko.word,
+            &zh_Hans.word,
+            &zh_Hant.word
+        },
+        {
+            &en_hash(),
+            &es_hash(),
+            &it_hash(),
+            &fr_hash(),
+            &cs_hash(),
+            &pt_hash(),
+            &ja_hash(),
+            &ko_hash(),
+            &zh_Hans_hash(),
+            &zh_Hant_hash()
+        }
+    };
+
+    return hashes;
+}
+
 } // namespace mnemonic
 } // namespace words
 } // namespace system
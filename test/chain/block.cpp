@@ -361,6 +361,205 @@ BOOST_AUTO_TEST_CASE(block__constructor__reader__success)
     BOOST_REQUIRE(!block.is_invalid_merkle_root());
 }
 
+// deserialize
+// ----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(block__deserialize__mainnet_genesis__success_expected)
+{
+    const auto genesis = settings(selection::mainnet).genesis_block;
+    const auto data = genesis.to_data(true);
+    stream::in::copy stream(data);
+
+    size_t calls{};
+    block::cptr out{};
+    const auto ec = block::deserialize(out, stream, true,
+        [&](const transaction::cptr& tx) NOEXCEPT
+        {
+            ++calls;
+            BOOST_REQUIRE_EQUAL(tx->hash(false), hash2);
+            return error::block_success;
+        });
+
+    BOOST_REQUIRE_EQUAL(ec, error::block_success);
+    BOOST_REQUIRE_EQUAL(calls, 1u);
+    BOOST_REQUIRE(out);
+    BOOST_REQUIRE(out->is_valid());
+    BOOST_REQUIRE(*out == genesis);
+    BOOST_REQUIRE_EQUAL(out->hash(), hash1);
+}
+
+BOOST_AUTO_TEST_CASE(block__deserialize__reader_no_handler__success)
+{
+    const auto genesis = settings(selection::testnet).genesis_block;
+    const auto data = genesis.to_data(true);
+    read::bytes::copy source(data);
+
+    block::cptr out{};
+    BOOST_REQUIRE_EQUAL(block::deserialize(out, source, true), error::block_success);
+    BOOST_REQUIRE(out);
+    BOOST_REQUIRE(*out == genesis);
+}
+
+BOOST_AUTO_TEST_CASE(block__deserialize__truncated__malformed_block)
+{
+    const auto genesis = settings(selection::mainnet).genesis_block;
+    auto data = genesis.to_data(true);
+    data.resize(sub1(data.size()));
+    read::bytes::copy source(data);
+
+    block::cptr out{};
+    BOOST_REQUIRE_EQUAL(block::deserialize(out, source, true), error::malformed_block);
+    BOOST_REQUIRE(!out);
+}
+
+BOOST_AUTO_TEST_CASE(block__deserialize__empty__malformed_block)
+{
+    read::bytes::copy source(data_chunk{});
+    block::cptr out{};
+    BOOST_REQUIRE_EQUAL(block::deserialize(out, source, true), error::malformed_block);
+    BOOST_REQUIRE(!out);
+}
+
+BOOST_AUTO_TEST_CASE(block__deserialize__no_transactions__empty_block)
+{
+    // The merkle root of no transactions is null, as is that of the header.
+    const block instance{ header{}, transactions{} };
+    const auto data = instance.to_data(true);
+    read::bytes::copy source(data);
+
+    size_t calls{};
+    block::cptr out{};
+    const auto ec = block::deserialize(out, source, true,
+        [&](const transaction::cptr&) NOEXCEPT
+        {
+            ++calls;
+            return error::block_success;
+        });
+
+    BOOST_REQUIRE_EQUAL(ec, error::empty_block);
+    BOOST_REQUIRE_EQUAL(ec, instance.check());
+    BOOST_REQUIRE_EQUAL(calls, 0u);
+    BOOST_REQUIRE(!out);
+}
+
+BOOST_AUTO_TEST_CASE(block__deserialize__handler_error__aborted)
+{
+    const auto genesis = settings(selection::mainnet).genesis_block;
+    const auto data = genesis.to_data(true);
+    read::bytes::copy source(data);
+
+    block::cptr out{};
+    const auto ec = block::deserialize(out, source, true,
+        [](const transaction::cptr&) NOEXCEPT
+        {
+            return error::block_non_final;
+        });
+
+    BOOST_REQUIRE_EQUAL(ec, error::block_non_final);
+    BOOST_REQUIRE(!out);
+}
+
+BOOST_AUTO_TEST_CASE(block__deserialize__extra_coinbases__aborted_as_check)
+{
+    const auto genesis = settings(selection::mainnet).genesis_block;
+    const auto& coinbase = *genesis.transactions_ptr()->front();
+    const block instance{ genesis.header(), { coinbase, coinbase, coinbase } };
+    const auto data = instance.to_data(true);
+    read::bytes::copy source(data);
+
+    size_t calls{};
+    block::cptr out{};
+    const auto ec = block::deserialize(out, source, true,
+        [&](const transaction::cptr&) NOEXCEPT
+        {
+            ++calls;
+            return error::block_success;
+        });
+
+    BOOST_REQUIRE_EQUAL(ec, error::extra_coinbases);
+    BOOST_REQUIRE_EQUAL(ec, instance.check());
+    BOOST_REQUIRE_EQUAL(calls, 1u);
+    BOOST_REQUIRE(!out);
+}
+
+BOOST_AUTO_TEST_CASE(block__deserialize__first_not_coinbase__aborted_as_check)
+{
+    const auto genesis = settings(selection::mainnet).genesis_block;
+    const auto& coinbase = *genesis.transactions_ptr()->front();
+    const transaction spend
+    {
+        1,
+        inputs{ input{ point{ hash2, 0 }, script{}, witness{}, 0 } },
+        outputs{ output{ 42, script{} } },
+        0
+    };
+
+    const block instance{ genesis.header(), { spend, coinbase } };
+    const auto data = instance.to_data(true);
+    read::bytes::copy source(data);
+
+    size_t calls{};
+    block::cptr out{};
+    const auto ec = block::deserialize(out, source, true,
+        [&](const transaction::cptr&) NOEXCEPT
+        {
+            ++calls;
+            return error::block_success;
+        });
+
+    BOOST_REQUIRE_EQUAL(ec, error::first_not_coinbase);
+    BOOST_REQUIRE_EQUAL(ec, instance.check());
+    BOOST_REQUIRE_EQUAL(calls, 0u);
+    BOOST_REQUIRE(!out);
+}
+
+BOOST_AUTO_TEST_CASE(block__deserialize__oversized__block_size_limit)
+{
+    const auto genesis = settings(selection::mainnet).genesis_block;
+    const auto& coinbase = *genesis.transactions_ptr()->front();
+    const output big{ 42, script{ { { data_chunk(5'000, 0x42), false } } } };
+    const transaction spend
+    {
+        1,
+        inputs{ input{ point{ hash2, 0 }, script{}, witness{}, 0 } },
+        outputs(200, big),
+        0
+    };
+
+    const block instance{ genesis.header(), { coinbase, spend } };
+    BOOST_REQUIRE_GT(instance.serialized_size(false), max_block_size);
+    const auto data = instance.to_data(true);
+    read::bytes::copy source(data);
+
+    block::cptr out{};
+    const auto ec = block::deserialize(out, source, true);
+    BOOST_REQUIRE_EQUAL(ec, error::block_size_limit);
+    BOOST_REQUIRE_EQUAL(ec, instance.check());
+    BOOST_REQUIRE(!out);
+}
+
+BOOST_AUTO_TEST_CASE(block__deserialize__invalid_merkle_root__as_check)
+{
+    const auto genesis = settings(selection::mainnet).genesis_block;
+    const block instance{ header{}, { *genesis.transactions_ptr()->front() } };
+    const auto data = instance.to_data(true);
+    read::bytes::copy source(data);
+
+    size_t calls{};
+    block::cptr out{};
+    const auto ec = block::deserialize(out, source, true,
+        [&](const transaction::cptr&) NOEXCEPT
+        {
+            ++calls;
+            return error::block_success;
+        });
+
+    BOOST_REQUIRE_EQUAL(ec, error::invalid_transaction_commitment);
+    BOOST_REQUIRE_EQUAL(ec, instance.check());
+    BOOST_REQUIRE_EQUAL(calls, 1u);
+    BOOST_REQUIRE(!out);
+}
+
 // operators
 // ----------------------------------------------------------------------------
 
@@ -416,6 +615,13 @@ BOOST_AUTO_TEST_CASE(block__to_data__data__expected)
     BOOST_REQUIRE_EQUAL(size, expected_block::get().serialized_size(true));
 }
 
+BOOST_AUTO_TEST_CASE(block__to_data__chunk__expected)
+{
+    auto data = buffer_pool::local().get(zero);
+    expected_block::get().to_data(*data, true);
+    BOOST_REQUIRE_EQUAL(*data, expected_block::data());
+}
+
 BOOST_AUTO_TEST_CASE(block__to_data__stream__expected)
 {
     // Write block to stream.
@@ -0,0 +1,190 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(block_file_tests)
+
+using namespace system::chain;
+
+constexpr uint32_t magic = 0xd9b4bef9;
+
+static data_chunk get_genesis()
+{
+    return settings(selection::mainnet).genesis_block.to_data(true);
+}
+
+static data_chunk get_record(const data_chunk& block, uint32_t magic_value,
+    uint32_t size)
+{
+    data_chunk out{};
+    extend(out, to_little_endian(magic_value));
+    extend(out, to_little_endian(size));
+    extend(out, block);
+    return out;
+}
+
+static data_chunk get_records(size_t count)
+{
+    const auto genesis = get_genesis();
+    const auto record = get_record(genesis,
+        magic, possible_narrow_cast<uint32_t>(genesis.size()));
+
+    data_chunk out{};
+    for (size_t index = 0; index < count; ++index)
+        extend(out, record);
+
+    return out;
+}
+
+// next
+
+BOOST_AUTO_TEST_CASE(block_file__next__empty__false_valid)
+{
+    const data_chunk data{};
+    block_file instance{ data, magic };
+    data_slice slice{};
+    BOOST_REQUIRE(!instance.next(slice));
+    BOOST_REQUIRE(instance.is_valid());
+    BOOST_REQUIRE_EQUAL(instance.position(), zero);
+}
+
+BOOST_AUTO_TEST_CASE(block_file__next__records__expected_slices)
+{
+    const auto genesis = get_genesis();
+    const auto data = get_records(3);
+    block_file instance{ data, magic };
+
+    data_slice slice{};
+    for (size_t index = 0; index < 3; ++index)
+    {
+        BOOST_REQUIRE(instance.next(slice));
+        BOOST_REQUIRE_EQUAL(slice.size(), genesis.size());
+        BOOST_REQUIRE(slice == genesis);
+    }
+
+    BOOST_REQUIRE(!instance.next(slice));
+    BOOST_REQUIRE(instance.is_valid());
+    BOOST_REQUIRE_EQUAL(instance.position(), data.size());
+}
+
+BOOST_AUTO_TEST_CASE(block_file__next__zero_padding__false_valid)
+{
+    auto data = get_records(2);
+    const auto records = data.size();
+    data.resize(records + 1000, 0x00);
+    block_file instance{ data, magic };
+
+    data_slice slice{};
+    BOOST_REQUIRE(instance.next(slice));
+    BOOST_REQUIRE(instance.next(slice));
+    BOOST_REQUIRE(!instance.next(slice));
+    BOOST_REQUIRE(instance.is_valid());
+    BOOST_REQUIRE_EQUAL(instance.position(), data.size());
+}
+
+BOOST_AUTO_TEST_CASE(block_file__next__wrong_magic__false_invalid)
+{
+    const auto data = get_records(1);
+    block_file instance{ data, 0x0709110b };
+    data_slice slice{};
+    BOOST_REQUIRE(!instance.next(slice));
+    BOOST_REQUIRE(!instance.is_valid());
+    BOOST_REQUIRE_EQUAL(instance.position(), zero);
+}
+
+BOOST_AUTO_TEST_CASE(block_file__next__truncated_record__false_invalid)
+{
+    const auto genesis = get_genesis();
+    auto data = get_records(1);
+    extend(data, get_record(genesis, magic,
+        possible_narrow_cast<uint32_t>(add1(genesis.size()))));
+
+    block_file instance{ data, magic };
+    data_slice slice{};
+    BOOST_REQUIRE(instance.next(slice));
+    BOOST_REQUIRE(!instance.next(slice));
+    BOOST_REQUIRE(!instance.is_valid());
+    BOOST_REQUIRE_EQUAL(instance.position(), data.size() / two);
+}
+
+// decode
+
+BOOST_AUTO_TEST_CASE(block_file__decode__records__expected_blocks_in_order)
+{
+    const auto genesis = settings(selection::mainnet).genesis_block;
+    const auto data = get_records(10);
+    block_file instance{ data, magic };
+
+    size_t count{};
+    BOOST_REQUIRE(instance.decode([&](const block::cptr& block)
+    {
+        ++count;
+        return block->is_valid() && (*block == genesis);
+    }, true, 3));
+
+    BOOST_REQUIRE_EQUAL(count, 10u);
+    BOOST_REQUIRE(instance.is_valid());
+}
+
+BOOST_AUTO_TEST_CASE(block_file__decode__zero_read_ahead__expected_blocks)
+{
+    const auto data = get_records(2);
+    block_file instance{ data, magic };
+
+    size_t count{};
+    BOOST_REQUIRE(instance.decode([&](const block::cptr&)
+    {
+        return ++count, true;
+    }, true, zero));
+
+    BOOST_REQUIRE_EQUAL(count, 2u);
+}
+
+BOOST_AUTO_TEST_CASE(block_file__decode__handler_false__stops)
+{
+    const auto data = get_records(10);
+    block_file instance{ data, magic };
+
+    size_t count{};
+    BOOST_REQUIRE(!instance.decode([&](const block::cptr&)
+    {
+        return ++count < 4u;
+    }, true, 3));
+
+    BOOST_REQUIRE_EQUAL(count, 4u);
+    BOOST_REQUIRE(instance.is_valid());
+}
+
+BOOST_AUTO_TEST_CASE(block_file__decode__malformed__false_after_preceding)
+{
+    auto data = get_records(5);
+    extend(data, data_chunk{ 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08 });
+    block_file instance{ data, magic };
+
+    size_t count{};
+    BOOST_REQUIRE(!instance.decode([&](const block::cptr&)
+    {
+        return ++count, true;
+    }, true, 2));
+
+    BOOST_REQUIRE_EQUAL(count, 5u);
+    BOOST_REQUIRE(!instance.is_valid());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
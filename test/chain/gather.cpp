@@ -0,0 +1,175 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(gather_tests)
+
+using namespace system::chain;
+
+static const transaction& get_transaction()
+{
+    static const transaction instance
+    {
+        2,
+        inputs
+        {
+            {
+                point{ base16_hash("0102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f20"), 7 },
+                script{ "[1.42] [4242] checksig" },
+                witness{ data_stack{ {}, { 0x01, 0x02 }, data_chunk(520, 0xab) } },
+                max_uint32
+            },
+            {
+                point{ null_hash, 42 },
+                script{ std_vector<operation>(100, operation{ data_chunk(75, 0x42) }) },
+                witness{},
+                0
+            }
+        },
+        outputs
+        {
+            { max_uint64, script{ "dup hash160 [0000000000000000000000000000000000000000] equalverify checksig" } },
+            { 0, script{} }
+        },
+        42
+    };
+
+    return instance;
+}
+
+static data_chunk to_data(const gather& instance)
+{
+    data_chunk out(instance.size());
+    BOOST_REQUIRE(instance.copy(out));
+    return out;
+}
+
+static size_t total(const gather& instance)
+{
+    const auto& parts = instance.parts();
+    return std::accumulate(parts.begin(), parts.end(), zero,
+        [](size_t sum, const data_slice& part) NOEXCEPT
+        {
+            return sum + part.size();
+        });
+}
+
+BOOST_AUTO_TEST_CASE(gather__copy__genesis_block__expected)
+{
+    const auto genesis = settings(selection::mainnet).genesis_block;
+    const gather instance{ genesis, true };
+    BOOST_REQUIRE_EQUAL(instance.size(), genesis.serialized_size(true));
+    BOOST_REQUIRE_EQUAL(total(instance), instance.size());
+    BOOST_REQUIRE_EQUAL(to_data(instance), genesis.to_data(true));
+}
+
+BOOST_AUTO_TEST_CASE(gather__copy__transaction__expected)
+{
+    const auto& tx = get_transaction();
+    BOOST_REQUIRE(tx.is_segregated());
+
+    const gather witnessed{ tx, true };
+    BOOST_REQUIRE_EQUAL(total(witnessed), witnessed.size());
+    BOOST_REQUIRE_EQUAL(to_data(witnessed), tx.to_data(true));
+
+    const gather nominal{ tx, false };
+    BOOST_REQUIRE_EQUAL(total(nominal), nominal.size());
+    BOOST_REQUIRE_EQUAL(to_data(nominal), tx.to_data(false));
+}
+
+BOOST_AUTO_TEST_CASE(gather__copy__wrong_size__false)
+{
+    const gather instance{ get_transaction(), true };
+    data_chunk out(add1(instance.size()));
+    BOOST_REQUIRE(!instance.copy(out));
+}
+
+BOOST_AUTO_TEST_CASE(gather__parts__deserialized_block__references_object)
+{
+    const block original
+    {
+        header{ 1, null_hash, null_hash, 2, 3, 4 },
+        transactions{ get_transaction(), get_transaction() }
+    };
+
+    const auto data = original.to_data(true);
+    const block instance{ data, true };
+    BOOST_REQUIRE(instance.is_valid());
+
+    const gather gathered{ instance, true };
+    BOOST_REQUIRE_EQUAL(to_data(gathered), data);
+
+    // The large script and witness element are referenced, not copied.
+    const auto& input = *instance.transactions_ptr()->front()->inputs_ptr();
+    const auto element = input.front()->witness().element(2);
+    const auto script = input.back()->script().retained();
+    BOOST_REQUIRE_GE(script.size(), gather::minimum_reference);
+
+    const auto& parts = gathered.parts();
+    const auto contains = [&](const data_slice& slice) NOEXCEPT
+    {
+        return std::any_of(parts.begin(), parts.end(),
+            [&](const data_slice& part) NOEXCEPT
+            {
+                return part.data() == slice.data() &&
+                    part.size() == slice.size();
+            });
+    };
+
+    BOOST_REQUIRE(contains(element));
+    BOOST_REQUIRE(contains(script));
+}
+
+BOOST_AUTO_TEST_CASE(gather__parts__constructed_script__not_referenced)
+{
+    // Scripts that are not deserialized retain no bytes.
+    const auto& input = *get_transaction().inputs_ptr()->back();
+    BOOST_REQUIRE(input.script().retained().empty());
+
+    // Only the large witness element of the first input is referenced.
+    const gather instance{ get_transaction(), true };
+    const auto& parts = instance.parts();
+    BOOST_REQUIRE_EQUAL(parts.size(), 3u);
+    BOOST_REQUIRE_EQUAL(parts.at(1).size(), 520u);
+}
+
+BOOST_AUTO_TEST_CASE(gather__parts__deserialized_block__no_empty_parts)
+{
+    const block original
+    {
+        header{ 1, null_hash, null_hash, 2, 3, 4 },
+        transactions{ get_transaction(), get_transaction() }
+    };
+
+    const auto data = original.to_data(true);
+    const block instance{ data, true };
+    const gather gathered{ instance, true };
+    const auto& parts = gathered.parts();
+
+    // Owned bytes between references coalesce into one part, never empty.
+    BOOST_REQUIRE(std::none_of(parts.begin(), parts.end(),
+        [](const data_slice& part) NOEXCEPT
+        {
+            return part.empty();
+        }));
+
+    BOOST_REQUIRE_EQUAL(total(gathered), gathered.size());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -220,6 +220,13 @@ BOOST_AUTO_TEST_CASE(header__to_data__data__expected)
     BOOST_REQUIRE_EQUAL(expected_header.serialized_size(), data.size());
 }
 
+BOOST_AUTO_TEST_CASE(header__to_data__chunk__expected)
+{
+    data_chunk data{ 0x42 };
+    expected_header.to_data(data);
+    BOOST_REQUIRE_EQUAL(data, expected_header.to_data());
+}
+
 BOOST_AUTO_TEST_CASE(header__to_data__stream__expected)
 {
     // Write header to stream.
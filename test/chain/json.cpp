@@ -0,0 +1,134 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(json_tests)
+
+namespace json = boost::json;
+using namespace system::chain;
+
+template <typename Object>
+static std::string dom(const Object& object)
+{
+    return json::serialize(json::value_from(object));
+}
+
+template <typename Object>
+static std::string streamed(const Object& object)
+{
+    std::string text{};
+    write::bytes::text sink(text);
+    to_json(sink, object);
+    sink.flush();
+    return text;
+}
+
+static script from_data(const data_chunk& data)
+{
+    stream::in::fast stream{ data };
+    return { stream, false };
+}
+
+static const transaction& get_transaction()
+{
+    static const transaction instance
+    {
+        42,
+        inputs
+        {
+            {
+                point{ base16_hash("0102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f20"), 7 },
+                script{ "[1.42] [4242] checksig" },
+                witness{ data_stack{ {}, { 0x01, 0x02 }, data_chunk(520, 0xab) } },
+                max_uint32
+            },
+            {
+                point{ null_hash, max_uint32 },
+
+                // Underflow (push_one_size without a size).
+                from_data(base16_chunk("004c")),
+                witness{},
+                0
+            }
+        },
+        outputs
+        {
+            { max_uint64, script{ "dup hash160 [0000000000000000000000000000000000000000] equalverify checksig" } },
+            { 0, script{} }
+        },
+        max_uint32
+    };
+
+    return instance;
+}
+
+BOOST_AUTO_TEST_CASE(json__to_json__genesis_block__dom_expected)
+{
+    const auto genesis = settings(selection::mainnet).genesis_block;
+    BOOST_REQUIRE_EQUAL(to_json(genesis), dom(genesis));
+    BOOST_REQUIRE_EQUAL(streamed(genesis.header()), dom(genesis.header()));
+}
+
+BOOST_AUTO_TEST_CASE(json__to_json__transaction__dom_expected)
+{
+    const auto& tx = get_transaction();
+    BOOST_REQUIRE(tx.is_valid());
+    BOOST_REQUIRE_EQUAL(to_json(tx), dom(tx));
+}
+
+BOOST_AUTO_TEST_CASE(json__to_json__elements__dom_expected)
+{
+    const auto& tx = get_transaction();
+    for (const auto& input: *tx.inputs_ptr())
+    {
+        BOOST_REQUIRE_EQUAL(streamed(*input), dom(*input));
+        BOOST_REQUIRE_EQUAL(streamed(input->point()), dom(input->point()));
+        BOOST_REQUIRE_EQUAL(streamed(input->script()), dom(input->script()));
+        BOOST_REQUIRE_EQUAL(streamed(input->witness()), dom(input->witness()));
+    }
+
+    for (const auto& output: *tx.outputs_ptr())
+        BOOST_REQUIRE_EQUAL(streamed(*output), dom(*output));
+}
+
+BOOST_AUTO_TEST_CASE(json__to_json__deserialized_block__dom_expected)
+{
+    const block instance
+    {
+        header{ 1, null_hash, null_hash, 2, 3, 4 },
+        transactions{ get_transaction(), get_transaction() }
+    };
+
+    // Deserialized witnesses are contiguous (not stacked).
+    const block copy{ instance.to_data(true), true };
+    BOOST_REQUIRE(copy.is_valid());
+    BOOST_REQUIRE_EQUAL(to_json(copy), dom(copy));
+}
+
+BOOST_AUTO_TEST_CASE(json__to_json__ostream__expected)
+{
+    const auto& tx = get_transaction();
+    std::ostringstream stream{};
+    write::bytes::ostream sink(stream);
+    to_json(sink, tx);
+    sink.flush();
+    BOOST_REQUIRE_EQUAL(stream.str(), dom(tx));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,584 @@
+// © Licensed Authorship: Manuel J. Nieves (See LICENSE for terms)
+/*
+ * Copyright (c) 2008–2025 Manuel J. Nieves (a.k.a. Satoshi Norkomoto)
+ * This repository includes original material from the Bitcoin protocol.
+ *
+ * Redistribution requires this notice remain intact.
+ * Derivative works must state derivative status.
+ * Commercial use requires licensing.
+ *
+ * GPG Signed: B4EC 7343 AB0D BF24
+ * Contact: Fordamboy1@gmail.com
+ */
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../../test.hpp"
+
+#if defined(HAVE_PERFORMANCE_TESTS)
+
+#include <atomic>
+#include <fstream>
+#if !defined(HAVE_MSC)
+#include <sys/resource.h>
+#endif
+
+// Chain-level benchmarks over a corpus of mainnet blocks in local files.
+// The corpus directory is set by BC_BLOCK_CORPUS (default "corpus") and
+// contains <height>_<label>.block files of witness-serialized blocks (e.g.
+// 481824_segwit.block). An optional <height>_<label>.prevouts file contains
+// the serialized outputs spent by the block's non-internal inputs (in block
+// order), without which accept/connect/compute_filter are not measured.
+// Results are written to std::cout as csv, one row per block per stage.
+// Synthetic witness deserialization and bulk address derivation are also
+// measured, without a corpus.
+
+using namespace bc::system::chain;
+
+constexpr size_t rounds = 5;
+
+// allocation counting
+// ----------------------------------------------------------------------------
+// Allocations are counted by a scoped arena, which forwards to the default
+// arena. Only objects deserialized through the arena are counted, so stages
+// that allocate outside of it report zero allocations.
+
+class counting_arena final
+  : public arena
+{
+public:
+    size_t allocations() const NOEXCEPT
+    {
+        return allocations_.load(std::memory_order_relaxed);
+    }
+
+    size_t allocated() const NOEXCEPT
+    {
+        return allocated_.load(std::memory_order_relaxed);
+    }
+
+    void* start(size_t) THROWS override
+    {
+        return nullptr;
+    }
+
+    size_t detach() NOEXCEPT override
+    {
+        return zero;
+    }
+
+    void release(void*) NOEXCEPT override
+    {
+    }
+
+private:
+    void* do_allocate(size_t bytes, size_t align) THROWS override
+    {
+        allocations_.fetch_add(one, std::memory_order_relaxed);
+        allocated_.fetch_add(bytes, std::memory_order_relaxed);
+        return default_arena::get()->allocate(bytes, align);
+    }
+
+    void do_deallocate(void* ptr, size_t bytes, size_t align) NOEXCEPT override
+    {
+        default_arena::get()->deallocate(ptr, bytes, align);
+    }
+
+    bool do_is_equal(const arena& other) const NOEXCEPT override
+    {
+        return &other == this;
+    }
+
+    std::atomic<size_t> allocations_{};
+    std::atomic<size_t> allocated_{};
+};
+
+// Peak resident set size of the process (KiB), zero if unavailable.
+static size_t peak_rss() NOEXCEPT
+{
+#if defined(HAVE_MSC)
+    return zero;
+#else
+    rusage usage{};
+    if (!is_zero(getrusage(RUSAGE_SELF, &usage)))
+        return zero;
+
+#if defined(HAVE_APPLE)
+    return possible_narrow_sign_cast<size_t>(usage.ru_maxrss) / 1024u;
+#else
+    return possible_narrow_sign_cast<size_t>(usage.ru_maxrss);
+#endif
+#endif
+}
+
+// corpus
+// ----------------------------------------------------------------------------
+
+struct entry
+{
+    std::string label;
+    size_t height;
+    data_chunk data;
+    data_chunk prevouts;
+};
+
+static data_chunk read_file(const std::filesystem::path& path) NOEXCEPT
+{
+    std::ifstream file{ path, std::ios::binary };
+    if (!file)
+        return {};
+
+    return { std::istreambuf_iterator<char>(file), {} };
+}
+
+static std_vector<entry> load_corpus() NOEXCEPT
+{
+    const auto variable = std::getenv("BC_BLOCK_CORPUS");
+    const std::filesystem::path directory{ is_null(variable) ? "corpus" :
+        variable };
+
+    std_vector<entry> corpus{};
+    std::error_code ec{};
+    for (const auto& file: std::filesystem::directory_iterator(directory, ec))
+    {
+        const auto& path = file.path();
+        if (path.extension() != ".block")
+            continue;
+
+        const auto stem = path.stem().string();
+        const auto separator = stem.find('_');
+        size_t height{};
+        if (separator == std::string::npos ||
+            !deserialize(height, stem.substr(zero, separator)))
+            continue;
+
+        auto prevouts = path;
+        prevouts.replace_extension(".prevouts");
+        corpus.push_back(
+        {
+            stem.substr(add1(separator)),
+            height,
+            read_file(path),
+            read_file(prevouts)
+        });
+    }
+
+    std::sort(corpus.begin(), corpus.end(), [](const auto& left,
+        const auto& right) NOEXCEPT
+    {
+        return left.height < right.height;
+    });
+
+    return corpus;
+}
+
+// Approximate mainnet context, rules activated by height (and bip16 time).
+static context to_context(const block& instance, size_t height) NOEXCEPT
+{
+    static const system::settings mainnet{ selection::mainnet };
+    const auto& header = instance.header();
+
+    uint32_t rules = flags::bip30_rule | flags::bip42_rule | flags::bip90_rule;
+    if (header.timestamp() >= mainnet.bip16_activation_time)
+        rules |= flags::bip16_rule;
+    if (height >= mainnet.bip90_bip34_height)
+        rules |= flags::bip34_rule;
+    if (height >= mainnet.bip90_bip66_height)
+        rules |= flags::bip66_rule;
+    if (height >= mainnet.bip90_bip65_height)
+        rules |= flags::bip65_rule;
+    if (height >= mainnet.bip9_bit0_active_checkpoint.height())
+        rules |= flags::bip68_rule | flags::bip112_rule | flags::bip113_rule;
+    if (height >= mainnet.bip9_bit1_active_checkpoint.height())
+        rules |= flags::bip141_rule | flags::bip143_rule | flags::bip147_rule;
+    if (height >= mainnet.bip9_bit2_active_checkpoint.height())
+        rules |= flags::bip341_rule | flags::bip342_rule;
+
+    return
+    {
+        rules,
+        header.timestamp(),
+        sub1(header.timestamp()),
+        height,
+        0,
+        header.bits()
+    };
+}
+
+// Assign external prevouts, returns false if the set is incomplete.
+static bool populate_external(const block& instance,
+    const data_chunk& prevouts) NOEXCEPT
+{
+    stream::in::copy stream(prevouts);
+    read::bytes::istream source(stream);
+
+    for (const auto& tx: *instance.transactions_ptr())
+    {
+        if (tx->is_coinbase())
+            continue;
+
+        for (const auto& input: *tx->inputs_ptr())
+        {
+            if (input->prevout)
+                continue;
+
+            if (source.is_exhausted())
+                return false;
+
+            input->prevout = to_shared<output>(source);
+            input->metadata.height = one;
+            input->metadata.median_time_past = zero;
+            input->metadata.spent = false;
+            input->metadata.coinbase = false;
+        }
+    }
+
+    return source && source.is_exhausted();
+}
+
+// csv
+// ----------------------------------------------------------------------------
+
+struct sample
+{
+    size_t microseconds;
+    size_t allocations;
+    size_t allocated;
+};
+
+template <typename Function>
+static sample measure(const counting_arena& arena,
+    const Function& function) NOEXCEPT
+{
+    const auto start_allocations = arena.allocations();
+    const auto start_allocated = arena.allocated();
+    const auto start = std::chrono::steady_clock::now();
+
+    for (size_t round{}; round < rounds; ++round)
+        function();
+
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    return
+    {
+        possible_narrow_sign_cast<size_t>(std::chrono::duration_cast<
+            std::chrono::microseconds>(elapsed).count()) / rounds,
+        (arena.allocations() - start_allocations) / rounds,
+        (arena.allocated() - start_allocated) / rounds
+    };
+}
+
+static void write_header(std::ostream& out) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    out << "label,height,bytes,txs,stage,result,microseconds,mib_per_second,"
+        "txs_per_second,allocations,allocated_bytes,peak_rss_kib"
+        << std::endl;
+    BC_POP_WARNING()
+}
+
+static void write_row(std::ostream& out, const entry& item, size_t txs,
+    const std::string& stage, const code& result, const sample& sampled) NOEXCEPT
+{
+    const auto seconds = std::max(sampled.microseconds, one) / 1'000'000.0;
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    out << item.label << ","
+        << item.height << ","
+        << item.data.size() << ","
+        << txs << ","
+        << stage << ","
+        << "\"" << result.message() << "\","
+        << sampled.microseconds << ","
+        << (item.data.size() / seconds / power2(20u)) << ","
+        << (txs / seconds) << ","
+        << sampled.allocations << ","
+        << sampled.allocated << ","
+        << peak_rss() << std::endl;
+    BC_POP_WARNING()
+}
+
+// benchmark
+// ----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE(performance_chain_tests)
+
+BOOST_AUTO_TEST_CASE(performance__chain__corpus__csv)
+{
+    const auto corpus = load_corpus();
+    if (corpus.empty())
+    {
+        std::cout << "No corpus, set BC_BLOCK_CORPUS." << std::endl;
+        return;
+    }
+
+    auto& out = std::cout;
+    write_header(out);
+
+    for (const auto& item: corpus)
+    {
+        // Checks are collected within measured functions, and asserted after.
+        counting_arena arena{};
+        auto valid = true;
+        const auto deserialize = measure(arena, [&]() NOEXCEPT
+        {
+            stream::in::fast stream(item.data);
+            read::bytes::fast source(stream, &arena);
+            const block instance{ source, true };
+            valid &= instance.is_valid();
+        });
+        BOOST_REQUIRE(valid);
+
+        // Witness stacks are materialized from contiguous storage on demand.
+        const auto stacked = measure(arena, [&]() NOEXCEPT
+        {
+            stream::in::fast stream(item.data);
+            read::bytes::fast source(stream, &arena);
+            const block instance{ source, true };
+            for (const auto& tx: *instance.transactions_ptr())
+                for (const auto& input: *tx->inputs_ptr())
+                    input->witness().stack();
+        });
+
+        block instance{ item.data, true };
+        BOOST_REQUIRE(instance.is_valid());
+        const auto txs = instance.transactions_ptr()->size();
+        const auto ctx = to_context(instance, item.height);
+        write_row(out, item, txs, "deserialize", error::success, deserialize);
+        write_row(out, item, txs, "deserialize_stacked", error::success, stacked);
+
+        const auto hashes = measure(arena, [&]() NOEXCEPT
+        {
+            instance.set_hashes(item.data);
+        });
+        write_row(out, item, txs, "set_hashes", error::success, hashes);
+
+        // Json text of both paths is identical (rates are of block bytes).
+        std::string text{};
+        const auto json_dom = measure(arena, [&]() NOEXCEPT
+        {
+            text = boost::json::serialize(boost::json::value_from(instance));
+        });
+        write_row(out, item, txs, "json_dom", error::success, json_dom);
+
+        const auto json_stream = measure(arena, [&]() NOEXCEPT
+        {
+            text = to_json(instance);
+        });
+        write_row(out, item, txs, "json_stream", error::success, json_stream);
+
+        // Serialization through the writer, and through gathered segments.
+        data_chunk serial(instance.serialized_size(true));
+        const auto to_data = measure(arena, [&]() NOEXCEPT
+        {
+            stream::out::fast stream(serial);
+            write::bytes::fast sink(stream);
+            instance.to_data(sink, true);
+        });
+        write_row(out, item, txs, "to_data", error::success, to_data);
+
+        auto sized = true;
+        const auto gathered = measure(arena, [&]() NOEXCEPT
+        {
+            const gather segments{ instance, true };
+            sized &= (segments.size() == serial.size());
+        });
+        BOOST_REQUIRE(sized);
+        write_row(out, item, txs, "gather", error::success, gathered);
+
+        auto copy = true;
+        const auto copied = measure(arena, [&]() NOEXCEPT
+        {
+            const gather segments{ instance, true };
+            copy &= segments.copy(serial);
+        });
+        BOOST_REQUIRE(copy);
+        write_row(out, item, txs, "gather_copy", error::success, copied);
+
+        code ec{};
+        const auto check = measure(arena, [&]() NOEXCEPT { ec = instance.check(); });
+        write_row(out, item, txs, "check", ec, check);
+
+        const auto contextual = measure(arena, [&]() NOEXCEPT
+        {
+            ec = instance.check(ctx);
+        });
+        write_row(out, item, txs, "check_context", ec, contextual);
+
+        const auto populate = measure(arena, [&]() NOEXCEPT { instance.populate(); });
+        write_row(out, item, txs, "populate", error::success, populate);
+
+        // Remaining stages require all prevouts.
+        if (!populate_external(instance, item.prevouts))
+            continue;
+
+        const auto accept = measure(arena, [&]() NOEXCEPT
+        {
+            static const system::settings mainnet{ selection::mainnet };
+            ec = instance.accept(ctx, mainnet.subsidy_interval_blocks,
+                mainnet.initial_subsidy());
+        });
+        write_row(out, item, txs, "accept", ec, accept);
+
+        const auto connect = measure(arena, [&]() NOEXCEPT
+        {
+            ec = instance.connect(ctx);
+        });
+        write_row(out, item, txs, "connect", ec, connect);
+
+        data_chunk filter{};
+        const auto compute = measure(arena, [&]() NOEXCEPT
+        {
+            filter.clear();
+            ec = neutrino::compute_filter(filter, instance) ? code{} :
+                code{ error::missing_previous_output };
+        });
+        write_row(out, item, txs, "compute_filter", ec, compute);
+    }
+}
+
+// Synthetic witnesses, from p2wpkh to inscription-style (many max pushes).
+BOOST_AUTO_TEST_CASE(performance__chain__witness__csv)
+{
+    constexpr size_t iterations = 1'000;
+    const std_vector<std::pair<std::string, data_stack>> witnesses
+    {
+        { "p2wpkh", { data_chunk(72, 0x42), data_chunk(33, 0x42) } },
+        { "p2wsh_multisig", { {}, data_chunk(72, 0x42), data_chunk(72, 0x42),
+            data_chunk(105, 0x42) } },
+        { "inscription", data_stack(400, data_chunk(max_push_data_size, 0x42)) }
+    };
+
+    auto& out = std::cout;
+    out << "label,elements,bytes,stage,microseconds,allocations,"
+        "allocated_bytes" << std::endl;
+
+    for (const auto& item: witnesses)
+    {
+        const auto data = witness{ item.second }.to_data(true);
+        const auto row = [&](const std::string& stage,
+            const sample& sampled) NOEXCEPT
+        {
+            BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+            out << item.first << ","
+                << item.second.size() << ","
+                << data.size() << ","
+                << stage << ","
+                << sampled.microseconds << ","
+                << sampled.allocations / iterations << ","
+                << sampled.allocated / iterations << std::endl;
+            BC_POP_WARNING()
+        };
+
+        counting_arena arena{};
+        auto valid = true;
+        row("deserialize", measure(arena, [&]() NOEXCEPT
+        {
+            for (size_t count{}; count < iterations; ++count)
+            {
+                stream::in::fast stream(data);
+                read::bytes::fast source(stream, &arena);
+                const witness instance{ source, true };
+                valid &= instance.is_valid();
+            }
+        }));
+        BOOST_REQUIRE(valid);
+
+        auto stacked = true;
+        row("deserialize_stacked", measure(arena, [&]() NOEXCEPT
+        {
+            for (size_t count{}; count < iterations; ++count)
+            {
+                stream::in::fast stream(data);
+                read::bytes::fast source(stream, &arena);
+                const witness instance{ source, true };
+                stacked &= (instance.stack().size() == item.second.size());
+            }
+        }));
+        BOOST_REQUIRE(stacked);
+    }
+}
+
+// Bulk address derivation of synthetic keys and output scripts, by type.
+BOOST_AUTO_TEST_CASE(performance__chain__addresses__csv)
+{
+    using namespace bc::system::wallet;
+    constexpr size_t count = 10'000;
+
+    secret_list secrets(count);
+    for (size_t index = 0; index < count; ++index)
+        secrets[index] = sha256_hash(to_little_endian(add1(index)));
+
+    compressed_list keys{};
+    BOOST_REQUIRE(secret_to_public(keys, secrets));
+
+    scripts outputs{};
+    outputs.reserve(count);
+    for (const auto& key: keys)
+        outputs.emplace_back(script::to_pay_witness_key_hash_pattern(
+            bitcoin_short_hash(key)));
+
+    auto& out = std::cout;
+    out << "label,addresses,microseconds,addresses_per_second,allocations,"
+        "allocated_bytes" << std::endl;
+
+    const auto row = [&](const std::string& label,
+        const sample& sampled) NOEXCEPT
+    {
+        const auto seconds = std::max(sampled.microseconds, one) / 1'000'000.0;
+
+        BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+        out << label << ","
+            << count << ","
+            << sampled.microseconds << ","
+            << static_cast<size_t>(count / seconds) << ","
+            << sampled.allocations << ","
+            << sampled.allocated << std::endl;
+        BC_POP_WARNING()
+    };
+
+    const std_vector<std::pair<std::string, address_type>> types
+    {
+        { "p2pkh", address_type::p2pkh },
+        { "p2sh_p2wpkh", address_type::p2sh_p2wpkh },
+        { "p2wpkh", address_type::p2wpkh },
+        { "p2tr", address_type::p2tr }
+    };
+
+    // Addresses are not allocated from the arena (allocations are zero).
+    const counting_arena arena{};
+    for (const auto& type: types)
+    {
+        size_t encoded{};
+        row(type.first, measure(arena, [&]() NOEXCEPT
+        {
+            encoded = encode_addresses(keys, type.second).size();
+        }));
+        BOOST_REQUIRE_EQUAL(encoded, count);
+    }
+
+    size_t encoded{};
+    row("scripts", measure(arena, [&]() NOEXCEPT
+    {
+        encoded = encode_addresses(outputs).size();
+    }));
+    BOOST_REQUIRE_EQUAL(encoded, count);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
@@ -288,6 +288,169 @@ BOOST_AUTO_TEST_CASE(script__factory_reader_test)
     BOOST_REQUIRE(instance.is_valid());
 }
 
+// Deferred parsing tests.
+// -----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(script__from_data__deserialized__not_parsed)
+{
+    const auto raw = base16_chunk("76a914fc7b44566256621affb1541cc9d59f08336d276b88ac");
+    const script instance(raw, false);
+    BOOST_REQUIRE(instance.is_valid());
+    BOOST_REQUIRE(!instance.is_parsed());
+    BOOST_REQUIRE_EQUAL(instance.serialized_size(false), raw.size());
+    BOOST_REQUIRE_EQUAL(instance.to_data(false), raw);
+    BOOST_REQUIRE(instance.output_pattern() == script_pattern::pay_key_hash);
+    BOOST_REQUIRE(!instance.is_parsed());
+}
+
+BOOST_AUTO_TEST_CASE(script__ops__deserialized__parsed)
+{
+    const auto raw = base16_chunk("76a914fc7b44566256621affb1541cc9d59f08336d276b88ac");
+    const script instance(raw, false);
+    BOOST_REQUIRE_EQUAL(instance.ops().size(), 5u);
+    BOOST_REQUIRE(instance.is_parsed());
+    BOOST_REQUIRE(instance.ops()[0] == opcode::dup);
+    BOOST_REQUIRE(instance.ops()[4] == opcode::checksig);
+    BOOST_REQUIRE(!instance.is_prefail());
+    BOOST_REQUIRE(!instance.is_roller());
+    BOOST_REQUIRE_EQUAL(instance.to_data(false), raw);
+}
+
+BOOST_AUTO_TEST_CASE(script__is_prefail__deserialized_invalid_code__true)
+{
+    const auto raw = base16_chunk("517e");
+    const script instance(raw, false);
+    BOOST_REQUIRE(!instance.is_parsed());
+    BOOST_REQUIRE(instance.is_prefail());
+    BOOST_REQUIRE(instance.is_parsed());
+}
+
+BOOST_AUTO_TEST_CASE(script__from_data__empty_prefixed__parsed)
+{
+    const auto raw = base16_chunk("00");
+    const script instance(raw, true);
+    BOOST_REQUIRE(instance.is_valid());
+    BOOST_REQUIRE(instance.is_parsed());
+    BOOST_REQUIRE(instance.ops().empty());
+}
+
+BOOST_AUTO_TEST_CASE(script__from_data__prefix_overflow__invalid)
+{
+    const auto raw = base16_chunk("0576a914");
+    const script instance(raw, true);
+    BOOST_REQUIRE(!instance.is_valid());
+}
+
+BOOST_AUTO_TEST_CASE(script__copy__unparsed__unparsed_equal)
+{
+    const auto raw = base16_chunk("76a914fc7b44566256621affb1541cc9d59f08336d276b88ac");
+    const script instance(raw, false);
+    const script copy(instance);
+    BOOST_REQUIRE(!copy.is_parsed());
+    BOOST_REQUIRE(copy == instance);
+    BOOST_REQUIRE(!copy.is_parsed());
+    BOOST_REQUIRE(copy == script{ instance.ops() });
+    BOOST_REQUIRE(copy.ops() == instance.ops());
+}
+
+BOOST_AUTO_TEST_CASE(script__copy__parsed__parsed)
+{
+    const auto raw = base16_chunk("76a914fc7b44566256621affb1541cc9d59f08336d276b88ac");
+    const script instance(raw, false);
+    BOOST_REQUIRE(!instance.ops().empty());
+    const script copy(instance);
+    BOOST_REQUIRE(copy.is_parsed());
+    BOOST_REQUIRE(copy.ops() == instance.ops());
+}
+
+BOOST_AUTO_TEST_CASE(script__to_data__offset__excludes_offset)
+{
+    const auto raw = base16_chunk("76a914fc7b44566256621affb1541cc9d59f08336d276b88ac");
+    const script instance(raw, false);
+    instance.clear_offset();
+    instance.offset = std::next(instance.ops().begin(), 4);
+    BOOST_REQUIRE_EQUAL(instance.serialized_size(false), 1u);
+    BOOST_REQUIRE_EQUAL(instance.to_data(false), base16_chunk("ac"));
+    instance.clear_offset();
+    BOOST_REQUIRE_EQUAL(instance.to_data(false), raw);
+}
+
+BOOST_AUTO_TEST_CASE(script__to_data__chunk__expected)
+{
+    const auto raw = base16_chunk("76a914fc7b44566256621affb1541cc9d59f08336d276b88ac");
+    const script instance(raw, false);
+    data_chunk data(100, 0x42);
+    instance.to_data(data, false);
+    BOOST_REQUIRE_EQUAL(data, raw);
+    instance.to_data(data, true);
+    BOOST_REQUIRE_EQUAL(data, instance.to_data(true));
+}
+
+// Serialized pattern tests.
+// -----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(script__serialized_patterns__pay_key_hash__expected)
+{
+    const auto minimal = base16_chunk("76a914fc7b44566256621affb1541cc9d59f08336d276b88ac");
+    const auto push_one = base16_chunk("76a94c14fc7b44566256621affb1541cc9d59f08336d276b88ac");
+    const auto push_two = base16_chunk("76a94d1400fc7b44566256621affb1541cc9d59f08336d276b88ac");
+    const auto push_four = base16_chunk("76a94e14000000fc7b44566256621affb1541cc9d59f08336d276b88ac");
+    const auto bad_size = base16_chunk("76a94d1401fc7b44566256621affb1541cc9d59f08336d276b88ac");
+
+    BOOST_REQUIRE(script::is_pay_key_hash_pattern(minimal));
+    BOOST_REQUIRE(script::is_pay_key_hash_pattern(push_one));
+    BOOST_REQUIRE(script::is_pay_key_hash_pattern(push_two));
+    BOOST_REQUIRE(script::is_pay_key_hash_pattern(push_four));
+    BOOST_REQUIRE(!script::is_pay_key_hash_pattern(bad_size));
+
+    // Serialized and operations patterns are consistent.
+    for (const auto& raw: { minimal, push_one, push_two, push_four, bad_size })
+    {
+        BOOST_REQUIRE_EQUAL(script::is_pay_key_hash_pattern(raw),
+            script::is_pay_key_hash_pattern(script{ raw, false }.ops()));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(script__serialized_patterns__pay_script_hash__expected)
+{
+    const auto raw = base16_chunk("a914fc7b44566256621affb1541cc9d59f08336d276b87");
+    BOOST_REQUIRE(script::is_pay_script_hash_pattern(raw));
+    BOOST_REQUIRE(script::is_pay_script_hash_pattern(script{ raw, false }.ops()));
+    BOOST_REQUIRE(!script::is_pay_key_hash_pattern(raw));
+    BOOST_REQUIRE(!script::is_witness_program_pattern(raw));
+    const script instance(raw, false);
+    BOOST_REQUIRE(instance.is_pay_to_script_hash(flags::bip16_rule));
+}
+
+BOOST_AUTO_TEST_CASE(script__serialized_patterns__witness__expected)
+{
+    const auto p2wpkh = base16_chunk("0014fc7b44566256621affb1541cc9d59f08336d276b");
+    const auto p2wsh = base16_chunk("0020000102030405060708090001020304050607080900010203040506070809ff00");
+    const auto p2tr = base16_chunk("5120000102030405060708090001020304050607080900010203040506070809ff00");
+    const auto anchor = base16_chunk("51024e73");
+    const auto short_program = base16_chunk("5101ff");
+    const auto negative = base16_chunk("4f024e73");
+
+    BOOST_REQUIRE(script::is_pay_witness_key_hash_pattern(p2wpkh));
+    BOOST_REQUIRE(script::is_pay_witness_script_hash_pattern(p2wsh));
+    BOOST_REQUIRE(script::is_pay_taproot_pattern(p2tr));
+    BOOST_REQUIRE(!script::is_pay_taproot_pattern(p2wsh));
+    BOOST_REQUIRE(!script::is_pay_witness_script_hash_pattern(p2tr));
+
+    for (const auto& raw: { p2wpkh, p2wsh, p2tr, anchor, short_program, negative })
+    {
+        const script instance{ raw, false };
+        BOOST_REQUIRE_EQUAL(script::is_witness_program_pattern(raw),
+            script::is_witness_program_pattern(instance.ops()));
+        BOOST_REQUIRE_EQUAL(instance.is_pay_to_witness(flags::bip141_rule),
+            script::is_witness_program_pattern(raw));
+    }
+
+    BOOST_REQUIRE(script(p2wpkh, false).version() == script_version::segwit);
+    BOOST_REQUIRE(script(p2tr, false).version() == script_version::taproot);
+    BOOST_REQUIRE(script(short_program, false).version() == script_version::unversioned);
+}
+
 BOOST_AUTO_TEST_CASE(script__from_data__first_byte_invalid_wire_code__success)
 {
     const auto raw = to_chunk(base16_array(
@@ -34,9 +34,154 @@ BOOST_AUTO_TEST_SUITE(taproot_tests)
 
 using namespace system::chain;
 
-BOOST_AUTO_TEST_CASE(taproot_test)
+// Access protected hash methods.
+class accessor
+  : public taproot
 {
-    BOOST_REQUIRE(true);
+public:
+    static hash_digest merkle_root(const tapscript::keys_t& keys,
+        size_t count, const hash_digest& tapleaf_hash) NOEXCEPT
+    {
+        return taproot::merkle_root(keys, count, tapleaf_hash);
+    }
+};
+
+// bip341 wallet test vectors (scriptPubKey 1).
+static const auto vector_key = base16_array(
+    "187791b6f712a8ea41c8ecdd0ee77fab3e85263b37e1ec18a3651926b3a6cf27");
+static const auto vector_script = base16_chunk(
+    "20d85a959b0290bf19bb89ed43c916be835475d013da4b362117393e25a48229b8ac");
+static const auto vector_leaf = base16_array(
+    "5b75adecf53548f3ec6ad7d78383bf84cc57b55a3127c72b9a2481752dd88b21");
+static const auto vector_tweak = base16_array(
+    "cbd8679ba636c1110ea247542cfbd964131a6be84f873f7f3b62a777528ed001");
+static const auto vector_control = base16_chunk(
+    "c1187791b6f712a8ea41c8ecdd0ee77fab3e85263b37e1ec18a3651926b3a6cf27");
+
+static script to_script(const data_chunk& data) NOEXCEPT
+{
+    stream::in::fast stream{ data };
+    return { stream, false };
+}
+
+static size_t depth(const data_chunk& control) NOEXCEPT
+{
+    return (control.size() - add1(ec_xonly_size)) / hash_size;
+}
+
+// commit
+
+BOOST_AUTO_TEST_CASE(taproot__commit__no_leaves__key_only)
+{
+    taproot::commitment out{};
+    BOOST_REQUIRE(taproot::commit(out, vector_key, {}));
+    BOOST_REQUIRE_EQUAL(out.root, null_hash);
+    BOOST_REQUIRE_NE(out.tweak, null_hash);
+    BOOST_REQUIRE(out.leaf_hashes.empty());
+    BOOST_REQUIRE(out.controls.empty());
+}
+
+BOOST_AUTO_TEST_CASE(taproot__commit__one_leaf__expected)
+{
+    taproot::commitment out{};
+    const taproot::leaves leaves{ { 0xc0, to_script(vector_script), 1 } };
+    BOOST_REQUIRE(taproot::commit(out, vector_key, leaves));
+    BOOST_REQUIRE_EQUAL(out.leaf_hashes.size(), 1u);
+    BOOST_REQUIRE_EQUAL(out.leaf_hashes.front(), vector_leaf);
+    BOOST_REQUIRE_EQUAL(out.root, vector_leaf);
+    BOOST_REQUIRE_EQUAL(out.tweak, vector_tweak);
+    BOOST_REQUIRE_EQUAL(out.controls.size(), 1u);
+    BOOST_REQUIRE_EQUAL(out.controls.front(), vector_control);
+    BOOST_REQUIRE(out.parity);
+}
+
+BOOST_AUTO_TEST_CASE(taproot__commit__odd_version__false_reset)
+{
+    taproot::commitment out{};
+    out.root = vector_tweak;
+    out.leaf_hashes.resize(2);
+    out.controls.resize(2);
+    const taproot::leaves leaves{ { 0xc1, script{ "checksig" }, 1 } };
+    BOOST_REQUIRE(!taproot::commit(out, vector_key, leaves));
+    BOOST_REQUIRE_EQUAL(out.root, null_hash);
+    BOOST_REQUIRE_EQUAL(out.tweak, null_hash);
+    BOOST_REQUIRE(out.leaf_hashes.empty());
+    BOOST_REQUIRE(out.controls.empty());
+}
+
+BOOST_AUTO_TEST_CASE(taproot__commit__invalid_key__false_reset)
+{
+    taproot::commitment out{};
+    out.root = vector_tweak;
+    out.leaf_hashes.resize(2);
+    out.controls.resize(2);
+    const taproot::leaves leaves{ { 0xc0, script{ "checksig" }, 1 } };
+    BOOST_REQUIRE(!taproot::commit(out, ec_xonly{}, leaves));
+    BOOST_REQUIRE_EQUAL(out.root, null_hash);
+    BOOST_REQUIRE_EQUAL(out.tweak, null_hash);
+    BOOST_REQUIRE(out.leaf_hashes.empty());
+    BOOST_REQUIRE(out.controls.empty());
+}
+
+BOOST_AUTO_TEST_CASE(taproot__commit__leaves__controls_commit_to_root)
+{
+    taproot::leaves leaves{};
+    for (uint64_t leaf = 0; leaf < 9; ++leaf)
+        leaves.push_back({ 0xc0, script{ encode_base10(leaf) }, add1(leaf) });
+
+    taproot::commitment out{};
+    BOOST_REQUIRE(taproot::commit(out, vector_key, leaves));
+    BOOST_REQUIRE_EQUAL(out.leaf_hashes.size(), leaves.size());
+    BOOST_REQUIRE_EQUAL(out.controls.size(), leaves.size());
+
+    for (size_t index = 0; index < leaves.size(); ++index)
+    {
+        const auto& leaf = leaves.at(index);
+        const auto& hash = out.leaf_hashes.at(index);
+        BOOST_REQUIRE_EQUAL(hash, taproot::leaf_hash(leaf.version, leaf.script));
+
+        const auto& control = out.controls.at(index);
+        BOOST_REQUIRE(tapscript::is_control(control));
+
+        const tapscript tapscript{ to_shared(control) };
+        BOOST_REQUIRE(tapscript.is_valid());
+        BOOST_REQUIRE(tapscript.is_tapscript());
+        BOOST_REQUIRE_EQUAL(tapscript.parity(), out.parity);
+        BOOST_REQUIRE_EQUAL(tapscript.key(), vector_key);
+        BOOST_REQUIRE_EQUAL(accessor::merkle_root(tapscript.keys(),
+            tapscript.count(), hash), out.root);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(taproot__commit__weighted_leaves__heavier_not_deeper)
+{
+    taproot::leaves leaves{};
+    for (uint64_t leaf = 0; leaf < 16; ++leaf)
+        leaves.push_back({ 0xc0, script{ encode_base10(leaf) }, power2(leaf) });
+
+    taproot::commitment out{};
+    BOOST_REQUIRE(taproot::commit(out, vector_key, leaves));
+
+    // Exponential weights produce a chain, the heaviest leaf at depth one.
+    BOOST_REQUIRE_EQUAL(depth(out.controls.back()), 1u);
+    BOOST_REQUIRE_EQUAL(depth(out.controls.front()), 15u);
+
+    for (size_t index = 1; index < leaves.size(); ++index)
+        BOOST_REQUIRE_LE(depth(out.controls.at(index)),
+            depth(out.controls.at(sub1(index))));
+}
+
+BOOST_AUTO_TEST_CASE(taproot__commit__equal_weights__balanced)
+{
+    taproot::leaves leaves{};
+    for (uint64_t leaf = 0; leaf < 8; ++leaf)
+        leaves.push_back({ 0xc0, script{ encode_base10(leaf) }, 1 });
+
+    taproot::commitment out{};
+    BOOST_REQUIRE(taproot::commit(out, vector_key, leaves));
+
+    for (const auto& control: out.controls)
+        BOOST_REQUIRE_EQUAL(depth(control), 3u);
 }
 
 BOOST_AUTO_TEST_SUITE_END()
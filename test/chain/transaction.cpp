@@ -383,6 +383,24 @@ BOOST_AUTO_TEST_CASE(transaction__to_data__data__expected)
     BOOST_REQUIRE_EQUAL(size, tx.serialized_size(true));
 }
 
+BOOST_AUTO_TEST_CASE(transaction__to_data__chunk__expected_capacity_retained)
+{
+    const transaction tx(tx1_data, true);
+    data_chunk data(1000, 0x42);
+    const auto capacity = data.capacity();
+    tx.to_data(data, true);
+    BOOST_REQUIRE_EQUAL(data, tx.to_data(true));
+    BOOST_REQUIRE_EQUAL(data.capacity(), capacity);
+}
+
+BOOST_AUTO_TEST_CASE(transaction__to_data__chunk_non_segregated__no_witness)
+{
+    const transaction tx(tx1_data, true);
+    data_chunk data{};
+    tx.to_data(data, true);
+    BOOST_REQUIRE_EQUAL(data, tx1_data);
+}
+
 BOOST_AUTO_TEST_CASE(transaction__to_data__stream__expected)
 {
     const transaction tx(tx1_data, true);
@@ -1483,6 +1501,132 @@ BOOST_AUTO_TEST_CASE(transaction__create_endorsement__single_input_no_output__ex
     BOOST_REQUIRE_EQUAL(out, expected);
 }
 
+// create_endorsements
+
+BOOST_AUTO_TEST_CASE(transaction__create_endorsements__empty__true_empty)
+{
+    const auto tx_data = base16_chunk("0100000001b3807042c92f449bbf79b33ca59d7dfec7f4cc71096704a9c526dddf496ee0970100000000ffffffff01905f0100000000001976a91418c0bd8d1818f1bf99cb1df2269c645318ef7b7388ac00000000");
+    const transaction test_tx(tx_data, true);
+    BOOST_REQUIRE(test_tx.is_valid());
+
+    endorsements out{ { 0x42 } };
+    BOOST_REQUIRE(test_tx.create_endorsements(out, {}, flags::no_rules));
+    BOOST_REQUIRE(out.empty());
+}
+
+BOOST_AUTO_TEST_CASE(transaction__create_endorsements__invalid_index__false)
+{
+    const auto tx_data = base16_chunk("0100000001b3807042c92f449bbf79b33ca59d7dfec7f4cc71096704a9c526dddf496ee0970100000000ffffffff01905f0100000000001976a91418c0bd8d1818f1bf99cb1df2269c645318ef7b7388ac00000000");
+    const transaction test_tx(tx_data, true);
+    BOOST_REQUIRE(test_tx.is_valid());
+
+    const ec_secret secret = base16_hash("ce8f4b713ffdd2658900845251890f30371856be201cd1f5b3d970f793634333");
+    const transaction::signers signers
+    {
+        { 1, secret, {}, 0, coverage::hash_all, script_version::unversioned }
+    };
+
+    endorsements out;
+    BOOST_REQUIRE(!test_tx.create_endorsements(out, signers, flags::no_rules));
+    BOOST_REQUIRE(out.empty());
+}
+
+BOOST_AUTO_TEST_CASE(transaction__create_endorsements__single_input_single_output__expected)
+{
+    const auto tx_data = base16_chunk("0100000001b3807042c92f449bbf79b33ca59d7dfec7f4cc71096704a9c526dddf496ee0970100000000ffffffff01905f0100000000001976a91418c0bd8d1818f1bf99cb1df2269c645318ef7b7388ac00000000");
+    const transaction test_tx(tx_data, true);
+    BOOST_REQUIRE(test_tx.is_valid());
+
+    const script prevout_script(std::string{ "dup hash160 [88350574280395ad2c3e2ee20e322073d94e5e40] equalverify checksig" });
+    BOOST_REQUIRE(prevout_script.is_valid());
+
+    const ec_secret secret = base16_hash("ce8f4b713ffdd2658900845251890f30371856be201cd1f5b3d970f793634333");
+    const transaction::signers signers
+    {
+        { 0, secret, prevout_script, 0, coverage::hash_all, script_version::unversioned }
+    };
+
+    endorsements out;
+    BOOST_REQUIRE(test_tx.create_endorsements(out, signers, flags::no_rules));
+    BOOST_REQUIRE_EQUAL(out.size(), 1u);
+
+    const auto expected = base16_chunk("3045022100e428d3cc67a724cb6cfe8634aa299e58f189d9c46c02641e936c40cc16c7e8ed0220083949910fe999c21734a1f33e42fca15fb463ea2e08f0a1bccd952aacaadbb801");
+    BOOST_REQUIRE_EQUAL(out.front(), expected);
+}
+
+BOOST_AUTO_TEST_CASE(transaction__create_endorsements__mixed_signers__sequential_results)
+{
+    const auto tx_data = base16_chunk("0100000001b3807042c92f449bbf79b33ca59d7dfec7f4cc71096704a9c526dddf496ee0970100000000ffffffff01905f0100000000001976a91418c0bd8d1818f1bf99cb1df2269c645318ef7b7388ac00000000");
+    const transaction parallel_tx(tx_data, true);
+    const transaction sequential_tx(tx_data, true);
+    BOOST_REQUIRE(parallel_tx.is_valid());
+
+    const script prevout_script(std::string{ "dup hash160 [88350574280395ad2c3e2ee20e322073d94e5e40] equalverify checksig" });
+    const ec_secret secret1 = base16_hash("ce8f4b713ffdd2658900845251890f30371856be201cd1f5b3d970f793634333");
+    const ec_secret secret2 = base16_hash("33436393f770d9b3f5d11c20be561837300f89515284008965d2fd3f714b8fce");
+    constexpr auto flags = flags::bip143_rule;
+    const transaction::signers signers
+    {
+        { 0, secret1, prevout_script, 0, coverage::hash_all, script_version::unversioned },
+        { 0, secret2, prevout_script, 42, coverage::hash_all, script_version::segwit },
+        { 0, secret1, prevout_script, 42, coverage::hash_single, script_version::segwit },
+        { 0, secret2, prevout_script, 42, coverage::hash_none, script_version::segwit },
+        { 0, secret1, prevout_script, 42, coverage::all_anyone_can_pay, script_version::segwit },
+        { 0, secret2, prevout_script, 0, coverage::single_anyone_can_pay, script_version::unversioned }
+    };
+
+    endorsements out;
+    BOOST_REQUIRE(parallel_tx.create_endorsements(out, signers, flags));
+    BOOST_REQUIRE_EQUAL(out.size(), signers.size());
+
+    for (size_t index = 0; index < signers.size(); ++index)
+    {
+        const auto& signer = signers[index];
+        endorsement expected;
+        BOOST_REQUIRE(sequential_tx.create_endorsement(expected, signer.secret,
+            signer.subscript, signer.index, signer.value, signer.sighash_flags,
+            signer.version, flags));
+        BOOST_REQUIRE_EQUAL(out[index], expected);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(transaction__create_endorsements__taproot_single_same_input__sequential_results)
+{
+    const auto tx_data = base16_chunk("0100000001b3807042c92f449bbf79b33ca59d7dfec7f4cc71096704a9c526dddf496ee0970100000000ffffffff01905f0100000000001976a91418c0bd8d1818f1bf99cb1df2269c645318ef7b7388ac00000000");
+    const transaction parallel_tx(tx_data, true);
+    const transaction sequential_tx(tx_data, true);
+    BOOST_REQUIRE(parallel_tx.is_valid());
+
+    // Taproot signature hashing requires the prevouts of all inputs.
+    const script prevout_script(base16_chunk("51200000000000000000000000000000000000000000000000000000000000000001"), false);
+    parallel_tx.inputs_ptr()->front()->prevout = to_shared(output{ 42, prevout_script });
+    sequential_tx.inputs_ptr()->front()->prevout = to_shared(output{ 42, prevout_script });
+
+    // Both signers hash the same (lazily cached) output for hash_single.
+    const ec_secret secret1 = base16_hash("ce8f4b713ffdd2658900845251890f30371856be201cd1f5b3d970f793634333");
+    const ec_secret secret2 = base16_hash("33436393f770d9b3f5d11c20be561837300f89515284008965d2fd3f714b8fce");
+    constexpr auto flags = flags::bip342_rule;
+    const transaction::signers signers
+    {
+        { 0, secret1, prevout_script, 42, coverage::hash_single, script_version::taproot },
+        { 0, secret2, prevout_script, 42, coverage::hash_single, script_version::taproot }
+    };
+
+    endorsements out;
+    BOOST_REQUIRE(parallel_tx.create_endorsements(out, signers, flags));
+    BOOST_REQUIRE_EQUAL(out.size(), signers.size());
+
+    for (size_t index = 0; index < signers.size(); ++index)
+    {
+        const auto& signer = signers[index];
+        endorsement expected;
+        BOOST_REQUIRE(sequential_tx.create_endorsement(expected, signer.secret,
+            signer.subscript, signer.index, signer.value, signer.sighash_flags,
+            signer.version, flags));
+        BOOST_REQUIRE_EQUAL(out[index], expected);
+    }
+}
+
 // signature_hash
 
 BOOST_AUTO_TEST_CASE(transaction__signature_hash__all__expected)
@@ -216,6 +216,278 @@ BOOST_AUTO_TEST_CASE(witness__block__without_witness__checks)
     BOOST_REQUIRE(!instance.check());
 }
 
+// contiguous
+// ----------------------------------------------------------------------------
+
+const data_chunk witness_data
+{
+    // count
+    0x03,
+    // [424344]
+    0x03, 0x42, 0x43, 0x44,
+    // []
+    0x00,
+    // [5051]
+    0x02, 0x50, 0x51
+};
+
+BOOST_AUTO_TEST_CASE(witness__contiguous__deserialized__not_stacked)
+{
+    const chain::witness instance{ witness_data, true };
+    BOOST_REQUIRE(instance.is_valid());
+    BOOST_REQUIRE(!instance.is_stacked());
+    BOOST_REQUIRE_EQUAL(instance.stack_size(), 3u);
+    BOOST_REQUIRE_EQUAL(instance.element(0), base16_chunk("424344"));
+    BOOST_REQUIRE(instance.element(1).empty());
+    BOOST_REQUIRE_EQUAL(instance.element(2), base16_chunk("5051"));
+    BOOST_REQUIRE_EQUAL(instance.serialized_size(true), witness_data.size());
+    BOOST_REQUIRE_EQUAL(instance.to_data(true), witness_data);
+    BOOST_REQUIRE(!instance.is_stacked());
+}
+
+BOOST_AUTO_TEST_CASE(witness__to_data__chunk__expected)
+{
+    const chain::witness instance{ witness_data, true };
+    data_chunk data(100, 0x42);
+    instance.to_data(data, true);
+    BOOST_REQUIRE_EQUAL(data, witness_data);
+    instance.to_data(data, false);
+    BOOST_REQUIRE_EQUAL(data, instance.to_data(false));
+}
+
+BOOST_AUTO_TEST_CASE(witness__contiguous__stack__materialized)
+{
+    const chain::witness instance{ witness_data, true };
+    const auto& stack = instance.stack();
+    BOOST_REQUIRE(instance.is_stacked());
+    BOOST_REQUIRE_EQUAL(stack.size(), 3u);
+    BOOST_REQUIRE_EQUAL(*stack[0], base16_chunk("424344"));
+    BOOST_REQUIRE(stack[1]->empty());
+    BOOST_REQUIRE_EQUAL(*stack[2], base16_chunk("5051"));
+    BOOST_REQUIRE_EQUAL(&instance.stack(), &stack);
+}
+
+BOOST_AUTO_TEST_CASE(witness__contiguous__annex__not_stacked)
+{
+    const chain::witness instance{ witness_data, true };
+    BOOST_REQUIRE(instance.annex());
+    BOOST_REQUIRE(!instance.is_stacked());
+    BOOST_REQUIRE_EQUAL(instance.annex().data(), base16_chunk("5051"));
+}
+
+BOOST_AUTO_TEST_CASE(witness__contiguous__empty__stacked)
+{
+    const chain::witness instance{ data_chunk{ 0x00 }, true };
+    BOOST_REQUIRE(instance.is_valid());
+    BOOST_REQUIRE(instance.is_stacked());
+    BOOST_REQUIRE(is_zero(instance.stack_size()));
+    BOOST_REQUIRE(instance.stack().empty());
+}
+
+BOOST_AUTO_TEST_CASE(witness__contiguous__truncated__invalid)
+{
+    const data_chunk truncated{ 0x02, 0x01, 0x42, 0x03, 0x43 };
+    const chain::witness instance{ truncated, true };
+    BOOST_REQUIRE(!instance.is_valid());
+    BOOST_REQUIRE_EQUAL(instance.stack_size(), 1u);
+    BOOST_REQUIRE_EQUAL(instance.element(0), base16_chunk("42"));
+}
+
+BOOST_AUTO_TEST_CASE(witness__contiguous__copy__not_stacked)
+{
+    const chain::witness instance{ witness_data, true };
+    const chain::witness copy{ instance };
+    BOOST_REQUIRE(!copy.is_stacked());
+    BOOST_REQUIRE_EQUAL(copy.to_data(true), witness_data);
+
+    instance.stack();
+    const chain::witness stacked{ instance };
+    BOOST_REQUIRE(stacked.is_stacked());
+    BOOST_REQUIRE_EQUAL(stacked.stack().size(), 3u);
+}
+
+BOOST_AUTO_TEST_CASE(witness__contiguous__equality__storage_independent)
+{
+    const chain::witness instance{ witness_data, true };
+    const chain::witness expected
+    {
+        data_stack
+        {
+            { 0x42, 0x43, 0x44 },
+            {},
+            { 0x50, 0x51 }
+        }
+    };
+
+    BOOST_REQUIRE(instance == expected);
+    BOOST_REQUIRE(expected == instance);
+    BOOST_REQUIRE(!instance.is_stacked());
+    BOOST_REQUIRE_EQUAL(instance.to_string(), expected.to_string());
+}
+
+BOOST_AUTO_TEST_CASE(witness__contiguous__patterns__expected)
+{
+    const chain::witness reserved{ base16_chunk(
+        "01" "20" "0000000000000000000000000000000000000000000000000000000000000000"), true };
+    BOOST_REQUIRE(reserved.is_reserved_pattern());
+    BOOST_REQUIRE(reserved.is_push_size());
+    BOOST_REQUIRE(!reserved.is_stacked());
+
+    const chain::witness instance{ witness_data, true };
+    BOOST_REQUIRE(!instance.is_reserved_pattern());
+    BOOST_REQUIRE(instance.is_push_size());
+
+    const chain::witness oversized{ data_stack{ data_chunk(add1(max_push_data_size), 0x42) } };
+    BOOST_REQUIRE(!oversized.is_push_size());
+    BOOST_REQUIRE(!witness::is_push_size(oversized.stack()));
+}
+
+// is_committed
+// ----------------------------------------------------------------------------
+
+// bip341 wallet test vectors (scriptPubKey 1).
+static const auto taproot_leaf = base16_chunk(
+    "20d85a959b0290bf19bb89ed43c916be835475d013da4b362117393e25a48229b8ac");
+static const auto taproot_control = base16_chunk(
+    "c1187791b6f712a8ea41c8ecdd0ee77fab3e85263b37e1ec18a3651926b3a6cf27");
+static const auto taproot_program = base16_chunk(
+    "5120147c9c57132f6e7ecddba9800bb0c4449251c92a1e60371ee77557b6620f3ea3");
+
+static chain::script to_program(const data_chunk& data)
+{
+    stream::in::fast stream{ data };
+    return { stream, false };
+}
+
+BOOST_AUTO_TEST_CASE(witness__is_committed__script_path__true)
+{
+    const chain::witness instance{ data_stack{ taproot_leaf, taproot_control } };
+    BOOST_REQUIRE(instance.is_committed(to_program(taproot_program)));
+}
+
+BOOST_AUTO_TEST_CASE(witness__is_committed__annex__true)
+{
+    const chain::witness instance{ data_stack{ taproot_leaf, taproot_control,
+        { taproot_annex_prefix, 0x42 } } };
+    BOOST_REQUIRE(instance.is_committed(to_program(taproot_program)));
+}
+
+BOOST_AUTO_TEST_CASE(witness__is_committed__other_key__false)
+{
+    auto program = taproot_program;
+    program.back() ^= 0x01;
+    const chain::witness instance{ data_stack{ taproot_leaf, taproot_control } };
+    BOOST_REQUIRE(!instance.is_committed(to_program(program)));
+}
+
+BOOST_AUTO_TEST_CASE(witness__is_committed__key_path__false)
+{
+    const chain::witness instance{ data_stack{ data_chunk(64, 0x42) } };
+    BOOST_REQUIRE(!instance.is_committed(to_program(taproot_program)));
+}
+
+BOOST_AUTO_TEST_CASE(witness__is_committed__contiguous__not_stacked)
+{
+    const chain::witness source{ data_stack{ taproot_leaf, taproot_control,
+        { taproot_annex_prefix, 0x42 } } };
+    const chain::witness instance{ source.to_data(true), true };
+    BOOST_REQUIRE(instance.is_committed(to_program(taproot_program)));
+    BOOST_REQUIRE(!instance.is_stacked());
+}
+
+BOOST_AUTO_TEST_CASE(witness__is_committed__segwit_program__false)
+{
+    const chain::witness instance{ data_stack{ taproot_leaf, taproot_control } };
+    BOOST_REQUIRE(!instance.is_committed(to_program(base16_chunk(
+        "0014" "0000000000000000000000000000000000000000"))));
+}
+
+// extract
+// ----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(witness__extract_segwit__contiguous_p2wsh__not_stacked)
+{
+    const data_chunk redeem{ 0x51 };
+    const auto program = splice(base16_chunk("0020"), sha256_hash(redeem));
+    const chain::witness source{ data_stack{ { 0x42 }, {}, redeem } };
+
+    script::cptr script{};
+    chunk_cptrs_ptr stack{};
+    {
+        const chain::witness instance{ source.to_data(true), true };
+        BOOST_REQUIRE(!instance.extract_segwit(script, stack,
+            to_program(program)));
+        BOOST_REQUIRE(!instance.is_stacked());
+    }
+
+    // Stack elements are owned independently of the witness.
+    BOOST_REQUIRE_EQUAL(script->to_data(false), redeem);
+    BOOST_REQUIRE_EQUAL(stack->size(), 2u);
+    BOOST_REQUIRE_EQUAL(*stack->front(), data_chunk{ 0x42 });
+    BOOST_REQUIRE(stack->back()->empty());
+}
+
+BOOST_AUTO_TEST_CASE(witness__extract_segwit__contiguous_p2wsh_mismatch__invalid_witness)
+{
+    const auto program = splice(base16_chunk("0020"), null_hash);
+    const chain::witness source{ data_stack{ { 0x42 }, { 0x51 } } };
+    const chain::witness instance{ source.to_data(true), true };
+
+    script::cptr script{};
+    chunk_cptrs_ptr stack{};
+    BOOST_REQUIRE_EQUAL(instance.extract_segwit(script, stack,
+        to_program(program)), error::invalid_witness);
+}
+
+BOOST_AUTO_TEST_CASE(witness__extract_taproot__contiguous_script_path__not_stacked)
+{
+    const chain::witness source{ data_stack{ { 0x42 }, taproot_leaf,
+        taproot_control, { taproot_annex_prefix, 0x42 } } };
+
+    hash_cptr leaf{};
+    script::cptr script{};
+    chunk_cptrs_ptr stack{};
+    {
+        const chain::witness instance{ source.to_data(true), true };
+        BOOST_REQUIRE(!instance.extract_taproot(leaf, script, stack,
+            to_program(taproot_program), true));
+        BOOST_REQUIRE(!instance.is_stacked());
+    }
+
+    BOOST_REQUIRE(leaf);
+    BOOST_REQUIRE_EQUAL(script->to_data(false), taproot_leaf);
+    BOOST_REQUIRE_EQUAL(stack->size(), 1u);
+    BOOST_REQUIRE_EQUAL(*stack->front(), data_chunk{ 0x42 });
+}
+
+BOOST_AUTO_TEST_CASE(witness__extract_taproot__contiguous_key_path__program_pushed)
+{
+    const auto signature = data_chunk(64, 0x42);
+    const chain::witness source{ data_stack{ signature } };
+    const chain::witness instance{ source.to_data(true), true };
+
+    hash_cptr leaf{};
+    script::cptr script{};
+    chunk_cptrs_ptr stack{};
+    BOOST_REQUIRE(!instance.extract_taproot(leaf, script, stack,
+        to_program(taproot_program)));
+    BOOST_REQUIRE(!instance.is_stacked());
+    BOOST_REQUIRE_EQUAL(stack->size(), 2u);
+    BOOST_REQUIRE_EQUAL(*stack->front(), signature);
+    BOOST_REQUIRE_EQUAL(*stack->back(), base16_chunk(
+        "147c9c57132f6e7ecddba9800bb0c4449251c92a1e60371ee77557b6620f3ea3"));
+}
+
+BOOST_AUTO_TEST_CASE(witness__stack__materialized_stack__equals_elements)
+{
+    const chain::witness instance{ witness_data, true };
+    const auto& materialized = instance.stack();
+    BOOST_REQUIRE_EQUAL(materialized.size(), instance.stack_size());
+
+    for (size_t index = 0; index < instance.stack_size(); ++index)
+        BOOST_REQUIRE_EQUAL(*materialized[index], instance.element(index));
+}
+
 // json
 // ----------------------------------------------------------------------------
 
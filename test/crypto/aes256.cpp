@@ -66,4 +66,133 @@ BOOST_AUTO_TEST_CASE(encryption__aes256__nist__expected)
     BOOST_REQUIRE_EQUAL(block, plaintext);
 }
 
+// ecb
+
+BOOST_AUTO_TEST_CASE(encryption__aes256_ecb__nist__expected)
+{
+    constexpr auto key = base16_array("000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f");
+    constexpr auto plaintext = base16_array("00112233445566778899aabbccddeeff");
+    constexpr auto cypertext = base16_array("8ea2b7ca516745bfeafc49904b496089");
+
+    auto bytes = plaintext;
+    BOOST_REQUIRE(aes256::encrypt_ecb(bytes, key));
+    BOOST_REQUIRE_EQUAL(bytes, cypertext);
+
+    BOOST_REQUIRE(aes256::decrypt_ecb(bytes, key));
+    BOOST_REQUIRE_EQUAL(bytes, plaintext);
+}
+
+BOOST_AUTO_TEST_CASE(encryption__aes256_ecb__empty__true)
+{
+    constexpr aes256::secret key{ 1 };
+    data_chunk bytes{};
+    BOOST_REQUIRE(aes256::encrypt_ecb(bytes, key));
+    BOOST_REQUIRE(aes256::decrypt_ecb(bytes, key));
+    BOOST_REQUIRE(bytes.empty());
+}
+
+BOOST_AUTO_TEST_CASE(encryption__aes256_ecb__partial_block__false_unchanged)
+{
+    constexpr aes256::secret key{ 1 };
+    const data_chunk expected(add1(aes256::block_size), 0x42);
+    auto bytes = expected;
+    BOOST_REQUIRE(!aes256::encrypt_ecb(bytes, key));
+    BOOST_REQUIRE_EQUAL(bytes, expected);
+    BOOST_REQUIRE(!aes256::decrypt_ecb(bytes, key));
+    BOOST_REQUIRE_EQUAL(bytes, expected);
+}
+
+BOOST_AUTO_TEST_CASE(encryption__aes256_ecb__multiple_blocks__expected_per_block)
+{
+    // Nine blocks exercises both the pipelined lanes and the remaining block.
+    constexpr auto count = 9_size;
+    constexpr auto key = base16_array("000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f");
+    data_chunk plaintext(count * aes256::block_size);
+    for (size_t index = 0; index < plaintext.size(); ++index)
+        plaintext.at(index) = narrow_cast<uint8_t>(index);
+
+    auto bytes = plaintext;
+    BOOST_REQUIRE(aes256::encrypt_ecb(bytes, key));
+
+    for (size_t block = 0; block < count; ++block)
+    {
+        const auto offset = block * aes256::block_size;
+        aes256::block expected{};
+        std::copy_n(std::next(plaintext.begin(), offset), aes256::block_size,
+            expected.begin());
+
+        aes256::encrypt(expected, key);
+        BOOST_REQUIRE(std::equal(expected.begin(), expected.end(),
+            std::next(bytes.begin(), offset)));
+    }
+
+    BOOST_REQUIRE(aes256::decrypt_ecb(bytes, key));
+    BOOST_REQUIRE_EQUAL(bytes, plaintext);
+}
+
+BOOST_AUTO_TEST_CASE(encryption__aes256_ecb__native_and_software__same)
+{
+    constexpr auto key = base16_array("603deb1015ca71be2b73aef0857d77811f352c073b6108d72d9810a30914dff4");
+    data_chunk plaintext(7 * aes256::block_size);
+    for (size_t index = 0; index < plaintext.size(); ++index)
+        plaintext.at(index) = narrow_cast<uint8_t>(index * 7u);
+
+    // If native is not available both passes are software.
+    const auto native = aes256::select_native(true);
+    auto native_bytes = plaintext;
+    BOOST_REQUIRE(aes256::encrypt_ecb(native_bytes, key));
+
+    BOOST_REQUIRE(!aes256::select_native(false));
+    auto software_bytes = plaintext;
+    BOOST_REQUIRE(aes256::encrypt_ecb(software_bytes, key));
+    BOOST_REQUIRE_EQUAL(native_bytes, software_bytes);
+
+    BOOST_REQUIRE(aes256::decrypt_ecb(software_bytes, key));
+    BOOST_REQUIRE_EQUAL(software_bytes, plaintext);
+
+    BOOST_REQUIRE_EQUAL(aes256::select_native(true), native);
+    BOOST_REQUIRE(aes256::decrypt_ecb(native_bytes, key));
+    BOOST_REQUIRE_EQUAL(native_bytes, plaintext);
+}
+
+#if defined(HAVE_PERFORMANCE_TESTS)
+
+// This is a measure of blocks per second (software vs. native, block vs. ecb).
+BOOST_AUTO_TEST_CASE(encryption__aes256__performance__blocks_per_second)
+{
+    constexpr size_t count = 1'000'000;
+    constexpr auto key = base16_array("000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f");
+    using clock = std::chrono::steady_clock;
+    const auto per_second = [](const auto& duration) NOEXCEPT
+    {
+        return count / std::chrono::duration<double>(duration).count();
+    };
+
+    const auto measure = [&](bool native)
+    {
+        const auto enabled = aes256::select_native(native);
+        data_chunk bytes(count * aes256::block_size, 0x42);
+        auto start = clock::now();
+        for (size_t block = 0; block < count; ++block)
+            aes256::encrypt(unsafe_array_cast<uint8_t, aes256::block_size>(
+                std::next(bytes.data(), block * aes256::block_size)), key);
+
+        const auto single = per_second(clock::now() - start);
+        start = clock::now();
+        BOOST_REQUIRE(aes256::encrypt_ecb(bytes, key));
+        const auto batch = per_second(clock::now() - start);
+
+        const auto name = enabled ? "native  " : "software";
+        std::cout << "aes256::encrypt     (" << name << ") : " << single
+            << " blocks/s" << std::endl;
+        std::cout << "aes256::encrypt_ecb (" << name << ") : " << batch
+            << " blocks/s" << std::endl;
+    };
+
+    measure(false);
+    measure(true);
+}
+
+#endif // HAVE_PERFORMANCE_TESTS
+
 BOOST_AUTO_TEST_SUITE_END()
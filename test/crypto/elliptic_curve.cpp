@@ -98,6 +98,102 @@ BOOST_AUTO_TEST_CASE(elliptic_curve__secret_to_public__uncompressed_positive__ex
     BOOST_REQUIRE_EQUAL(point, uncompressed1);
 }
 
+BOOST_AUTO_TEST_CASE(elliptic_curve__secret_to_public__list_empty__true_empty)
+{
+    compressed_list points{ compressed1 };
+    BOOST_REQUIRE(secret_to_public(points, secret_list{}));
+    BOOST_REQUIRE(points.empty());
+}
+
+BOOST_AUTO_TEST_CASE(elliptic_curve__secret_to_public__list__single_key_results)
+{
+    secret_list secrets{ one, secret1, secret3 };
+    for (uint8_t index = 0; index < 100; ++index)
+        secrets.push_back(sha256_hash(data_chunk{ index }));
+
+    compressed_list points;
+    BOOST_REQUIRE(secret_to_public(points, secrets));
+    BOOST_REQUIRE_EQUAL(points.size(), secrets.size());
+    BOOST_REQUIRE_EQUAL(points[0], ec_compressed_generator);
+    BOOST_REQUIRE_EQUAL(points[1], compressed1);
+
+    for (size_t index = 0; index < secrets.size(); ++index)
+    {
+        ec_compressed point;
+        BOOST_REQUIRE(secret_to_public(point, secrets[index]));
+        BOOST_REQUIRE_EQUAL(points[index], point);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(elliptic_curve__secret_to_public__list_invalid_secret__false)
+{
+    // Zero is not a valid secret.
+    compressed_list points;
+    BOOST_REQUIRE(!secret_to_public(points, { secret1, ec_secret{}, one }));
+}
+
+BOOST_AUTO_TEST_CASE(elliptic_curve__secret_to_public__list_hashes__expected)
+{
+    const secret_list secrets{ one, secret1, secret3 };
+
+    compressed_list points;
+    std_vector<short_hash> hashes;
+    BOOST_REQUIRE(secret_to_public(points, hashes, secrets));
+    BOOST_REQUIRE_EQUAL(points.size(), secrets.size());
+    BOOST_REQUIRE_EQUAL(hashes.size(), secrets.size());
+    BOOST_REQUIRE_EQUAL(points[1], compressed1);
+
+    for (size_t index = 0; index < secrets.size(); ++index)
+    {
+        BOOST_REQUIRE_EQUAL(hashes[index], bitcoin_short_hash(points[index]));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(elliptic_curve__secret_to_public__list_hashes_invalid_secret__false)
+{
+    compressed_list points;
+    std_vector<short_hash> hashes;
+    BOOST_REQUIRE(!secret_to_public(points, hashes, { ec_secret{} }));
+}
+
+#if defined(HAVE_PERFORMANCE_TESTS)
+
+// This is a measure of keys per second (single vs. list).
+BOOST_AUTO_TEST_CASE(elliptic_curve__secret_to_public__performance__keys_per_second)
+{
+    constexpr size_t count = 100'000;
+    secret_list secrets(count);
+    for (size_t index = 0; index < count; ++index)
+        secrets[index] = sha256_hash(to_little_endian(index));
+
+    using clock = std::chrono::steady_clock;
+    const auto per_second = [](const auto& duration) NOEXCEPT
+    {
+        return count / std::chrono::duration<double>(duration).count();
+    };
+
+    compressed_list singles(count);
+    auto start = clock::now();
+    for (size_t index = 0; index < count; ++index)
+        BOOST_REQUIRE(secret_to_public(singles[index], secrets[index]));
+
+    const auto single_rate = per_second(clock::now() - start);
+
+    compressed_list points;
+    std_vector<short_hash> hashes;
+    start = clock::now();
+    BOOST_REQUIRE(secret_to_public(points, hashes, secrets));
+    const auto list_rate = per_second(clock::now() - start);
+    BOOST_REQUIRE(points == singles);
+
+    std::cout << "secret_to_public (single)      : " << single_rate
+        << " keys/s" << std::endl;
+    std::cout << "secret_to_public (list, hash)  : " << list_rate
+        << " keys/s" << std::endl;
+}
+
+#endif // HAVE_PERFORMANCE_TESTS
+
 // signature
 
 BOOST_AUTO_TEST_CASE(elliptic_curve__sign__positive__expected)
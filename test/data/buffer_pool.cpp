@@ -0,0 +1,189 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+#include <thread>
+
+struct buffer_pool_setup_fixture
+{
+    buffer_pool_setup_fixture() NOEXCEPT
+    {
+        buffer_pool::local().clear();
+    }
+
+    ~buffer_pool_setup_fixture() NOEXCEPT
+    {
+        buffer_pool::local().clear();
+    }
+};
+
+BOOST_FIXTURE_TEST_SUITE(buffer_pool_tests, buffer_pool_setup_fixture)
+
+BOOST_AUTO_TEST_CASE(buffer_pool__local__same_thread__same_instance)
+{
+    BOOST_REQUIRE_EQUAL(&buffer_pool::local(), &buffer_pool::local());
+}
+
+BOOST_AUTO_TEST_CASE(buffer_pool__local__distinct_threads__distinct_instances)
+{
+    const auto* other = &buffer_pool::local();
+    std::thread([&]() NOEXCEPT { other = &buffer_pool::local(); }).join();
+    BOOST_REQUIRE_NE(other, &buffer_pool::local());
+}
+
+BOOST_AUTO_TEST_CASE(buffer_pool__acquire__empty__miss_minimum_capacity)
+{
+    auto& pool = buffer_pool::local();
+    const auto chunk = pool.acquire(zero);
+    BOOST_REQUIRE(chunk.empty());
+    BOOST_REQUIRE_EQUAL(chunk.capacity(), buffer_pool::minimum_size);
+    BOOST_REQUIRE_EQUAL(pool.hits(), 0u);
+    BOOST_REQUIRE_EQUAL(pool.misses(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(buffer_pool__acquire__class__capacity_rounded_up)
+{
+    auto& pool = buffer_pool::local();
+    BOOST_REQUIRE_EQUAL(pool.acquire(65).capacity(), 128u);
+    BOOST_REQUIRE_EQUAL(pool.acquire(128).capacity(), 128u);
+    BOOST_REQUIRE_EQUAL(pool.acquire(129).capacity(), 256u);
+}
+
+BOOST_AUTO_TEST_CASE(buffer_pool__acquire__released__hit_same_buffer)
+{
+    auto& pool = buffer_pool::local();
+    auto chunk = pool.acquire(100);
+    chunk.resize(100, 0x42);
+    const auto data = chunk.data();
+    pool.release(std::move(chunk));
+    BOOST_REQUIRE_EQUAL(pool.retained(), 1u);
+    BOOST_REQUIRE_EQUAL(pool.retained_bytes(), 128u);
+
+    // Any size in the class is satisfied by the retained buffer.
+    const auto reused = pool.acquire(70);
+    BOOST_REQUIRE(reused.empty());
+    BOOST_REQUIRE_EQUAL(reused.data(), data);
+    BOOST_REQUIRE_EQUAL(pool.hits(), 1u);
+    BOOST_REQUIRE_EQUAL(pool.misses(), 1u);
+    BOOST_REQUIRE_EQUAL(pool.retained(), 0u);
+    BOOST_REQUIRE_EQUAL(pool.retained_bytes(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(buffer_pool__acquire__larger_class__miss)
+{
+    auto& pool = buffer_pool::local();
+    pool.release(pool.acquire(64));
+    BOOST_REQUIRE_EQUAL(pool.acquire(65).capacity(), 128u);
+    BOOST_REQUIRE_EQUAL(pool.hits(), 0u);
+    BOOST_REQUIRE_EQUAL(pool.misses(), 2u);
+    BOOST_REQUIRE_EQUAL(pool.retained(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(buffer_pool__acquire__above_maximum__not_retained)
+{
+    auto& pool = buffer_pool::local();
+    auto chunk = pool.acquire(add1(buffer_pool::maximum_size));
+    BOOST_REQUIRE_GE(chunk.capacity(), add1(buffer_pool::maximum_size));
+    pool.release(std::move(chunk));
+    BOOST_REQUIRE_EQUAL(pool.retained(), 0u);
+    BOOST_REQUIRE_EQUAL(pool.misses(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(buffer_pool__release__below_minimum__not_retained)
+{
+    auto& pool = buffer_pool::local();
+    pool.release(data_chunk(sub1(buffer_pool::minimum_size)));
+    BOOST_REQUIRE_EQUAL(pool.retained(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(buffer_pool__release__class_depth__limited)
+{
+    auto& pool = buffer_pool::local();
+    for (size_t count = 0; count <= buffer_pool::class_depth; ++count)
+        pool.release(data_chunk(64));
+
+    BOOST_REQUIRE_EQUAL(pool.retained(), buffer_pool::class_depth);
+}
+
+BOOST_AUTO_TEST_CASE(buffer_pool__release__stack__all_retained_and_cleared)
+{
+    auto& pool = buffer_pool::local();
+    data_stack stack{ data_chunk(64), data_chunk(100), data_chunk(1000) };
+    pool.release(std::move(stack));
+    BOOST_REQUIRE(stack.empty());
+    BOOST_REQUIRE_EQUAL(pool.retained(), 3u);
+    BOOST_REQUIRE_EQUAL(pool.retained_bytes(), 64u + 100u + 1000u);
+}
+
+BOOST_AUTO_TEST_CASE(buffer_pool__clear__retained__released_and_reset)
+{
+    auto& pool = buffer_pool::local();
+    pool.release(pool.acquire(64));
+    pool.acquire(64);
+    pool.clear();
+    BOOST_REQUIRE_EQUAL(pool.retained(), 0u);
+    BOOST_REQUIRE_EQUAL(pool.retained_bytes(), 0u);
+    BOOST_REQUIRE_EQUAL(pool.hits(), 0u);
+    BOOST_REQUIRE_EQUAL(pool.misses(), 0u);
+}
+
+// buffer
+
+BOOST_AUTO_TEST_CASE(buffer_pool__get__scope__released_on_destruct)
+{
+    auto& pool = buffer_pool::local();
+    {
+        auto buffer = pool.get(200);
+        BOOST_REQUIRE(buffer->empty());
+        BOOST_REQUIRE_EQUAL(buffer->capacity(), 256u);
+        (*buffer).push_back(0x42);
+        BOOST_REQUIRE_EQUAL(pool.retained(), 0u);
+    }
+
+    BOOST_REQUIRE_EQUAL(pool.retained(), 1u);
+    BOOST_REQUIRE(pool.get(256)->empty());
+    BOOST_REQUIRE_EQUAL(pool.hits(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(buffer_pool__get__moved__released_once)
+{
+    auto& pool = buffer_pool::local();
+    {
+        auto buffer = pool.get(64);
+        auto moved = std::move(buffer);
+        BOOST_REQUIRE_EQUAL(moved->capacity(), 64u);
+    }
+
+    BOOST_REQUIRE_EQUAL(pool.retained(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(buffer_pool__get__move_assigned__both_released)
+{
+    auto& pool = buffer_pool::local();
+    {
+        auto buffer = pool.get(64);
+        auto other = pool.get(128);
+        other = std::move(buffer);
+        BOOST_REQUIRE_EQUAL(other->capacity(), 64u);
+        BOOST_REQUIRE_EQUAL(pool.retained(), 1u);
+    }
+
+    BOOST_REQUIRE_EQUAL(pool.retained(), 2u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
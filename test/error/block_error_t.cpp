@@ -269,4 +269,15 @@ BOOST_AUTO_TEST_CASE(block_error_t__code__unspent_coinbase_collision__true_exect
     BOOST_REQUIRE_EQUAL(ec.message(), "unspent coinbase collision");
 }
 
+// deserialize block
+
+BOOST_AUTO_TEST_CASE(block_error_t__code__malformed_block__true_exected_message)
+{
+    constexpr auto value = error::malformed_block;
+    const auto ec = code(value);
+    BOOST_REQUIRE(ec);
+    BOOST_REQUIRE(ec == value);
+    BOOST_REQUIRE_EQUAL(ec.message(), "block data is malformed");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -30,6 +30,7 @@
  */
 #include "../test.hpp"
 #include <bitset>
+#include <cmath>
 
 BOOST_AUTO_TEST_SUITE(bloom_tests)
 
@@ -48,6 +49,53 @@ public:
     using base::is_saturated;
 };
 
+// Deterministic entropy for batch and false positive rate tests.
+constexpr uint64_t next_entropy(uint64_t& state) NOEXCEPT
+{
+    // splitmix64
+    auto value = (state += 0x9e3779b97f4a7c15_u64);
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9_u64;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111eb_u64;
+    return value ^ (value >> 31);
+}
+
+// False positive rate of random entropy against a bloom of given fill
+// (fingerprints added), as observed and as the standard approximation.
+struct rates
+{
+    double observed;
+    double expected;
+};
+
+template <size_t M, size_t K>
+rates measure(size_t fill, size_t trials, size_t samples) NOEXCEPT
+{
+    using bloom_t = accessor<M, K>;
+
+    // (1 - (1 - 1/m)^kn)^k
+    const auto set = 1.0 - std::pow(1.0 - 1.0 / M, K * fill);
+    const auto expected = std::pow(set, K);
+
+    uint64_t state{ fill };
+    size_t positives{};
+    for (size_t trial{}; trial < trials; ++trial)
+    {
+        auto value = bloom_t::empty;
+        for (size_t count{}; count < fill; ++count)
+            value = bloom_t::screen(value, next_entropy(state));
+
+        for (size_t sample{}; sample < samples; ++sample)
+            positives += to_int(bloom_t::is_screened(value,
+                next_entropy(state)));
+    }
+
+    return
+    {
+        static_cast<double>(positives) / (trials * samples),
+        expected
+    };
+}
+
 // Ensure default/nop behavior.
 static_assert( accessor<0, 0>::is_screened(accessor<0, 0>::empty, 42));
 static_assert( accessor<1, 0>::is_screened(accessor<1, 0>::empty, 42));
@@ -1076,8 +1124,111 @@ BOOST_AUTO_TEST_CASE(bloom__screen__full__expected_saturation)
 #endif
 }
 
+// batch
+
+BOOST_AUTO_TEST_CASE(bloom__is_screened__batch__expected_scalar)
+{
+    using bloom_t = accessor<32, 4>;
+    constexpr size_t count = 64;
+    uint64_t state{};
+    uint64_t last{};
+
+    std_array<bloom_t::type, count> values{};
+    std_array<uint64_t, count> entropies{};
+    for (size_t index{}; index < count; ++index)
+    {
+        // Fill each value to a distinct number of fingerprints.
+        values[index] = bloom_t::empty;
+        for (size_t fill{}; fill < index % 16u; ++fill)
+            values[index] = bloom_t::screen(values[index],
+                (last = next_entropy(state)));
+
+        // Alternate previously-screened and random entropy.
+        entropies[index] = is_odd(index) ? last : next_entropy(state);
+    }
+
+    values.back() = bloom_t::empty;
+
+    std_array<bool, count> out{};
+    bloom_t::is_screened(out, values, entropies);
+    for (size_t index{}; index < count; ++index)
+    {
+        BOOST_REQUIRE_EQUAL(out[index],
+            bloom_t::is_screened(values[index], entropies[index]));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(bloom__screen__batch__expected_scalar)
+{
+    using bloom_t = accessor<20, 3>;
+    constexpr size_t count = 64;
+    uint64_t state{ 42 };
+
+    std_array<bloom_t::type, count> values{};
+    std_array<bloom_t::type, count> expected{};
+    std_array<uint64_t, count> entropies{};
+    values.fill(bloom_t::empty);
+
+    for (size_t round{}; round < 16u; ++round)
+    {
+        for (size_t index{}; index < count; ++index)
+        {
+            entropies[index] = next_entropy(state);
+            expected[index] = bloom_t::screen(values[index], entropies[index]);
+        }
+
+        bloom_t::screen(values, entropies);
+        BOOST_REQUIRE(values == expected);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(bloom__is_screened__disabled_batch__true)
+{
+    using bloom_t = accessor<0, 0>;
+    std_array<bool, 2> out{};
+    bloom_t::is_screened(out, { bloom_t::empty, 42 }, { 42, 42 });
+    BOOST_REQUIRE(out[0]);
+    BOOST_REQUIRE(out[1]);
+}
+
+// false positive rate
+
+BOOST_AUTO_TEST_CASE(bloom__false_positive_rate__64_4__expected)
+{
+    // The expectation is an approximation, so allow a relative tolerance.
+    constexpr size_t trials = 1'000;
+    constexpr size_t samples = 100;
+    for (const auto fill: { 1_size, 2_size, 4_size, 8_size })
+    {
+        const auto rate = measure<64, 4>(fill, trials, samples);
+        BOOST_REQUIRE_LE(std::abs(rate.observed - rate.expected),
+            0.1 * rate.expected + 1e-4);
+    }
+}
+
 #if defined(HAVE_SLOW_TESTS)
 
+template <size_t M, size_t K>
+void report(size_t fills) NOEXCEPT
+{
+    for (size_t fill = 1; fill <= fills; ++fill)
+    {
+        const auto rate = measure<M, K>(fill, 10'000, 1'000);
+        std::cout << "bloom<" << M << "," << K << "> fill: " << fill
+            << " observed: " << rate.observed << " expected: "
+            << rate.expected << std::endl;
+    }
+}
+
+BOOST_AUTO_TEST_CASE(bloom__false_positive_rate__report)
+{
+    report<16, 2>(8);
+    report<32, 3>(12);
+    report<32, 4>(12);
+    report<64, 4>(16);
+    report<64, 6>(16);
+}
+
 BOOST_AUTO_TEST_CASE(bloom__screen__4_bits_forward__16_screens)
 {
     constexpr size_t m = 32;
@@ -29,7 +29,9 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 #include "../test.hpp"
+#include <bit>
 #include <bitset>
+#include <cmath>
 
 BOOST_AUTO_TEST_SUITE(sieve_tests)
 
@@ -46,8 +48,67 @@ public:
     using base::empty;
     using base::is_empty;
     using base::is_saturated;
+    using base::masks;
+    using base::screens;
 };
 
+// Deterministic entropy for batch and false positive rate tests.
+constexpr uint64_t next_entropy(uint64_t& state) NOEXCEPT
+{
+    // splitmix64
+    auto value = (state += 0x9e3779b97f4a7c15_u64);
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9_u64;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111eb_u64;
+    return value ^ (value >> 31);
+}
+
+// False positive rate of random entropy against a sieve of given fill
+// (screens in use), as observed and as implied by the mask table.
+struct rates
+{
+    double observed;
+    double expected;
+};
+
+template <size_t SieveBits, size_t SelectBits>
+rates measure(size_t fill, size_t trials, size_t samples) NOEXCEPT
+{
+    using sieve_t = accessor<SieveBits, SelectBits>;
+    BC_ASSERT(!is_zero(fill) && fill <= sieve_t::screens);
+
+    // Masks of a row are disjoint, so each is an independent test.
+    auto negative = 1.0;
+    const auto row = sub1(fill);
+    for (size_t column{}; column <= row; ++column)
+        negative *= 1.0 - std::pow(2.0, -std::popcount(
+            sieve_t::masks(row, column)));
+
+    uint64_t state{ fill };
+    size_t positives{};
+    for (size_t trial{}; trial < trials; ++trial)
+    {
+        // Fill with fingerprints that are not already screened.
+        auto value = sieve_t::empty;
+        for (size_t count{}; count < fill;)
+        {
+            const auto previous = value;
+            value = sieve_t::screen(value, next_entropy(state));
+            if (!sieve_t::is_collision(previous, value))
+                ++count;
+        }
+
+        for (size_t sample{}; sample < samples; ++sample)
+            positives += to_int(sieve_t::is_screened(value,
+                next_entropy(state)));
+    }
+
+    return
+    {
+        static_cast<double>(positives) / (trials * samples),
+        1.0 - negative
+    };
+}
+
 // Ensure default/nop behavior.
 static_assert( accessor<0, 0>::is_screened(accessor<0, 0>::empty, 42));
 static_assert( accessor<1, 0>::is_screened(accessor<1, 0>::empty, 42));
@@ -952,8 +1013,115 @@ BOOST_AUTO_TEST_CASE(sieve__screen__full__expected_saturation)
 #endif
 }
 
+// batch
+
+BOOST_AUTO_TEST_CASE(sieve__is_screened__batch__expected_scalar)
+{
+    using sieve_t = accessor<32, 4>;
+    constexpr size_t count = 64;
+    uint64_t state{};
+    uint64_t last{};
+
+    std_array<sieve_t::type, count> values{};
+    std_array<uint64_t, count> entropies{};
+    for (size_t index{}; index < count; ++index)
+    {
+        // Fill each value to a distinct number of screens.
+        values[index] = sieve_t::empty;
+        for (size_t fill{}; fill < index % add1(sieve_t::screens); ++fill)
+            values[index] = sieve_t::screen(values[index],
+                (last = next_entropy(state)));
+
+        // Alternate previously-screened and random entropy.
+        entropies[index] = is_odd(index) ? last : next_entropy(state);
+    }
+
+    values.back() = sieve_t::empty;
+    values.front() = sieve_t::screen(values.front(), 42);
+
+    std_array<bool, count> out{};
+    sieve_t::is_screened(out, values, entropies);
+    for (size_t index{}; index < count; ++index)
+    {
+        BOOST_REQUIRE_EQUAL(out[index],
+            sieve_t::is_screened(values[index], entropies[index]));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(sieve__screen__batch__expected_scalar)
+{
+    using sieve_t = accessor<32, 4>;
+    constexpr size_t count = 64;
+    uint64_t state{ 42 };
+
+    std_array<sieve_t::type, count> values{};
+    std_array<sieve_t::type, count> expected{};
+    std_array<uint64_t, count> entropies{};
+    values.fill(sieve_t::empty);
+
+    for (size_t round{}; round < add1(sieve_t::screens); ++round)
+    {
+        for (size_t index{}; index < count; ++index)
+        {
+            entropies[index] = next_entropy(state);
+            expected[index] = sieve_t::screen(values[index], entropies[index]);
+        }
+
+        sieve_t::screen(values, entropies);
+        BOOST_REQUIRE(values == expected);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(sieve__is_screened__disabled_batch__true)
+{
+    using sieve_t = accessor<0, 0>;
+    std_array<bool, 2> out{};
+    sieve_t::is_screened(out, { sieve_t::empty, 42 }, { 42, 42 });
+    BOOST_REQUIRE(out[0]);
+    BOOST_REQUIRE(out[1]);
+}
+
+// false positive rate
+
+BOOST_AUTO_TEST_CASE(sieve__false_positive_rate__32_4__expected)
+{
+    // Tolerance allows for sampling error (~6 standard deviations).
+    constexpr size_t trials = 1'000;
+    constexpr size_t samples = 100;
+    for (const auto fill: { 1_size, 2_size, 4_size, 8_size, 16_size })
+    {
+        const auto rate = measure<32, 4>(fill, trials, samples);
+        const auto deviation = std::sqrt(rate.expected *
+            (1.0 - rate.expected) / (trials * samples));
+        BOOST_REQUIRE_LE(std::abs(rate.observed - rate.expected),
+            6.0 * deviation + 1e-6);
+    }
+}
+
 #if defined(HAVE_SLOW_TESTS)
 
+template <size_t SieveBits, size_t SelectBits>
+void report() NOEXCEPT
+{
+    using sieve_t = accessor<SieveBits, SelectBits>;
+    for (size_t fill = 1; fill <= sieve_t::screens; ++fill)
+    {
+        const auto rate = measure<SieveBits, SelectBits>(fill, 10'000, 1'000);
+        std::cout << "sieve<" << SieveBits << "," << SelectBits << "> fill: "
+            << fill << " observed: " << rate.observed << " expected: "
+            << rate.expected << std::endl;
+    }
+}
+
+BOOST_AUTO_TEST_CASE(sieve__false_positive_rate__report)
+{
+    report<16, 2>();
+    report<32, 3>();
+    report<32, 4>();
+    report<64, 4>();
+    report<64, 5>();
+}
+
 BOOST_AUTO_TEST_CASE(sieve__screen__4_bits_forward__16_screens)
 {
     constexpr size_t sieve_bits = 32;
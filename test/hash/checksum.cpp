@@ -371,4 +371,237 @@ BOOST_AUTO_TEST_CASE(checksum__bech32_verify_checked__invalid_checksum__false)
     BOOST_REQUIRE(!bech32_verify_checked(out_version, out_program, bip173_testnet_prefix, checked));
 }
 
+// bech32_encode
+
+static data_chunk get_program(size_t size) NOEXCEPT
+{
+    data_chunk program(size);
+    for (size_t index = 0; index < size; ++index)
+        program[index] = narrow_cast<uint8_t>(index * 37u + size);
+
+    return program;
+}
+
+static std::string to_string(const bech32_chars& chars, size_t size) NOEXCEPT
+{
+    return { chars.data(), size };
+}
+
+static std::string legacy_encode(uint8_t version, const data_chunk& program,
+    const std::string& prefix) NOEXCEPT
+{
+    return prefix + '1' + encode_base32(bech32_build_checked(version, program,
+        prefix));
+}
+
+bech32_chars chars;
+
+BOOST_AUTO_TEST_CASE(checksum__bech32_encode__mainnet_p2wkh__expected)
+{
+    const auto size = bech32_encode(chars, bip173_program_version, bip173_p2wkh_program(), bip173_mainnet_prefix);
+    BOOST_REQUIRE_EQUAL(to_string(chars, size), bip173_mainnet_prefix + "1" + bip173_mainnet_p2wkh);
+}
+
+BOOST_AUTO_TEST_CASE(checksum__bech32_encode__testnet_p2wsh__expected)
+{
+    const auto size = bech32_encode(chars, bip173_program_version, bip173_p2wsh_program(), bip173_testnet_prefix);
+    BOOST_REQUIRE_EQUAL(to_string(chars, size), bip173_testnet_prefix + "1" + bip173_testnet_p2wsh);
+}
+
+BOOST_AUTO_TEST_CASE(checksum__bech32_encode__version_overflow__zero)
+{
+    BOOST_REQUIRE_EQUAL(bech32_encode(chars, 32, {}, ""), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(checksum__bech32_encode__maximum_length__expected)
+{
+    // 1 + 1 + 1 + ceil(50 * 8 / 5) + 6 = 89, 90 with a two character prefix.
+    BOOST_REQUIRE_EQUAL(bech32_encode(chars, 0, get_program(bech32_program_maximum), "a"), 89u);
+    BOOST_REQUIRE_EQUAL(bech32_encode(chars, 0, get_program(bech32_program_maximum), "ab"), 90u);
+    BOOST_REQUIRE_EQUAL(bech32_encode(chars, 0, get_program(bech32_program_maximum), "abc"), 0u);
+    BOOST_REQUIRE_EQUAL(bech32_encode(chars, 0, get_program(add1(bech32_program_maximum)), "a"), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(checksum__bech32_encode__all_versions_and_sizes__legacy_encoding)
+{
+    for (const std::string prefix: { "", "bc", "tb", "BC", "bcrt" })
+    {
+        for (uint8_t version = 0; version < 32u; ++version)
+        {
+            for (size_t size = 0; size <= bech32_program_maximum; ++size)
+            {
+                const auto program = get_program(size);
+                const auto expected = legacy_encode(version, program, prefix);
+                const auto length = bech32_encode(chars, version, program, prefix);
+                if (expected.size() > bech32_maximum_length)
+                {
+                    BOOST_REQUIRE_EQUAL(length, 0u);
+                    continue;
+                }
+
+                BOOST_REQUIRE_EQUAL(to_string(chars, length), expected);
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(checksum__bech32_encode__batch__expected_in_order)
+{
+    std_vector<data_chunk> programs{};
+    std_vector<bech32_witness> witnesses{};
+    for (size_t size = 0; size <= add1(bech32_program_maximum); ++size)
+        programs.push_back(get_program(size));
+
+    for (size_t index = 0; index < programs.size(); ++index)
+        witnesses.push_back({ narrow_cast<uint8_t>(index % 17u), programs[index] });
+
+    // Invalid version.
+    witnesses.push_back({ 32, programs.front() });
+
+    std_vector<bech32_text> out{};
+    bech32_encode(out, witnesses, "tb");
+    BOOST_REQUIRE_EQUAL(out.size(), witnesses.size());
+
+    for (size_t index = 0; index < witnesses.size(); ++index)
+    {
+        const auto& witness = witnesses[index];
+        const auto size = bech32_encode(chars, witness.version, witness.program, "tb");
+        BOOST_REQUIRE_EQUAL(out[index].size, size);
+        BOOST_REQUIRE_EQUAL(to_string(out[index].chars, out[index].size), to_string(chars, size));
+    }
+
+    // Programs too long for a two character prefix, and invalid version.
+    BOOST_REQUIRE_EQUAL(out[bech32_program_maximum].size, bech32_maximum_length);
+    BOOST_REQUIRE_EQUAL(out[add1(bech32_program_maximum)].size, 0u);
+    BOOST_REQUIRE_EQUAL(out.back().size, 0u);
+}
+
+// bech32_decode
+
+size_t out_size;
+bech32_bytes out_bytes;
+
+static bool legacy_decode(uint8_t& version, data_chunk& program,
+    const std::string& prefix, const std::string& payload) NOEXCEPT
+{
+    base32_chunk expanded;
+    return decode_base32(expanded, payload) &&
+        bech32_verify_checked(version, program, prefix, expanded);
+}
+
+static bool require_legacy_decode(const std::string& prefix,
+    const std::string& payload) NOEXCEPT
+{
+    uint8_t version{};
+    data_chunk program{};
+    const auto expected = legacy_decode(version, program, prefix, payload);
+    const auto result = bech32_decode(out_version, out_size, out_bytes, prefix, payload);
+    if (result != expected)
+        return false;
+
+    return !result || (out_version == version &&
+        data_chunk(out_bytes.begin(), std::next(out_bytes.begin(), out_size)) == program);
+}
+
+BOOST_AUTO_TEST_CASE(checksum__bech32_decode__mainnet_p2wkh__true_expected_version_and_program)
+{
+    BOOST_REQUIRE(bech32_decode(out_version, out_size, out_bytes, bip173_mainnet_prefix, bip173_mainnet_p2wkh));
+    BOOST_REQUIRE_EQUAL(out_version, bip173_program_version);
+    const auto program = bip173_p2wkh_program();
+    BOOST_REQUIRE_EQUAL(out_size, program.size());
+    BOOST_REQUIRE(std::equal(program.begin(), program.end(), out_bytes.begin()));
+}
+
+BOOST_AUTO_TEST_CASE(checksum__bech32_decode__mismatched_prefix__false)
+{
+    BOOST_REQUIRE(!bech32_decode(out_version, out_size, out_bytes, bip173_mainnet_prefix, bip173_testnet_p2wsh));
+}
+
+BOOST_AUTO_TEST_CASE(checksum__bech32_decode__too_short_or_long__false)
+{
+    BOOST_REQUIRE(!bech32_decode(out_version, out_size, out_bytes, "", "qqqqqq"));
+    BOOST_REQUIRE(!bech32_decode(out_version, out_size, out_bytes, "", std::string(89, 'q')));
+}
+
+BOOST_AUTO_TEST_CASE(checksum__bech32_decode__all_versions_and_sizes__legacy_decoding)
+{
+    for (const std::string prefix: { "", "bc", "BC", "bcrt" })
+    {
+        for (uint8_t version = 0; version < 32u; ++version)
+        {
+            for (size_t size = 0; size <= bech32_program_maximum; ++size)
+            {
+                const auto length = bech32_encode(chars, version, get_program(size), prefix);
+                if (is_zero(length))
+                    continue;
+
+                const auto payload = to_string(chars, length).substr(add1(prefix.size()));
+                BOOST_REQUIRE(require_legacy_decode(prefix, payload));
+                BOOST_REQUIRE(require_legacy_decode(prefix, ascii_to_upper(payload)));
+
+                // Invalid checksum, mixed case and invalid character.
+                auto mutated = payload;
+                mutated.back() = mutated.back() == 'q' ? 'p' : 'q';
+                BOOST_REQUIRE(require_legacy_decode(prefix, mutated));
+                mutated = payload;
+                mutated.front() = 'Q';
+                BOOST_REQUIRE(require_legacy_decode(prefix, mutated));
+                mutated.front() = 'b';
+                BOOST_REQUIRE(require_legacy_decode(prefix, mutated));
+            }
+        }
+    }
+}
+
+// BIP173 reference checksum of version zero values (bech32), appended.
+static void append_reference_checksum(base32_chunk& values,
+    const std::string& prefix) NOEXCEPT
+{
+    constexpr uint32_t generator[]
+    {
+        0x3b6a57b2, 0x26508e6d, 0x1ea119fa, 0x3d4233dd, 0x2a1462b3
+    };
+
+    std_vector<uint8_t> expanded{};
+    for (const auto character: prefix)
+        expanded.push_back(static_cast<uint8_t>(character >> 5));
+
+    expanded.push_back(0);
+    for (const auto character: prefix)
+        expanded.push_back(static_cast<uint8_t>(character & 0x1f));
+
+    for (const auto& value: values)
+        expanded.push_back(value.convert_to<uint8_t>());
+
+    expanded.resize(expanded.size() + 6u, 0);
+
+    uint32_t checksum = 1;
+    for (const auto value: expanded)
+    {
+        const auto top = checksum >> 25;
+        checksum = ((checksum & 0x01ffffff) << 5) ^ value;
+        for (size_t bit = 0; bit < 5u; ++bit)
+            if (((top >> bit) & 1u) != 0u)
+                checksum ^= generator[bit];
+    }
+
+    checksum ^= 1u;
+    for (auto shift = 25; shift >= 0; shift -= 5)
+        values.push_back(narrow_cast<uint8_t>((checksum >> shift) & 0x1f));
+}
+
+BOOST_AUTO_TEST_CASE(checksum__bech32_decode__padding__legacy_program)
+{
+    // Five values (25 bits) leave one pad bit, zero (0x1e) or not (0x1f).
+    for (const uint8_t last: { 0x1e, 0x1f })
+    {
+        base32_chunk values{ 0x00, 0x1f, 0x1f, 0x1f, 0x1f, last };
+        append_reference_checksum(values, "bc");
+        const auto payload = encode_base32(values);
+        BOOST_REQUIRE(require_legacy_decode("bc", payload));
+        BOOST_REQUIRE(bech32_decode(out_version, out_size, out_bytes, "bc", payload));
+        BOOST_REQUIRE_EQUAL(out_size, last == 0x1e ? 3u : 0u);
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,193 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(merkle_tree_tests)
+
+static hashes to_leaves(size_t count) NOEXCEPT
+{
+    hashes leaves(count);
+    for (size_t index = 0; index < count; ++index)
+        leaves[index] = bitcoin_hash(to_little_endian<uint64_t>(index));
+
+    return leaves;
+}
+
+static hash_digest to_root(const hashes& leaves) NOEXCEPT
+{
+    return merkle_root(hashes{ leaves });
+}
+
+// constructors
+// ----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(merkle_tree__construct__default__empty_null_hash)
+{
+    const merkle_tree instance{};
+    BOOST_REQUIRE(is_zero(instance.size()));
+    BOOST_REQUIRE_EQUAL(instance.root(), null_hash);
+}
+
+BOOST_AUTO_TEST_CASE(merkle_tree__construct__empty__empty_null_hash)
+{
+    const merkle_tree instance{ hashes{} };
+    BOOST_REQUIRE(is_zero(instance.size()));
+    BOOST_REQUIRE_EQUAL(instance.root(), null_hash);
+}
+
+BOOST_AUTO_TEST_CASE(merkle_tree__construct__one__same)
+{
+    constexpr auto expected = sha256::digest_t{ 42 };
+    const merkle_tree instance{ { expected } };
+    BOOST_REQUIRE_EQUAL(instance.size(), 1u);
+    BOOST_REQUIRE_EQUAL(instance.root(), expected);
+}
+
+BOOST_AUTO_TEST_CASE(merkle_tree__construct__three__duplicates_last)
+{
+    constexpr auto expected1 = sha256::double_hash({ 0 }, { 1 });
+    constexpr auto expected2 = sha256::double_hash({ 2 }, { 2 });
+    constexpr auto expected = sha256::double_hash(expected1, expected2);
+    const merkle_tree instance{ { { 0 }, { 1 }, { 2 } } };
+    BOOST_REQUIRE_EQUAL(instance.root(), expected);
+}
+
+BOOST_AUTO_TEST_CASE(merkle_tree__construct__counts__merkle_root)
+{
+    for (size_t count = 0; count < 70; ++count)
+    {
+        const auto leaves = to_leaves(count);
+        const merkle_tree instance{ hashes{ leaves } };
+        BOOST_REQUIRE_EQUAL(instance.size(), count);
+        BOOST_REQUIRE_EQUAL(instance.root(), to_root(leaves));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(merkle_tree__construct__multiple_batches__merkle_root)
+{
+    // Over two batches of pairs at the leaf level, and odd.
+    const auto leaves = to_leaves(10'001);
+    const merkle_tree instance{ hashes{ leaves } };
+    BOOST_REQUIRE_EQUAL(instance.root(), to_root(leaves));
+}
+
+// append
+// ----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(merkle_tree__append__each__merkle_root)
+{
+    const auto leaves = to_leaves(70);
+    merkle_tree instance{};
+
+    for (size_t count = 0; count < leaves.size(); ++count)
+    {
+        instance.append(leaves[count]);
+        const hashes prefix(leaves.begin(),
+            std::next(leaves.begin(), add1(count)));
+        BOOST_REQUIRE_EQUAL(instance.size(), add1(count));
+        BOOST_REQUIRE_EQUAL(instance.root(), to_root(prefix));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(merkle_tree__append__batches__merkle_root)
+{
+    const auto leaves = to_leaves(5'000);
+    merkle_tree instance{ hashes{ leaves } };
+
+    // Odd batch sizes leave partial pairs between batches.
+    auto expected = leaves;
+    for (const auto count: { 1u, 3u, 0u, 7u, 4'097u })
+    {
+        const auto batch = to_leaves(count);
+        instance.append(hashes{ batch });
+        expected.insert(expected.end(), batch.begin(), batch.end());
+        BOOST_REQUIRE_EQUAL(instance.size(), expected.size());
+        BOOST_REQUIRE_EQUAL(instance.root(), to_root(expected));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(merkle_tree__append__single_and_batch__same)
+{
+    const auto leaves = to_leaves(33);
+    merkle_tree each{};
+    merkle_tree batch{};
+
+    for (const auto& leaf: leaves)
+        each.append(leaf);
+
+    batch.append(hashes{ leaves });
+    BOOST_REQUIRE_EQUAL(each.root(), batch.root());
+
+    // Single appends continue from a batched tree.
+    each.append(leaves.front());
+    batch.append(leaves.front());
+    BOOST_REQUIRE_EQUAL(each.root(), batch.root());
+}
+
+// replace
+// ----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(merkle_tree__replace__empty__false)
+{
+    merkle_tree instance{};
+    BOOST_REQUIRE(!instance.replace(0, null_hash));
+}
+
+BOOST_AUTO_TEST_CASE(merkle_tree__replace__out_of_range__false_unchanged)
+{
+    const auto leaves = to_leaves(5);
+    merkle_tree instance{ hashes{ leaves } };
+    BOOST_REQUIRE(!instance.replace(5, null_hash));
+    BOOST_REQUIRE_EQUAL(instance.root(), to_root(leaves));
+}
+
+BOOST_AUTO_TEST_CASE(merkle_tree__replace__each__merkle_root)
+{
+    for (size_t count = 1; count < 20; ++count)
+    {
+        auto leaves = to_leaves(count);
+        merkle_tree instance{ hashes{ leaves } };
+
+        for (size_t index = 0; index < count; ++index)
+        {
+            leaves[index] = bitcoin_hash(leaves[index]);
+            BOOST_REQUIRE(instance.replace(index, leaves[index]));
+            BOOST_REQUIRE_EQUAL(instance.root(), to_root(leaves));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(merkle_tree__replace__then_append__merkle_root)
+{
+    auto leaves = to_leaves(6);
+    merkle_tree instance{ hashes{ leaves } };
+
+    // The last leaf of an odd level is not yet paired.
+    leaves.push_back(null_hash);
+    instance.append(null_hash);
+    leaves.back() = one_hash;
+    BOOST_REQUIRE(instance.replace(6, one_hash));
+    BOOST_REQUIRE_EQUAL(instance.root(), to_root(leaves));
+
+    leaves.push_back(null_hash);
+    instance.append(null_hash);
+    BOOST_REQUIRE_EQUAL(instance.root(), to_root(leaves));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
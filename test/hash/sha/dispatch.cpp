@@ -0,0 +1,210 @@
+// © Licensed Authorship: Manuel J. Nieves (See LICENSE for terms)
+/*
+ * Copyright (c) 2008–2025 Manuel J. Nieves (a.k.a. Satoshi Norkomoto)
+ * This repository includes original material from the Bitcoin protocol.
+ *
+ * Redistribution requires this notice remain intact.
+ * Derivative works must state derivative status.
+ * Commercial use requires licensing.
+ *
+ * GPG Signed: B4EC 7343 AB0D BF24
+ * Contact: Fordamboy1@gmail.com
+ */
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../../test.hpp"
+#include "../hash.hpp"
+
+BOOST_AUTO_TEST_SUITE(sha_dispatch_tests)
+
+using namespace sha;
+
+// Restores detected selection upon test completion.
+struct dispatch_setup_fixture
+{
+    ~dispatch_setup_fixture() NOEXCEPT
+    {
+        select_kernels(kernel::all);
+    }
+};
+
+static const std_array<uint8_t, 6> selections
+{
+    kernel::none,
+    kernel::vector128,
+    kernel::vector256,
+    kernel::vector512,
+    kernel::native,
+    kernel::all
+};
+
+BOOST_AUTO_TEST_CASE(sha_dispatch__detected_kernels__always__subset_of_compiled)
+{
+    const auto compiled = compiled_kernels();
+    BOOST_REQUIRE_EQUAL(bit_and<uint8_t>(detected_kernels(), compiled), detected_kernels());
+    BOOST_REQUIRE_EQUAL(bit_and<uint8_t>(compiled, kernel::all), compiled);
+}
+
+BOOST_AUTO_TEST_CASE(sha_dispatch__selected_kernels__always__resolved)
+{
+    BOOST_REQUIRE_NE(selected_kernels(), kernel::unresolved);
+    BOOST_REQUIRE_NE(kernel_selection.load(), kernel::unresolved);
+    BOOST_REQUIRE_EQUAL(bit_and<uint8_t>(selected_kernels(), kernel::all), selected_kernels());
+}
+
+BOOST_FIXTURE_TEST_CASE(sha_dispatch__kernel_selection__always__selected_kernels, dispatch_setup_fixture)
+{
+    for (const auto selection: selections)
+    {
+        select_kernels(selection);
+        BOOST_REQUIRE_EQUAL(kernel_selection.load(), selected_kernels());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(sha_dispatch__kernel_tables__detected_vector__installed)
+{
+    constexpr auto vectors = bit_or<uint8_t>(
+        bit_or<uint8_t>(kernel::vector128, kernel::vector256),
+        kernel::vector512);
+
+    // Units are compiled only for xcpu, and installed if the cpu supports one.
+    if (!have_xcpu || is_zero(bit_and<uint8_t>(detected_kernels(), vectors)))
+        return;
+
+    BOOST_REQUIRE(sha256_kernels.hash_block != nullptr);
+    BOOST_REQUIRE(sha256_kernels.merkle_hash != nullptr);
+    BOOST_REQUIRE(sha512_kernels.hash_blocks != nullptr);
+    BOOST_REQUIRE(sha512_kernels.merkle_hash != nullptr);
+}
+
+BOOST_FIXTURE_TEST_CASE(sha_dispatch__select_kernels__all__detected, dispatch_setup_fixture)
+{
+    BOOST_REQUIRE_EQUAL(select_kernels(kernel::all), detected_kernels());
+    BOOST_REQUIRE_EQUAL(selected_kernels(), detected_kernels());
+}
+
+BOOST_FIXTURE_TEST_CASE(sha_dispatch__select_kernels__none__none, dispatch_setup_fixture)
+{
+    BOOST_REQUIRE_EQUAL(select_kernels(kernel::none), kernel::none);
+    BOOST_REQUIRE_EQUAL(selected_kernels(), kernel::none);
+}
+
+BOOST_FIXTURE_TEST_CASE(sha_dispatch__select_kernels__undetected__excluded, dispatch_setup_fixture)
+{
+    for (const auto selection: selections)
+    {
+        const auto selected = select_kernels(selection);
+        BOOST_REQUIRE_EQUAL(selected, bit_and<uint8_t>(selection, detected_kernels()));
+        BOOST_REQUIRE_EQUAL(selected_kernels(), selected);
+    }
+}
+
+BOOST_FIXTURE_TEST_CASE(sha_dispatch__sha256__all_selections__expected, dispatch_setup_fixture)
+{
+    for (const auto selection: selections)
+    {
+        select_kernels(selection);
+        BOOST_REQUIRE_EQUAL(sha256::hash(sha256::half_t{}), sha_half256);
+        BOOST_REQUIRE_EQUAL(sha256::hash(sha256::block_t{}), sha_full256);
+        BOOST_REQUIRE_EQUAL(sha256::double_hash(sha256::block_t{}), sha256::hash(sha_full256));
+        BOOST_REQUIRE_EQUAL(sha256::double_hash(sha256::half_t{}), sha256::hash(sha_half256));
+    }
+}
+
+BOOST_FIXTURE_TEST_CASE(sha_dispatch__sha512__all_selections__expected, dispatch_setup_fixture)
+{
+    for (const auto selection: selections)
+    {
+        select_kernels(selection);
+        BOOST_REQUIRE_EQUAL(sha512::hash(sha512::half_t{}), sha_half512);
+        BOOST_REQUIRE_EQUAL(sha512::hash(sha512::block_t{}), sha_full512);
+    }
+}
+
+BOOST_FIXTURE_TEST_CASE(sha_dispatch__sha256_iterate__all_selections__consistent, dispatch_setup_fixture)
+{
+    // Sufficient blocks to engage all vector widths (16 lanes) plus remainder.
+    const data_chunk data(array_count<sha256::block_t> * 19u + 7u, 0x42);
+
+    select_kernels(kernel::none);
+    const auto expected_hash = sha256_hash(data);
+    const auto expected_double = bitcoin_hash(data);
+
+    for (const auto selection: selections)
+    {
+        select_kernels(selection);
+        BOOST_REQUIRE_EQUAL(sha256_hash(data), expected_hash);
+        BOOST_REQUIRE_EQUAL(bitcoin_hash(data), expected_double);
+    }
+}
+
+BOOST_FIXTURE_TEST_CASE(sha_dispatch__sha256_merkle_root__all_selections__consistent, dispatch_setup_fixture)
+{
+    // Sufficient digests to engage all vector widths plus odd remainder.
+    sha256::digests_t digests(37u);
+    for (size_t index = 0; index < digests.size(); ++index)
+        digests[index] = sha256::hash(narrow_cast<uint8_t>(index));
+
+    select_kernels(kernel::none);
+    const auto expected = sha256::merkle_root(sha256::digests_t{ digests });
+
+    for (const auto selection: selections)
+    {
+        select_kernels(selection);
+        BOOST_REQUIRE_EQUAL(sha256::merkle_root(sha256::digests_t{ digests }), expected);
+    }
+}
+
+BOOST_FIXTURE_TEST_CASE(sha_dispatch__sha256_blocks__all_selections__expected, dispatch_setup_fixture)
+{
+    // Array, iterable and streamed forms all dispatch to the installed unit.
+    constexpr auto count = 19u;
+    const sha256::ablocks_t<count> blocks{};
+    const auto expected = sha256_hash(data_chunk(count * array_count<sha256::block_t>, 0x00));
+
+    for (const auto selection: selections)
+    {
+        select_kernels(selection);
+        BOOST_REQUIRE_EQUAL(sha256::hash(blocks), expected);
+        BOOST_REQUIRE_EQUAL(sha256::hash(sha256::iblocks_t{ array_cast<uint8_t>(blocks) }), expected);
+        BOOST_REQUIRE_EQUAL(sha256::double_hash(blocks), sha256::hash(expected));
+
+        auto state = sha256::H::get;
+        sha256::accumulate(state, sha256::iblocks_t{ array_cast<uint8_t>(blocks) });
+        BOOST_REQUIRE_EQUAL(sha256::finalize(state, count), expected);
+    }
+}
+
+BOOST_FIXTURE_TEST_CASE(sha_dispatch__sha512_merkle_root__all_selections__consistent, dispatch_setup_fixture)
+{
+    sha512::digests_t digests(37u);
+    for (size_t index = 0; index < digests.size(); ++index)
+        digests[index] = sha512::hash(narrow_cast<uint8_t>(index));
+
+    select_kernels(kernel::none);
+    const auto expected = sha512::merkle_root(sha512::digests_t{ digests });
+
+    for (const auto selection: selections)
+    {
+        select_kernels(selection);
+        BOOST_REQUIRE_EQUAL(sha512::merkle_root(sha512::digests_t{ digests }), expected);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
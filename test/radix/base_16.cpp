@@ -270,6 +270,39 @@ BOOST_AUTO_TEST_CASE(base16__encode_hash_chunk__two_byte__empty)
     BOOST_REQUIRE_EQUAL(encode_hash(value), expected);
 }
 
+// encode_base16 (data_slab)
+
+BOOST_AUTO_TEST_CASE(base16__encode_base16_slab__insufficient_buffer__false_unchanged)
+{
+    const data_chunk value{ 0x42, 0xab };
+    std::string out(3, 'x');
+    BOOST_REQUIRE(!encode_base16(out, value));
+    BOOST_REQUIRE_EQUAL(out, "xxx");
+}
+
+BOOST_AUTO_TEST_CASE(base16__encode_base16_slab__oversized_buffer__expected_prefix)
+{
+    const data_chunk value{ 0xba, 0xad, 0xf0, 0x0d };
+    std::string out(10, 'x');
+    BOOST_REQUIRE(encode_base16(out, value));
+    BOOST_REQUIRE_EQUAL(out, "baadf00dxx");
+}
+
+BOOST_AUTO_TEST_CASE(base16__encode_base16_slab__long__matches_encode_hash_reversed)
+{
+    // Odd size exercises full vectors and the table remainder.
+    data_chunk value(1001);
+    for (size_t index = 0; index < value.size(); ++index)
+        value[index] = narrow_cast<uint8_t>(index * 7u);
+
+    std::string out(value.size() * octet_width, '\0');
+    BOOST_REQUIRE(encode_base16(out, value));
+    BOOST_REQUIRE_EQUAL(out, encode_base16(value));
+
+    std::reverse(value.begin(), value.end());
+    BOOST_REQUIRE_EQUAL(out, encode_hash(value));
+}
+
 // decode_base16 (data_chunk)
 
 BOOST_AUTO_TEST_CASE(base16__decode_base16_chunk__odd_character_count__false)
@@ -326,6 +359,69 @@ BOOST_AUTO_TEST_CASE(base16__decode_base16_chunk__null_hash__expected)
     BOOST_REQUIRE_EQUAL(out, expected);
 }
 
+BOOST_AUTO_TEST_CASE(base16__decode_base16_chunk__invalid_character__unchanged)
+{
+    const data_chunk expected{ 0x42 };
+    data_chunk out{ 0x42 };
+    BOOST_REQUIRE(!decode_base16(out, "42xabc"));
+    BOOST_REQUIRE_EQUAL(out, expected);
+}
+
+BOOST_AUTO_TEST_CASE(base16__decode_base16_chunk__long_mixed_case__expected)
+{
+    data_chunk expected(1001);
+    for (size_t index = 0; index < expected.size(); ++index)
+        expected[index] = narrow_cast<uint8_t>(index * 7u);
+
+    auto value = encode_base16(expected);
+    const auto upper = ascii_to_upper(value);
+    for (size_t index = 0; index < value.size(); index += 3u)
+        value[index] = upper[index];
+
+    data_chunk out;
+    BOOST_REQUIRE(decode_base16(out, value));
+    BOOST_REQUIRE_EQUAL(out, expected);
+}
+
+BOOST_AUTO_TEST_CASE(base16__decode_base16_chunk__long_invalid_character__false)
+{
+    const auto valid = encode_base16(data_chunk(1001, 0x5a));
+
+    // Invalid characters at every position within and after full vectors.
+    for (size_t index = 0; index < valid.size(); index += 13u)
+    {
+        for (const auto bad: { 'g', 'G', '/', ':', '@', '`', '\xff', '\0' })
+        {
+            auto value = valid;
+            value[index] = bad;
+            data_chunk out;
+            BOOST_REQUIRE(!decode_base16(out, value));
+        }
+    }
+}
+
+// decode_base16 (data_slab)
+
+BOOST_AUTO_TEST_CASE(base16__decode_base16_slab__odd_character_count__false)
+{
+    data_array<3> out{};
+    BOOST_REQUIRE(!decode_base16(data_slab{ out }, "42abc"));
+}
+
+BOOST_AUTO_TEST_CASE(base16__decode_base16_slab__insufficient_buffer__false)
+{
+    data_array<1> out{};
+    BOOST_REQUIRE(!decode_base16(data_slab{ out }, "42ab"));
+}
+
+BOOST_AUTO_TEST_CASE(base16__decode_base16_slab__oversized_buffer__expected_prefix)
+{
+    const data_array<5> expected{ 0xba, 0xad, 0xf0, 0x0d, 0x42 };
+    data_array<5> out{ 0x00, 0x00, 0x00, 0x00, 0x42 };
+    BOOST_REQUIRE(decode_base16(data_slab{ out }, "BaaDf00d"));
+    BOOST_REQUIRE_EQUAL(out, expected);
+}
+
 // decode_base16 (data_array)
 
 BOOST_AUTO_TEST_CASE(base16__decode_base16_array__low_character_count__false)
@@ -247,4 +247,26 @@ BOOST_AUTO_TEST_CASE(base_32__base32_pack__vector5__expected)
     BOOST_REQUIRE_EQUAL(base32_pack(unpacked), expected);
 }
 
+// base32_character/base32_value
+
+BOOST_AUTO_TEST_CASE(base_32__base32_character__all_values__round_trip)
+{
+    for (uint8_t value = 0; value < 32u; ++value)
+    {
+        const auto character = base32_character(value);
+        BOOST_REQUIRE_EQUAL(base32_value(character), value);
+        BOOST_REQUIRE_EQUAL(base32_value(ascii_to_upper({ character }).front()), value);
+        BOOST_REQUIRE_EQUAL(encode_base32(base32_chunk{ value }), std::string{ character });
+    }
+}
+
+BOOST_AUTO_TEST_CASE(base_32__base32_value__invalid__0xff)
+{
+    BOOST_REQUIRE_EQUAL(base32_value('1'), 0xffu);
+    BOOST_REQUIRE_EQUAL(base32_value('b'), 0xffu);
+    BOOST_REQUIRE_EQUAL(base32_value('I'), 0xffu);
+    BOOST_REQUIRE_EQUAL(base32_value('\x00'), 0xffu);
+    BOOST_REQUIRE_EQUAL(base32_value('\xff'), 0xffu);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
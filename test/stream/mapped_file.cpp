@@ -0,0 +1,70 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+#include <fstream>
+
+struct mapped_file_setup_fixture
+{
+    mapped_file_setup_fixture() NOEXCEPT
+    {
+        BOOST_REQUIRE(test::clear(test::directory));
+    }
+
+    ~mapped_file_setup_fixture() NOEXCEPT
+    {
+        BOOST_REQUIRE(test::clear(test::directory));
+    }
+};
+
+BOOST_FIXTURE_TEST_SUITE(mapped_file_tests, mapped_file_setup_fixture)
+
+static void write_file(const std::string& path, const data_chunk& data)
+{
+    std::ofstream file{ to_extended_path(path), std::ios::binary };
+    file.write(pointer_cast<const char>(data.data()), data.size());
+}
+
+BOOST_AUTO_TEST_CASE(mapped_file__construct__missing__not_open)
+{
+    const mapped_file instance{ TEST_PATH };
+    BOOST_REQUIRE(!instance.is_open());
+    BOOST_REQUIRE(instance.data().empty());
+    BOOST_REQUIRE_EQUAL(instance.size(), zero);
+}
+
+BOOST_AUTO_TEST_CASE(mapped_file__construct__empty__open_empty)
+{
+    write_file(TEST_PATH, {});
+    const mapped_file instance{ TEST_PATH };
+    BOOST_REQUIRE(instance.is_open());
+    BOOST_REQUIRE(instance.data().empty());
+    BOOST_REQUIRE_EQUAL(instance.size(), zero);
+}
+
+BOOST_AUTO_TEST_CASE(mapped_file__construct__data__expected)
+{
+    const data_chunk expected(4097, 0x42);
+    write_file(TEST_PATH, expected);
+    const mapped_file instance{ TEST_PATH };
+    BOOST_REQUIRE(instance.is_open());
+    BOOST_REQUIRE_EQUAL(instance.size(), expected.size());
+    BOOST_REQUIRE(instance.data() == expected);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -84,6 +84,24 @@ BOOST_AUTO_TEST_CASE(normalization__to_compatibility_decomposition__bip38__expec
     BOOST_REQUIRE_EQUAL(encode_base16(composed), "cea5cc8100f0909080f09f92a9");
 }
 
+BOOST_AUTO_TEST_CASE(normalization__to_compatibility_decomposition__concurrent__expected)
+{
+    // The locale is generated once and shared by all calls (and threads).
+    std_vector<std::string> values(64,
+        to_string(base16_chunk("ce8e00f0909080f09f92a9")));
+
+    std_vector<uint8_t> results(values.size());
+    std::transform(poolstl::execution::par, values.begin(), values.end(),
+        results.begin(), [](std::string& value) NOEXCEPT
+        {
+            return to_int<uint8_t>(to_compatibility_decomposition(value));
+        });
+
+    BOOST_REQUIRE(std::all_of(results.begin(), results.end(), is_one<uint8_t>));
+    for (const auto& value: values)
+        BOOST_REQUIRE_EQUAL(encode_base16(value), "cea5cc8100f0909080f09f92a9");
+}
+
 #else
 
 // Non-ASCII test cases without HAVE_ICU defined.
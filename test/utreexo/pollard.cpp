@@ -0,0 +1,193 @@
+// © Licensed Authorship: Manuel J. Nieves (See LICENSE for terms)
+/*
+ * Copyright (c) 2008–2025 Manuel J. Nieves (a.k.a. Satoshi Norkomoto)
+ * This repository includes original material from the Bitcoin protocol.
+ *
+ * Redistribution requires this notice remain intact.
+ * Derivative works must state derivative status.
+ * Commercial use requires licensing.
+ *
+ * GPG Signed: B4EC 7343 AB0D BF24
+ * Contact: Fordamboy1@gmail.com
+ */
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+#include "utreexo.hpp"
+
+using namespace utreexo;
+
+BOOST_AUTO_TEST_SUITE(pollard_tests)
+
+BOOST_AUTO_TEST_CASE(pollard__construct__empty__empty)
+{
+    const pollard instance{ 10 };
+    BOOST_REQUIRE(is_zero(instance.leaves()));
+    BOOST_REQUIRE(instance.roots().empty());
+    BOOST_REQUIRE(is_zero(instance.remembered()));
+}
+
+BOOST_AUTO_TEST_CASE(pollard__construct__stump__same_roots)
+{
+    stump state{};
+    BOOST_REQUIRE(state.modify(to_leaves(0, 7), {}, {}));
+    const pollard instance{ state, 10 };
+    BOOST_REQUIRE_EQUAL(instance.leaves(), state.leaves());
+    BOOST_REQUIRE_EQUAL(instance.roots(), state.roots());
+    BOOST_REQUIRE(is_zero(instance.remembered()));
+}
+
+BOOST_AUTO_TEST_CASE(pollard__modify__add__stump_roots)
+{
+    stump state{};
+    pollard instance{ 100 };
+    BOOST_REQUIRE(state.modify(to_leaves(0, 13), {}, {}));
+    BOOST_REQUIRE(instance.modify(to_leaves(0, 13), {}, {}));
+    BOOST_REQUIRE_EQUAL(instance.leaves(), 13u);
+    BOOST_REQUIRE_EQUAL(instance.roots(), state.roots());
+    BOOST_REQUIRE_EQUAL(instance.remembered(), 13u);
+}
+
+BOOST_AUTO_TEST_CASE(pollard__prove__remembered__verified)
+{
+    const auto leaves = to_leaves(0, 13);
+    pollard instance{ 100 };
+    BOOST_REQUIRE(instance.modify(leaves, {}, {}));
+
+    proof proof{};
+    const hashes targets{ leaves[12], leaves[3], leaves[4] };
+    BOOST_REQUIRE(instance.prove(proof, targets));
+    BOOST_REQUIRE(instance.verify(proof, targets));
+    BOOST_REQUIRE(stump(instance.leaves(), instance.roots()).verify(proof,
+        targets));
+
+    // Positions are those of the targets, in target order.
+    BOOST_REQUIRE_EQUAL(proof.targets, positions({ 12, 3, 4 }));
+    BOOST_REQUIRE(!instance.verify(proof, { leaves[12], leaves[4],
+        leaves[3] }));
+}
+
+BOOST_AUTO_TEST_CASE(pollard__prove__not_remembered__false)
+{
+    pollard instance{ 100 };
+    BOOST_REQUIRE(instance.modify(to_leaves(0, 4), {}, {}));
+
+    proof proof{};
+    BOOST_REQUIRE(!instance.prove(proof, { hash_from_u8(42) }));
+}
+
+BOOST_AUTO_TEST_CASE(pollard__modify__capacity__oldest_forgotten)
+{
+    const auto leaves = to_leaves(0, 5);
+    pollard instance{ 2 };
+    BOOST_REQUIRE(instance.modify(leaves, {}, {}));
+    BOOST_REQUIRE_EQUAL(instance.remembered(), 2u);
+
+    proof proof{};
+    BOOST_REQUIRE(!instance.prove(proof, { leaves[2] }));
+    BOOST_REQUIRE(instance.prove(proof, { leaves[3], leaves[4] }));
+    BOOST_REQUIRE(instance.verify(proof, { leaves[3], leaves[4] }));
+}
+
+BOOST_AUTO_TEST_CASE(pollard__modify__zero_capacity__stump_roots)
+{
+    const auto leaves = to_leaves(0, 9);
+    pollard full{ 100 };
+    pollard empty{ 0 };
+    BOOST_REQUIRE(full.modify(leaves, {}, {}));
+    BOOST_REQUIRE(empty.modify(leaves, {}, {}));
+    BOOST_REQUIRE(is_zero(empty.remembered()));
+
+    proof proof{};
+    const hashes targets{ leaves[1], leaves[6] };
+    BOOST_REQUIRE(!empty.prove(proof, targets));
+    BOOST_REQUIRE(full.prove(proof, targets));
+
+    // The proof is ingested to delete from the pruned forest.
+    BOOST_REQUIRE(empty.modify({ hash_from_u8(9) }, targets, proof));
+    BOOST_REQUIRE(full.modify({ hash_from_u8(9) }, targets, proof));
+    BOOST_REQUIRE_EQUAL(empty.roots(), full.roots());
+    BOOST_REQUIRE(is_zero(empty.remembered()));
+}
+
+BOOST_AUTO_TEST_CASE(pollard__modify__invalid_proof__false_unchanged)
+{
+    const auto leaves = to_leaves(0, 8);
+    pollard instance{ 100 };
+    BOOST_REQUIRE(instance.modify(leaves, {}, {}));
+    const auto roots = instance.roots();
+
+    proof proof{};
+    BOOST_REQUIRE(instance.prove(proof, { leaves[5] }));
+    BOOST_REQUIRE(!instance.modify({}, { leaves[4] }, proof));
+    BOOST_REQUIRE_EQUAL(instance.roots(), roots);
+    BOOST_REQUIRE_EQUAL(instance.remembered(), 8u);
+}
+
+BOOST_AUTO_TEST_CASE(pollard__modify__blocks__consistent_with_stump)
+{
+    // A full pollard proves the spends of each block, for a partial pollard
+    // and a stump to validate. All three must agree on the roots.
+    pollard bridge{ 1000 };
+    pollard cached{ 5 };
+    stump state{};
+    hashes unspent{};
+    uint8_t next{};
+
+    for (size_t block = 0; block < 12u; ++block)
+    {
+        // Spend every third unspent leaf, newest first.
+        hashes spends{};
+        for (size_t index = 0; index < unspent.size(); index += 3u)
+            spends.push_back(unspent[sub1(unspent.size()) - index]);
+
+        proof proof{};
+        BOOST_REQUIRE(bridge.prove(proof, spends));
+        BOOST_REQUIRE(state.verify(proof, spends));
+        BOOST_REQUIRE(cached.verify(proof, spends));
+
+        const auto adds = to_leaves(next, narrow_cast<uint8_t>(add1(block)));
+        next = narrow_cast<uint8_t>(next + add1(block));
+
+        BOOST_REQUIRE(bridge.modify(adds, spends, proof));
+        BOOST_REQUIRE(cached.modify(adds, spends, proof));
+        BOOST_REQUIRE(state.modify(adds, spends, proof));
+        BOOST_REQUIRE_EQUAL(bridge.roots(), state.roots());
+        BOOST_REQUIRE_EQUAL(cached.roots(), state.roots());
+        BOOST_REQUIRE_EQUAL(bridge.leaves(), state.leaves());
+
+        std::erase_if(unspent, [&](const node_hash& leaf) NOEXCEPT
+        {
+            return std::find(spends.begin(), spends.end(), leaf) !=
+                spends.end();
+        });
+
+        unspent.insert(unspent.end(), adds.begin(), adds.end());
+        BOOST_REQUIRE_EQUAL(bridge.remembered(), unspent.size());
+        BOOST_REQUIRE(cached.remembered() <= 5u);
+
+        // Leaves remembered by the cache prove against the same roots.
+        hashes recent{ std::prev(unspent.end(), std::min<ptrdiff_t>(
+            cached.remembered(), unspent.size())), unspent.end() };
+        BOOST_REQUIRE(cached.prove(proof, recent));
+        BOOST_REQUIRE(state.verify(proof, recent));
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
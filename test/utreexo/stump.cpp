@@ -0,0 +1,197 @@
+// © Licensed Authorship: Manuel J. Nieves (See LICENSE for terms)
+/*
+ * Copyright (c) 2008–2025 Manuel J. Nieves (a.k.a. Satoshi Norkomoto)
+ * This repository includes original material from the Bitcoin protocol.
+ *
+ * Redistribution requires this notice remain intact.
+ * Derivative works must state derivative status.
+ * Commercial use requires licensing.
+ *
+ * GPG Signed: B4EC 7343 AB0D BF24
+ * Contact: Fordamboy1@gmail.com
+ */
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+#include "utreexo.hpp"
+
+using namespace utreexo;
+
+BOOST_AUTO_TEST_SUITE(stump_tests)
+
+static const auto h0 = hash_from_u8(0);
+static const auto h1 = hash_from_u8(1);
+static const auto h2 = hash_from_u8(2);
+static const auto h3 = hash_from_u8(3);
+static const auto h01 = parent_hash(h0, h1);
+static const auto h23 = parent_hash(h2, h3);
+
+// add
+// ----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(stump__construct__default__empty)
+{
+    const stump instance{};
+    BOOST_REQUIRE(is_zero(instance.leaves()));
+    BOOST_REQUIRE(instance.roots().empty());
+}
+
+BOOST_AUTO_TEST_CASE(stump__modify__add_three__two_roots)
+{
+    stump instance{};
+    BOOST_REQUIRE(instance.modify(to_leaves(0, 3), {}, {}));
+    BOOST_REQUIRE_EQUAL(instance.leaves(), 3u);
+    BOOST_REQUIRE_EQUAL(instance.roots().size(), 2u);
+    BOOST_REQUIRE_EQUAL(instance.roots().front(), h01);
+    BOOST_REQUIRE_EQUAL(instance.roots().back(), h2);
+}
+
+BOOST_AUTO_TEST_CASE(stump__modify__add_eight__one_root)
+{
+    const auto h45 = parent_hash(hash_from_u8(4), hash_from_u8(5));
+    const auto h67 = parent_hash(hash_from_u8(6), hash_from_u8(7));
+    const auto expected = parent_hash(parent_hash(h01, h23),
+        parent_hash(h45, h67));
+
+    stump instance{};
+    BOOST_REQUIRE(instance.modify(to_leaves(0, 8), {}, {}));
+    BOOST_REQUIRE_EQUAL(instance.leaves(), 8u);
+    BOOST_REQUIRE_EQUAL(instance.roots().size(), 1u);
+    BOOST_REQUIRE_EQUAL(instance.roots().front(), expected);
+}
+
+BOOST_AUTO_TEST_CASE(stump__modify__add_separately__same_as_batch)
+{
+    stump batch{};
+    stump single{};
+    BOOST_REQUIRE(batch.modify(to_leaves(0, 11), {}, {}));
+    for (uint8_t byte = 0; byte < 11u; ++byte)
+        BOOST_REQUIRE(single.modify({ hash_from_u8(byte) }, {}, {}));
+
+    BOOST_REQUIRE_EQUAL(single.leaves(), batch.leaves());
+    BOOST_REQUIRE_EQUAL(single.roots(), batch.roots());
+}
+
+// verify
+// ----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(stump__verify__empty_proof__true)
+{
+    const stump instance{ 4, { parent_hash(h01, h23) } };
+    BOOST_REQUIRE(instance.verify({}, {}));
+}
+
+BOOST_AUTO_TEST_CASE(stump__verify__one_target__true)
+{
+    // Proof positions of leaf 0 of 4 are 1 (leaf) and 5 (row one).
+    const stump instance{ 4, { parent_hash(h01, h23) } };
+    const proof proof{ { 0 }, { h1, h23 } };
+    BOOST_REQUIRE(instance.verify(proof, { h0 }));
+}
+
+BOOST_AUTO_TEST_CASE(stump__verify__sibling_targets__true)
+{
+    const stump instance{ 4, { parent_hash(h01, h23) } };
+    const proof proof{ { 1, 0 }, { h23 } };
+    BOOST_REQUIRE(instance.verify(proof, { h1, h0 }));
+}
+
+BOOST_AUTO_TEST_CASE(stump__verify__wrong_target__false)
+{
+    const stump instance{ 4, { parent_hash(h01, h23) } };
+    const proof proof{ { 0 }, { h1, h23 } };
+    BOOST_REQUIRE(!instance.verify(proof, { h2 }));
+}
+
+BOOST_AUTO_TEST_CASE(stump__verify__missing_proof_node__false)
+{
+    const stump instance{ 4, { parent_hash(h01, h23) } };
+    const proof proof{ { 0 }, { h1 } };
+    BOOST_REQUIRE(!instance.verify(proof, { h0 }));
+}
+
+BOOST_AUTO_TEST_CASE(stump__verify__duplicate_target__false)
+{
+    const stump instance{ 4, { parent_hash(h01, h23) } };
+    const proof proof{ { 0, 0 }, { h1, h23 } };
+    BOOST_REQUIRE(!instance.verify(proof, { h0, h0 }));
+}
+
+BOOST_AUTO_TEST_CASE(stump__verify__target_out_of_forest__false)
+{
+    const stump instance{ 4, { parent_hash(h01, h23) } };
+    const proof proof{ { 7 }, {} };
+    BOOST_REQUIRE(!instance.verify(proof, { h0 }));
+}
+
+BOOST_AUTO_TEST_CASE(stump__verify__root_target__true)
+{
+    const stump instance{ 3, { h01, h2 } };
+    const proof proof{ { 2 }, {} };
+    BOOST_REQUIRE(instance.verify(proof, { h2 }));
+}
+
+// delete
+// ----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(stump__modify__delete_one__sibling_rises)
+{
+    stump instance{ 4, { parent_hash(h01, h23) } };
+    const proof proof{ { 1 }, { h0, h23 } };
+    BOOST_REQUIRE(instance.modify({}, { h1 }, proof));
+    BOOST_REQUIRE_EQUAL(instance.leaves(), 4u);
+    BOOST_REQUIRE_EQUAL(instance.roots().front(), parent_hash(h0, h23));
+}
+
+BOOST_AUTO_TEST_CASE(stump__modify__delete_siblings__parent_sibling_rises)
+{
+    stump instance{ 4, { parent_hash(h01, h23) } };
+    const proof proof{ { 0, 1 }, { h23 } };
+    BOOST_REQUIRE(instance.modify({}, { h0, h1 }, proof));
+    BOOST_REQUIRE_EQUAL(instance.roots().front(), h23);
+}
+
+BOOST_AUTO_TEST_CASE(stump__modify__delete_all__empty_root_absorbed)
+{
+    stump instance{ 4, { parent_hash(h01, h23) } };
+    const proof proof{ { 0, 1, 2, 3 }, {} };
+    BOOST_REQUIRE(instance.modify({}, { h0, h1, h2, h3 }, proof));
+    BOOST_REQUIRE_EQUAL(instance.roots().front(), empty_hash);
+
+    // The empty root is absorbed when the row is merged.
+    const auto h4 = hash_from_u8(4);
+    const auto h5 = hash_from_u8(5);
+    BOOST_REQUIRE(instance.modify({ h4, h5, h0, h1, h2, h3 }, {}, {}));
+    BOOST_REQUIRE_EQUAL(instance.leaves(), 10u);
+    BOOST_REQUIRE_EQUAL(instance.roots().size(), 2u);
+    BOOST_REQUIRE_EQUAL(instance.roots().front(),
+        parent_hash(parent_hash(h4, h5), h01));
+    BOOST_REQUIRE_EQUAL(instance.roots().back(), h23);
+}
+
+BOOST_AUTO_TEST_CASE(stump__modify__invalid_proof__false_unchanged)
+{
+    stump instance{ 4, { parent_hash(h01, h23) } };
+    const proof proof{ { 1 }, { h0, h01 } };
+    BOOST_REQUIRE(!instance.modify({ h0 }, { h1 }, proof));
+    BOOST_REQUIRE_EQUAL(instance.leaves(), 4u);
+    BOOST_REQUIRE_EQUAL(instance.roots().front(), parent_hash(h01, h23));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
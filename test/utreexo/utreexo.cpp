@@ -347,6 +347,208 @@ BOOST_AUTO_TEST_CASE(utreexo__get_proof_positions__unsorted__expected)
     BOOST_REQUIRE_EQUAL(targets, expected);
 }
 
+// 14
+// |---------------\
+// 12              13
+// |-------\       |-------\
+// 8       9       10      11
+// |---\   |---\   |---\   |---\
+// 0   1   2   3   4   5   6   7
+
+BOOST_AUTO_TEST_CASE(utreexo__detect_offset__no_leaves__false)
+{
+    offset out{};
+    BOOST_REQUIRE(!detect_offset(out, 0, 0));
+}
+
+BOOST_AUTO_TEST_CASE(utreexo__detect_offset__excess_rows__false)
+{
+    offset out{};
+    BOOST_REQUIRE(!detect_offset(out, 0, add1(bit_hi<uint64_t>)));
+}
+
+BOOST_AUTO_TEST_CASE(utreexo__detect_offset__single_leaf__expected)
+{
+    offset out{};
+    BOOST_REQUIRE(detect_offset(out, 0, 1));
+    BOOST_REQUIRE(out == offset(0, 0, bit_not<uint64_t>(0)));
+}
+
+BOOST_AUTO_TEST_CASE(utreexo__detect_offset__five_leaves__expected)
+{
+    constexpr auto detect_offset_ =
+        [](uint64_t node, uint64_t leaves, const offset& expected) NOEXCEPT
+        {
+            offset out{};
+            return detect_offset(out, node, leaves) && (out == expected);
+        };
+
+    // Trees of four leaves (root 12) and one leaf (root 4).
+    static_assert(detect_offset_(0, 5, { 0, 2, bit_not<uint64_t>(0) }));
+    static_assert(detect_offset_(3, 5, { 0, 2, bit_not<uint64_t>(3) }));
+    static_assert(detect_offset_(8, 5, { 0, 1, bit_not<uint64_t>(8) }));
+    static_assert(detect_offset_(12, 5, { 0, 0, bit_not<uint64_t>(12) }));
+    static_assert(detect_offset_(4, 5, { 1, 0, bit_not<uint64_t>(0) }));
+
+    offset out{};
+    BOOST_REQUIRE(detect_offset(out, 4, 5));
+    BOOST_REQUIRE_EQUAL(std::get<0>(out), 1u);
+    BOOST_REQUIRE_EQUAL(std::get<1>(out), 0u);
+    BOOST_REQUIRE_EQUAL(std::get<2>(out), bit_not<uint64_t>(0));
+}
+
+BOOST_AUTO_TEST_CASE(utreexo__detect_offset__six_leaves__expected)
+{
+    // Trees of four leaves (root 12) and two leaves (root 10).
+    offset out{};
+    BOOST_REQUIRE(detect_offset(out, 10, 6));
+    BOOST_REQUIRE(out == offset(1, 0, bit_not<uint64_t>(6)));
+    BOOST_REQUIRE(detect_offset(out, 5, 6));
+    BOOST_REQUIRE(out == offset(1, 1, bit_not<uint64_t>(1)));
+}
+
+BOOST_AUTO_TEST_CASE(utreexo__detect_offset__node_outside_forest__false)
+{
+    offset out{};
+    BOOST_REQUIRE(!detect_offset(out, 5, 5));
+}
+
+BOOST_AUTO_TEST_CASE(utreexo__parent_many__various__expected)
+{
+    constexpr auto parent_many_ =
+        [](uint64_t node, uint8_t rise, uint8_t rows, uint64_t expected) NOEXCEPT
+        {
+            uint64_t out{};
+            return parent_many(out, node, rise, rows) && (out == expected);
+        };
+
+    static_assert(parent_many_(0, 0, 3, 0));
+    static_assert(parent_many_(0, 1, 3, 8));
+    static_assert(parent_many_(0, 2, 3, 12));
+    static_assert(parent_many_(0, 3, 3, 14));
+    static_assert(parent_many_(5, 1, 3, 10));
+    static_assert(parent_many_(5, 2, 3, 13));
+    static_assert(parent_many_(8, 1, 3, 12));
+    static_assert(parent_many_(9, 2, 3, 14));
+
+    uint64_t out{};
+    BOOST_REQUIRE(parent_many(out, 7, 3, 3));
+    BOOST_REQUIRE_EQUAL(out, 14u);
+}
+
+BOOST_AUTO_TEST_CASE(utreexo__parent_many__rise_one__parent)
+{
+    for (uint64_t node = 0; node < 15; ++node)
+    {
+        uint64_t out{};
+        BOOST_REQUIRE(parent_many(out, node, 1, 3));
+        BOOST_REQUIRE_EQUAL(out, parent(node, 3));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(utreexo__parent_many__excess_rise_or_rows__false)
+{
+    uint64_t out{};
+    BOOST_REQUIRE(!parent_many(out, 0, 4, 3));
+    BOOST_REQUIRE(!parent_many(out, 0, 1, 64));
+    BOOST_REQUIRE(parent_many(out, 0, 63, 63));
+    BOOST_REQUIRE_EQUAL(out, sub1(bit_all<uint64_t>));
+}
+
+BOOST_AUTO_TEST_CASE(utreexo__max_position_at_row__various__expected)
+{
+    constexpr auto max_position_at_row_ =
+        [](uint8_t row, uint8_t rows, uint64_t leaves, uint64_t expected) NOEXCEPT
+        {
+            uint64_t out{};
+            return max_position_at_row(out, row, rows, leaves) &&
+                (out == expected);
+        };
+
+    static_assert(max_position_at_row_(0, 3, 8, 7));
+    static_assert(max_position_at_row_(1, 3, 8, 11));
+    static_assert(max_position_at_row_(2, 3, 8, 13));
+    static_assert(max_position_at_row_(3, 3, 8, 14));
+    static_assert(max_position_at_row_(0, 3, 5, 4));
+    static_assert(max_position_at_row_(1, 3, 5, 9));
+    static_assert(max_position_at_row_(2, 3, 5, 12));
+
+    uint64_t out{};
+    BOOST_REQUIRE(max_position_at_row(out, 1, 3, 5));
+    BOOST_REQUIRE_EQUAL(out, 9u);
+    BOOST_REQUIRE(!max_position_at_row(out, 4, 3, 5));
+}
+
+BOOST_AUTO_TEST_CASE(utreexo__is_ancestor__various__expected)
+{
+    static_assert(is_ancestor(8, 0, 3));
+    static_assert(is_ancestor(12, 0, 3));
+    static_assert(is_ancestor(14, 5, 3));
+    static_assert(is_ancestor(13, 10, 3));
+    static_assert(!is_ancestor(12, 5, 3));
+    static_assert(!is_ancestor(8, 2, 3));
+    static_assert(!is_ancestor(0, 0, 3));
+    static_assert(!is_ancestor(0, 8, 3));
+    static_assert(!is_ancestor(14, 14, 3));
+
+    BOOST_REQUIRE(is_ancestor(14, 5, 3));
+    BOOST_REQUIRE(!is_ancestor(0, 8, 3));
+}
+
+BOOST_AUTO_TEST_CASE(utreexo__roots_to_destroy__no_adds__true_empty)
+{
+    positions out{ 42 };
+    BOOST_REQUIRE(roots_to_destroy(out, { dummy_hash, empty_hash }, 0, 3));
+    BOOST_REQUIRE(out.empty());
+}
+
+BOOST_AUTO_TEST_CASE(utreexo__roots_to_destroy__no_empty_roots__true_empty)
+{
+    positions out{};
+    BOOST_REQUIRE(roots_to_destroy(out, to_leaves(0, 2), 5, 3));
+    BOOST_REQUIRE(out.empty());
+}
+
+BOOST_AUTO_TEST_CASE(utreexo__roots_to_destroy__empty_single_leaf__expected)
+{
+    const positions expected{ 0 };
+    positions out{};
+    BOOST_REQUIRE(roots_to_destroy(out, { empty_hash }, 1, 1));
+    BOOST_REQUIRE_EQUAL(out, expected);
+}
+
+BOOST_AUTO_TEST_CASE(utreexo__roots_to_destroy__empty_low_root__expected)
+{
+    // Leaf 2 is destroyed as the root of row zero (of a forest of 4 leaves).
+    const positions expected{ 2 };
+    positions out{};
+    BOOST_REQUIRE(roots_to_destroy(out, { dummy_hash, empty_hash }, 1, 3));
+    BOOST_REQUIRE_EQUAL(out, expected);
+}
+
+BOOST_AUTO_TEST_CASE(utreexo__roots_to_destroy__empty_high_root__expected)
+{
+    // Node 8 is destroyed as the root of row one (of a forest of 5 leaves).
+    const positions expected{ 8 };
+    positions out{};
+    BOOST_REQUIRE(roots_to_destroy(out, { empty_hash, dummy_hash }, 2, 3));
+    BOOST_REQUIRE_EQUAL(out, expected);
+}
+
+BOOST_AUTO_TEST_CASE(utreexo__roots_to_destroy__mismatched_roots__false)
+{
+    positions out{};
+    BOOST_REQUIRE(!roots_to_destroy(out, { empty_hash }, 1, 3));
+    BOOST_REQUIRE(!roots_to_destroy(out, {}, 1, 1));
+}
+
+BOOST_AUTO_TEST_CASE(utreexo__roots_to_destroy__overflow__false)
+{
+    positions out{};
+    BOOST_REQUIRE(!roots_to_destroy(out, { empty_hash }, bit_hi<uint64_t>, bit_hi<uint64_t>));
+    BOOST_REQUIRE(!roots_to_destroy(out, { empty_hash }, 1, bit_hi<uint64_t>));
+}
+
 // rustreexo examples
 // -------------------------------------------------------------------------------------------
 
@@ -0,0 +1,185 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(address_batch_tests)
+
+using namespace chain;
+using namespace wallet;
+
+// The compressed generator point (valid key).
+constexpr auto key1 = base16_array("0279be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798");
+
+// bip86 first receiving key (m/86'/0'/0'/0/0).
+constexpr auto key2 = base16_array("02cc8a4bc64d897bddc5fbc2f670f7a8ba0b386779106cf1223c6fc5d7cd6fc115");
+
+// Not a point (x is zero).
+constexpr auto key3 = base16_array("020000000000000000000000000000000000000000000000000000000000000000");
+
+// Nested p2wpkh script of a key hash.
+static short_hash nested(const short_hash& hash) NOEXCEPT
+{
+    return bitcoin_short_hash(script{ script::to_pay_witness_key_hash_pattern(
+        hash) }.to_data(false));
+}
+
+// keys
+
+BOOST_AUTO_TEST_CASE(address_batch__encode_addresses__empty_keys__empty)
+{
+    BOOST_REQUIRE(encode_addresses(compressed_list{}, address_type::p2pkh).empty());
+    BOOST_REQUIRE(encode_addresses(compressed_list{}, address_type::p2sh_p2wpkh).empty());
+    BOOST_REQUIRE(encode_addresses(compressed_list{}, address_type::p2wpkh).empty());
+    BOOST_REQUIRE(encode_addresses(compressed_list{}, address_type::p2tr).empty());
+}
+
+BOOST_AUTO_TEST_CASE(address_batch__encode_addresses__p2pkh__expected)
+{
+    const compressed_list keys{ key1, key2 };
+    const auto addresses = encode_addresses(keys, address_type::p2pkh);
+    BOOST_REQUIRE_EQUAL(addresses.size(), 2u);
+    BOOST_REQUIRE_EQUAL(addresses[0], "1BgGZ9tcN4rm9KBzDn7KprQz87SZ26SAMH");
+    BOOST_REQUIRE_EQUAL(addresses[1], payment_address(bitcoin_short_hash(key2)).encoded());
+}
+
+BOOST_AUTO_TEST_CASE(address_batch__encode_addresses__p2pkh_testnet__expected)
+{
+    const compressed_list keys{ key1 };
+    address_prefixes prefixes{};
+    prefixes.p2kh = payment_address::testnet_p2kh;
+    const auto addresses = encode_addresses(keys, address_type::p2pkh, prefixes);
+    BOOST_REQUIRE_EQUAL(addresses.size(), 1u);
+    BOOST_REQUIRE_EQUAL(addresses[0], payment_address(bitcoin_short_hash(key1), payment_address::testnet_p2kh).encoded());
+}
+
+BOOST_AUTO_TEST_CASE(address_batch__encode_addresses__p2sh_p2wpkh__expected)
+{
+    const compressed_list keys{ key1, key2 };
+    const auto addresses = encode_addresses(keys, address_type::p2sh_p2wpkh);
+    BOOST_REQUIRE_EQUAL(addresses.size(), 2u);
+    BOOST_REQUIRE_EQUAL(addresses[0], payment_address(nested(bitcoin_short_hash(key1)), payment_address::mainnet_p2sh).encoded());
+    BOOST_REQUIRE_EQUAL(addresses[1], payment_address(nested(bitcoin_short_hash(key2)), payment_address::mainnet_p2sh).encoded());
+}
+
+BOOST_AUTO_TEST_CASE(address_batch__encode_addresses__p2wpkh__expected)
+{
+    const compressed_list keys{ key1, key2 };
+    const auto addresses = encode_addresses(keys, address_type::p2wpkh);
+    BOOST_REQUIRE_EQUAL(addresses.size(), 2u);
+    BOOST_REQUIRE_EQUAL(addresses[0], "bc1qw508d6qejxtdg4y5r3zarvary0c5xw7kv8f3t4");
+    BOOST_REQUIRE_EQUAL(addresses[1], witness_address(bitcoin_short_hash(key2)).encoded());
+}
+
+BOOST_AUTO_TEST_CASE(address_batch__encode_addresses__p2wpkh_testnet__expected)
+{
+    const compressed_list keys{ key1 };
+    address_prefixes prefixes{};
+    prefixes.witness = witness_address::testnet;
+    const auto addresses = encode_addresses(keys, address_type::p2wpkh, prefixes);
+    BOOST_REQUIRE_EQUAL(addresses.size(), 1u);
+    BOOST_REQUIRE_EQUAL(addresses[0], witness_address(bitcoin_short_hash(key1), witness_address::testnet).encoded());
+}
+
+BOOST_AUTO_TEST_CASE(address_batch__encode_addresses__p2tr__expected)
+{
+    const compressed_list keys{ key2, key3 };
+    const auto addresses = encode_addresses(keys, address_type::p2tr);
+    BOOST_REQUIRE_EQUAL(addresses.size(), 2u);
+    BOOST_REQUIRE_EQUAL(addresses[0], "bc1p5cyxnuxmeuwuvkwfem96lqzszd02n6xdcjrs20cac6yqjjwudpxqkedrcr");
+    BOOST_REQUIRE(addresses[1].empty());
+}
+
+BOOST_AUTO_TEST_CASE(address_batch__encode_addresses__many_keys__ordered)
+{
+    compressed_list keys(100);
+    for (size_t index = 0; index < keys.size(); ++index)
+    {
+        keys[index] = key1;
+        keys[index][1] = static_cast<uint8_t>(index);
+    }
+
+    const auto addresses = encode_addresses(keys, address_type::p2wpkh);
+    BOOST_REQUIRE_EQUAL(addresses.size(), keys.size());
+
+    for (size_t index = 0; index < keys.size(); ++index)
+    {
+        BOOST_REQUIRE_EQUAL(addresses[index], witness_address(bitcoin_short_hash(keys[index])).encoded());
+    }
+}
+
+// scripts
+
+BOOST_AUTO_TEST_CASE(address_batch__encode_addresses__empty_scripts__empty)
+{
+    BOOST_REQUIRE(encode_addresses(scripts{}).empty());
+}
+
+BOOST_AUTO_TEST_CASE(address_batch__encode_addresses__scripts__expected)
+{
+    const auto hash = bitcoin_short_hash(key1);
+    const auto digest = sha256_hash(key1);
+    const scripts outputs
+    {
+        { script::to_pay_key_hash_pattern(hash) },
+        { script::to_pay_script_hash_pattern(hash) },
+        { script::to_pay_witness_key_hash_pattern(hash) },
+        { script::to_pay_witness_script_hash_pattern(digest) },
+        { script::to_pay_witness_pattern(1, digest) },
+        { script::to_pay_null_data_pattern(hash) },
+        { script::to_pay_witness_pattern(0, data_array<16>{}) },
+        {}
+    };
+
+    const auto addresses = encode_addresses(outputs);
+    BOOST_REQUIRE_EQUAL(addresses.size(), outputs.size());
+    BOOST_REQUIRE_EQUAL(addresses[0], "1BgGZ9tcN4rm9KBzDn7KprQz87SZ26SAMH");
+    BOOST_REQUIRE_EQUAL(addresses[1], payment_address(hash, payment_address::mainnet_p2sh).encoded());
+    BOOST_REQUIRE_EQUAL(addresses[2], "bc1qw508d6qejxtdg4y5r3zarvary0c5xw7kv8f3t4");
+    BOOST_REQUIRE_EQUAL(addresses[3], witness_address(digest).encoded());
+    BOOST_REQUIRE_EQUAL(addresses[4].substr(0, 4), "bc1p");
+    BOOST_REQUIRE(addresses[5].empty());
+    BOOST_REQUIRE(addresses[6].empty());
+    BOOST_REQUIRE(addresses[7].empty());
+}
+
+BOOST_AUTO_TEST_CASE(address_batch__encode_addresses__scripts_testnet__expected)
+{
+    const auto hash = bitcoin_short_hash(key1);
+    const scripts outputs
+    {
+        { script::to_pay_key_hash_pattern(hash) },
+        { script::to_pay_script_hash_pattern(hash) },
+        { script::to_pay_witness_key_hash_pattern(hash) }
+    };
+
+    const address_prefixes prefixes
+    {
+        payment_address::testnet_p2kh,
+        payment_address::testnet_p2sh,
+        witness_address::testnet
+    };
+
+    const auto addresses = encode_addresses(outputs, prefixes);
+    BOOST_REQUIRE_EQUAL(addresses.size(), outputs.size());
+    BOOST_REQUIRE_EQUAL(addresses[0], payment_address(hash, payment_address::testnet_p2kh).encoded());
+    BOOST_REQUIRE_EQUAL(addresses[1], payment_address(hash, payment_address::testnet_p2sh).encoded());
+    BOOST_REQUIRE_EQUAL(addresses[2], witness_address(hash, witness_address::testnet).encoded());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -139,4 +139,118 @@ BOOST_AUTO_TEST_CASE(hd_public__derive_public__depth_overflow__invalid)
 }
 
 
+// derive_children
+
+BOOST_AUTO_TEST_CASE(hd_public__derive_children__hardened__false_empty)
+{
+    data_chunk seed;
+    BOOST_REQUIRE(decode_base16(seed, SHORT_SEED));
+
+    const hd_private m(seed, hd_private::mainnet);
+    const hd_public m_pub = m;
+    hd_children children{ {} };
+    BOOST_REQUIRE(!m_pub.derive_children(children, hd_first_hardened_key, 1));
+    BOOST_REQUIRE(children.empty());
+    BOOST_REQUIRE(!m_pub.derive_children(children, sub1(hd_first_hardened_key), 2));
+    BOOST_REQUIRE(children.empty());
+}
+
+BOOST_AUTO_TEST_CASE(hd_public__derive_children__last_normal__true)
+{
+    data_chunk seed;
+    BOOST_REQUIRE(decode_base16(seed, SHORT_SEED));
+
+    const hd_private m(seed, hd_private::mainnet);
+    const hd_public m_pub = m;
+    constexpr auto last = sub1(hd_first_hardened_key);
+    hd_children children{};
+    BOOST_REQUIRE(m_pub.derive_children(children, last, 1));
+    BOOST_REQUIRE_EQUAL(children.size(), 1u);
+    BOOST_REQUIRE_EQUAL(children.front().point, m_pub.derive_public(last).point());
+}
+
+BOOST_AUTO_TEST_CASE(hd_public__derive_children__zero_count__true_empty)
+{
+    data_chunk seed;
+    BOOST_REQUIRE(decode_base16(seed, SHORT_SEED));
+
+    const hd_private m(seed, hd_private::mainnet);
+    const hd_public m_pub = m;
+    hd_children children{ {} };
+    BOOST_REQUIRE(m_pub.derive_children(children, 0, 0));
+    BOOST_REQUIRE(children.empty());
+}
+
+BOOST_AUTO_TEST_CASE(hd_public__derive_children__invalid_parent__false)
+{
+    const hd_public invalid{};
+    hd_children children{};
+    BOOST_REQUIRE(!invalid.derive_children(children, 0, 1));
+    BOOST_REQUIRE(children.empty());
+}
+
+BOOST_AUTO_TEST_CASE(hd_public__derive_children__range__expected_sequential)
+{
+    data_chunk seed;
+    BOOST_REQUIRE(decode_base16(seed, LONG_SEED));
+
+    const hd_private m(seed, hd_private::mainnet);
+    const auto account = m.derive_public(0);
+    constexpr uint32_t first = 42;
+    constexpr size_t count = 100;
+
+    hd_children children{};
+    BOOST_REQUIRE(account.derive_children(children, first, count));
+    BOOST_REQUIRE_EQUAL(children.size(), count);
+
+    for (size_t index = 0; index < count; ++index)
+    {
+        const auto child = account.derive_public(
+            possible_narrow_cast<uint32_t>(first + index));
+        BOOST_REQUIRE(child);
+        BOOST_REQUIRE_EQUAL(children[index].point, child.point());
+        BOOST_REQUIRE_EQUAL(children[index].hash,
+            bitcoin_short_hash(child.point()));
+    }
+}
+
+#if defined(HAVE_PERFORMANCE_TESTS)
+
+// This is a measure of children per second (sequential vs. range).
+BOOST_AUTO_TEST_CASE(hd_public__derive_children__performance__children_per_second)
+{
+    data_chunk seed;
+    BOOST_REQUIRE(decode_base16(seed, LONG_SEED));
+
+    const hd_private m(seed, hd_private::mainnet);
+    const auto account = m.derive_public(0);
+    constexpr size_t count = 20'000;
+    using clock = std::chrono::steady_clock;
+    const auto per_second = [](const auto& duration) NOEXCEPT
+    {
+        return count / std::chrono::duration<double>(duration).count();
+    };
+
+    short_hash last{};
+    auto start = clock::now();
+    for (uint32_t index = 0; index < count; ++index)
+        last = bitcoin_short_hash(account.derive_public(index).point());
+
+    const auto sequential = per_second(clock::now() - start);
+
+    hd_children children{};
+    start = clock::now();
+    BOOST_REQUIRE(account.derive_children(children, 0, count));
+    const auto range = per_second(clock::now() - start);
+    BOOST_REQUIRE_EQUAL(children.back().hash, last);
+
+    std::cout << "hd_public::derive_public   : " << sequential << " children/s"
+        << std::endl;
+    std::cout << "hd_public::derive_children : " << range << " children/s"
+        << std::endl;
+}
+
+#endif // HAVE_PERFORMANCE_TESTS
+
+
 BOOST_AUTO_TEST_SUITE_END()
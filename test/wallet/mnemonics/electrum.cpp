@@ -348,6 +348,108 @@ BOOST_AUTO_TEST_CASE(electrum__grinder__prefix_none__not_found)
     BOOST_REQUIRE_EQUAL(result.iterations, limit);
 }
 
+BOOST_AUTO_TEST_CASE(electrum__grinder__limit_at_match__found)
+{
+    const data_chunk entropy(17, 0x00);
+    const auto find = prefix::two_factor_authentication;
+
+    // The match spans grinding batches, found when the limit reaches it.
+    const auto result = accessor::grinder(entropy, find, language::zh_Hans, 273);
+    BOOST_REQUIRE(electrum::is_prefix(result.words, find));
+    BOOST_REQUIRE_EQUAL(result.iterations, 273u);
+}
+
+BOOST_AUTO_TEST_CASE(electrum__grinder__limit_below_match__not_found)
+{
+    const data_chunk entropy(17, 0x00);
+    const auto find = prefix::two_factor_authentication;
+    const auto result = accessor::grinder(entropy, find, language::zh_Hans, 272);
+    BOOST_REQUIRE(result.entropy.empty());
+    BOOST_REQUIRE(result.words.empty());
+    BOOST_REQUIRE_EQUAL(result.iterations, 272u);
+}
+
+// The grinder evaluates candidates concurrently, this is the serial form.
+static accessor::grinding serial_grinder(const data_chunk& entropy,
+    prefix find, language identifier, size_t limit)
+{
+    data_chunk hash(entropy);
+    const auto start = limit;
+    const auto entropy_size = accessor::usable_size(hash);
+    hash.resize(entropy_size);
+    const auto padding_mask = 0xff << accessor::unused_bits(hash);
+
+    do
+    {
+        hash[sub1(entropy_size)] &= padding_mask;
+        const auto words = accessor::encoder(hash, identifier);
+        if (accessor::validator(words, find) && !accessor::is_conflict(words))
+            return { hash, words, start - limit };
+
+        hash = to_chunk(sha512_hash(hash));
+        hash.resize(entropy_size);
+    }
+    while (!is_zero(limit--));
+
+    return { {}, {}, start };
+}
+
+BOOST_AUTO_TEST_CASE(electrum__grinder__serial__same_first_match)
+{
+    constexpr auto limit = 1000u;
+    const auto finds = { prefix::standard, prefix::witness };
+    const auto lingos = { language::en, language::ja, language::es };
+
+    for (uint8_t seed = 0; seed < 3; ++seed)
+    {
+        const data_chunk entropy(add1(seed) * 17u, seed);
+        for (const auto find: finds)
+        {
+            for (const auto lingo: lingos)
+            {
+                const auto expected = serial_grinder(entropy, find, lingo, limit);
+                const auto result = accessor::grinder(entropy, find, lingo, limit);
+                BOOST_REQUIRE_EQUAL(result.entropy, expected.entropy);
+                BOOST_REQUIRE_EQUAL(result.words, expected.words);
+                BOOST_REQUIRE_EQUAL(result.iterations, expected.iterations);
+            }
+        }
+    }
+}
+
+#if defined(HAVE_PERFORMANCE_TESTS)
+
+// This is a measure of candidates per second (serial vs. concurrent).
+BOOST_AUTO_TEST_CASE(electrum__grinder__performance__candidates_per_second)
+{
+    // Prefix 'none' cannot match, so all candidates are evaluated.
+    constexpr size_t count = 10'000;
+    const data_chunk entropy(17, 0x00);
+    using clock = std::chrono::steady_clock;
+    const auto per_second = [](const auto& duration) NOEXCEPT
+    {
+        return count / std::chrono::duration<double>(duration).count();
+    };
+
+    auto start = clock::now();
+    const auto serial = serial_grinder(entropy, prefix::none, language::en,
+        sub1(count));
+    const auto serial_rate = per_second(clock::now() - start);
+
+    start = clock::now();
+    const auto result = accessor::grinder(entropy, prefix::none, language::en,
+        sub1(count));
+    const auto rate = per_second(clock::now() - start);
+    BOOST_REQUIRE_EQUAL(result.iterations, serial.iterations);
+
+    std::cout << "electrum::grinder (serial)     : " << serial_rate
+        << " candidates/s" << std::endl;
+    std::cout << "electrum::grinder (concurrent) : " << rate
+        << " candidates/s" << std::endl;
+}
+
+#endif // HAVE_PERFORMANCE_TESTS
+
 // seeder
 
 BOOST_AUTO_TEST_CASE(electrum__seeder__non_ascii_passphrase__expected)
@@ -373,6 +373,8 @@ class accessor
   : public electrum
 {
 public:
+    using electrum::grinding;
+
     accessor(const data_chunk& entropy, const string_list& words,
         language identifier, seed_prefix prefix)
       : electrum(entropy, words, identifier, prefix)
@@ -2895,6 +2895,34 @@ BOOST_AUTO_TEST_CASE(neutrino__compute_filter__block_0__success)
     BOOST_REQUIRE_EQUAL(result, expected_filter);
 }
 
+BOOST_AUTO_TEST_CASE(neutrino__compute_filter__same_block_twice__no_pool_misses)
+{
+    const auto raw_block = base16_chunk(
+        "01000000000000000000000000000000000000000000000000000000000000000000"
+        "00003ba3edfd7a7b12b27ac72c3e67768f617fc81bc3888a51323a9fb8aa4b1e5e4a"
+        "dae5494dffff001d1aa4ae1801010000000100000000000000000000000000000000"
+        "00000000000000000000000000000000ffffffff4d04ffff001d0104455468652054"
+        "696d65732030332f4a616e2f32303039204368616e63656c6c6f72206f6e20627269"
+        "6e6b206f66207365636f6e64206261696c6f757420666f722062616e6b73ffffffff"
+        "0100f2052a01000000434104678afdb0fe5548271967f1a67130b7105cd6a828e039"
+        "09a67962e0ea1f61deb649f6bc3f4cef38c4f35504e51ec112de5c384df7ba0b8d57"
+        "8a4c702b6bf11d5fac00000000");
+
+    chain::block validated_block(raw_block, true);
+    BOOST_REQUIRE(validated_block.is_valid());
+
+    data_chunk first;
+    BOOST_REQUIRE(neutrino::compute_filter(first, validated_block));
+
+    const auto& pool = buffer_pool::local();
+    const auto misses = pool.misses();
+
+    data_chunk second;
+    BOOST_REQUIRE(neutrino::compute_filter(second, validated_block));
+    BOOST_REQUIRE_EQUAL(pool.misses(), misses);
+    BOOST_REQUIRE_EQUAL(second, first);
+}
+
 BOOST_AUTO_TEST_CASE(neutrino__compute_filter__block_2__success)
 {
     // const auto expected_block_hash = base16_hash("000000006c02c8ea6e4ff69651f7fcde348fb9d557a06e6957b65552002a7820");
@@ -0,0 +1,196 @@
+// © Licensed Authorship: Manuel J. Nieves (See LICENSE for terms)
+/*
+ * Copyright (c) 2008–2025 Manuel J. Nieves (a.k.a. Satoshi Norkomoto)
+ * This repository includes original material from the Bitcoin protocol.
+ *
+ * Redistribution requires this notice remain intact.
+ * Derivative works must state derivative status.
+ * Commercial use requires licensing.
+ *
+ * GPG Signed: B4EC 7343 AB0D BF24
+ * Contact: Fordamboy1@gmail.com
+ */
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(scanner_tests)
+
+using namespace bc::system::wallet;
+using namespace bc::system::chain;
+
+static const short_hash hash_a = base16_array("0102030405060708090a0b0c0d0e0f1011121314");
+static const short_hash hash_b = base16_array("1112131415161718191a1b1c1d1e1f2021222324");
+static const short_hash hash_c = base16_array("2122232425262728292a2b2c2d2e2f3031323334");
+static const hash_digest hash_x = base16_hash("000000000019d6689c085ae165831e934ff763ae46a2a6c172b3f1b60a8ce26f");
+
+static transaction make_tx(const chain::point& spent, const outputs& outs) NOEXCEPT
+{
+    return { 1, inputs{ { spent, {}, 0 } }, outs, 0 };
+}
+
+static const auto pay_a = script{ script::to_pay_key_hash_pattern(hash_a) };
+static const auto pay_b = script{ script::to_pay_witness_key_hash_pattern(hash_b) };
+static const auto pay_c = script{ script::to_pay_key_hash_pattern(hash_c) };
+
+static const auto coinbase = make_tx({ null_hash, chain::point::null_index }, { { 50, pay_a } });
+static const auto payment = make_tx({ hash_x, 0 }, { { 40, pay_b }, { 10, pay_c } });
+static const auto spend = make_tx({ payment.hash(false), 0 }, { { 30, pay_c } });
+static const block block1{ header{}, { coinbase, payment, spend } };
+
+static const auto spend_coinbase = make_tx({ coinbase.hash(false), 0 }, { { 20, pay_c } });
+static const block block2{ header{}, { coinbase, spend_coinbase } };
+
+static const auto late = make_tx({ hash_x, 1 }, { { 5, pay_a } });
+static const block block3{ header{}, { coinbase, payment, spend, late } };
+
+static void require_match(const scanner::match& match, size_t position,
+    uint32_t index, bool spend) NOEXCEPT
+{
+    BOOST_REQUIRE_EQUAL(match.position, position);
+    BOOST_REQUIRE_EQUAL(match.index, index);
+    BOOST_REQUIRE_EQUAL(match.spend, spend);
+}
+
+BOOST_AUTO_TEST_CASE(scanner__watch__invalid_addresses__false)
+{
+    scanner instance{};
+    BOOST_REQUIRE(!instance.watch(payment_address{}));
+    BOOST_REQUIRE(!instance.watch(witness_address{}));
+    BOOST_REQUIRE_EQUAL(instance.scripts(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(scanner__scan__empty_watch_set__empty)
+{
+    scanner instance{};
+    scanner::matches out{ { 42, 42, true } };
+    instance.scan(out, block1);
+    BOOST_REQUIRE(out.empty());
+    BOOST_REQUIRE_EQUAL(instance.points(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(scanner__scan__duplicate_watch__distinct)
+{
+    scanner instance{};
+    BOOST_REQUIRE(instance.watch(pay_a));
+    BOOST_REQUIRE(instance.watch(pay_a.hash()));
+    BOOST_REQUIRE(instance.watch(payment_address{ hash_a }));
+    BOOST_REQUIRE_EQUAL(instance.scripts(), 3u);
+
+    scanner::matches out{};
+    instance.scan(out, block1);
+    BOOST_REQUIRE_EQUAL(instance.scripts(), 1u);
+    BOOST_REQUIRE_EQUAL(out.size(), 1u);
+    require_match(out[0], 0, 0, false);
+}
+
+BOOST_AUTO_TEST_CASE(scanner__scan__block__expected_payments_and_spends)
+{
+    scanner instance{};
+    BOOST_REQUIRE(instance.watch(payment_address{ hash_a }));
+    BOOST_REQUIRE(instance.watch(witness_address{ hash_b }));
+
+    scanner::matches out{};
+    instance.scan(out, block1);
+    BOOST_REQUIRE_EQUAL(out.size(), 3u);
+    require_match(out[0], 0, 0, false);
+    require_match(out[1], 1, 0, false);
+    require_match(out[2], 2, 0, true);
+    BOOST_REQUIRE_EQUAL(instance.points(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(scanner__scan__spend_before_payment__block_order)
+{
+    scanner instance{};
+    BOOST_REQUIRE(instance.watch(payment_address{ hash_a }));
+    BOOST_REQUIRE(instance.watch(witness_address{ hash_b }));
+
+    scanner::matches out{};
+    instance.scan(out, block3);
+    BOOST_REQUIRE_EQUAL(out.size(), 4u);
+    require_match(out[0], 0, 0, false);
+    require_match(out[1], 1, 0, false);
+    require_match(out[2], 2, 0, true);
+    require_match(out[3], 3, 0, false);
+}
+
+BOOST_AUTO_TEST_CASE(scanner__scan__blocks_spend_before_payment__block_order)
+{
+    scanner instance{};
+    BOOST_REQUIRE(instance.watch(payment_address{ hash_a }));
+    BOOST_REQUIRE(instance.watch(witness_address{ hash_b }));
+
+    std_vector<scanner::matches> out{};
+    instance.scan(out, { block3 });
+    BOOST_REQUIRE_EQUAL(out.size(), 1u);
+    BOOST_REQUIRE_EQUAL(out[0].size(), 4u);
+    require_match(out[0][0], 0, 0, false);
+    require_match(out[0][1], 1, 0, false);
+    require_match(out[0][2], 2, 0, true);
+    require_match(out[0][3], 3, 0, false);
+}
+
+BOOST_AUTO_TEST_CASE(scanner__scan__watched_point__spend)
+{
+    scanner instance{};
+    instance.watch(chain::point{ hash_x, 0 });
+
+    scanner::matches out{};
+    instance.scan(out, block1);
+    BOOST_REQUIRE_EQUAL(out.size(), 1u);
+    require_match(out[0], 1, 0, true);
+}
+
+BOOST_AUTO_TEST_CASE(scanner__scan__blocks__expected_per_block)
+{
+    scanner instance{};
+    BOOST_REQUIRE(instance.watch(payment_address{ hash_a }));
+    BOOST_REQUIRE(instance.watch(witness_address{ hash_b }));
+
+    std_vector<scanner::matches> out{};
+    instance.scan(out, { block1, block2 });
+    BOOST_REQUIRE_EQUAL(out.size(), 2u);
+
+    BOOST_REQUIRE_EQUAL(out[0].size(), 3u);
+    require_match(out[0][0], 0, 0, false);
+    require_match(out[0][1], 1, 0, false);
+    require_match(out[0][2], 2, 0, true);
+
+    // Coinbase of block2 is identical to that of block1 (same point).
+    BOOST_REQUIRE_EQUAL(out[1].size(), 2u);
+    require_match(out[1][0], 0, 0, false);
+    require_match(out[1][1], 1, 0, true);
+}
+
+BOOST_AUTO_TEST_CASE(scanner__scan__large_watch_set__no_false_matches)
+{
+    scanner instance{};
+    for (uint32_t value = 0; value < 10'000; ++value)
+        BOOST_REQUIRE(instance.watch(sha256_hash(to_little_endian(value))));
+
+    BOOST_REQUIRE(instance.watch(pay_b));
+
+    scanner::matches out{};
+    instance.scan(out, block1);
+    BOOST_REQUIRE_EQUAL(out.size(), 2u);
+    require_match(out[0], 1, 0, false);
+    require_match(out[1], 2, 0, true);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
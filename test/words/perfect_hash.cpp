@@ -0,0 +1,227 @@
+// © Licensed Authorship: Manuel J. Nieves (See LICENSE for terms)
+/*
+ * Copyright (c) 2008–2025 Manuel J. Nieves (a.k.a. Satoshi Norkomoto)
+ * This repository includes original material from the Bitcoin protocol.
+ *
+ * Redistribution requires this notice remain intact.
+ * Derivative works must state derivative status.
+ * Commercial use requires licensing.
+ *
+ * GPG Signed: B4EC 7343 AB0D BF24
+ * Contact: Fordamboy1@gmail.com
+ */
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+#include <algorithm>
+#include <string_view>
+
+BOOST_AUTO_TEST_SUITE(perfect_hash_tests)
+
+using namespace bc::system::words;
+
+constexpr perfect_hash<5>::words five_words
+{
+    "alpha", "bravo", "charlie", "delta", "echo"
+};
+
+// Construction is constexpr.
+constexpr perfect_hash<5> five_hash{ five_words };
+static_assert(five_hash.size() == 5u);
+static_assert(five_hash.position("alpha") == 0u);
+static_assert(five_hash.position("echo") == 4u);
+
+template <size_t Size>
+static bool is_identity(const perfect_hash<Size>& hash,
+    const std_array<const char*, Size>& words)
+{
+    for (size_t index = 0; index < words.size(); ++index)
+        if (hash.position(words[index]) != index)
+            return false;
+
+    return true;
+}
+
+// hash
+
+BOOST_AUTO_TEST_CASE(perfect_hash__hash__empty__fnv1a_basis)
+{
+    static_assert(perfect_hash<1>::hash("") == 0xcbf29ce484222325_u64);
+    BOOST_REQUIRE_EQUAL(perfect_hash<1>::hash(""), 0xcbf29ce484222325_u64);
+}
+
+BOOST_AUTO_TEST_CASE(perfect_hash__hash__a__fnv1a_expected)
+{
+    BOOST_REQUIRE_EQUAL(perfect_hash<1>::hash("a"), 0xaf63dc4c8601ec8c_u64);
+}
+
+// size
+
+BOOST_AUTO_TEST_CASE(perfect_hash__size__default__capacity)
+{
+    BOOST_REQUIRE_EQUAL(five_hash.size(), 5u);
+}
+
+BOOST_AUTO_TEST_CASE(perfect_hash__size__count__count)
+{
+    const perfect_hash<5> instance{ five_words, 3 };
+    BOOST_REQUIRE_EQUAL(instance.size(), 3u);
+}
+
+BOOST_AUTO_TEST_CASE(perfect_hash__size__excess_count__capacity)
+{
+    const perfect_hash<5> instance{ five_words, 42 };
+    BOOST_REQUIRE_EQUAL(instance.size(), 5u);
+}
+
+// position
+
+BOOST_AUTO_TEST_CASE(perfect_hash__position__words__indexes)
+{
+    BOOST_REQUIRE(is_identity(five_hash, five_words));
+}
+
+BOOST_AUTO_TEST_CASE(perfect_hash__position__hash__same_as_word)
+{
+    for (const auto word: five_words)
+        BOOST_REQUIRE_EQUAL(five_hash.position(perfect_hash<5>::hash(word)),
+            five_hash.position(word));
+}
+
+BOOST_AUTO_TEST_CASE(perfect_hash__position__partial_count__indexes)
+{
+    const perfect_hash<5> instance{ five_words, 3 };
+    BOOST_REQUIRE_EQUAL(instance.position("alpha"), 0u);
+    BOOST_REQUIRE_EQUAL(instance.position("bravo"), 1u);
+    BOOST_REQUIRE_EQUAL(instance.position("charlie"), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(perfect_hash__position__non_words__in_range)
+{
+    BOOST_REQUIRE_LT(five_hash.position(""), 5u);
+    BOOST_REQUIRE_LT(five_hash.position("foxtrot"), 5u);
+    BOOST_REQUIRE_LT(five_hash.position("Alpha"), 5u);
+}
+
+BOOST_AUTO_TEST_CASE(perfect_hash__position__empty__zero)
+{
+    const perfect_hash<5> instance{ five_words, 0 };
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+    BOOST_REQUIRE_EQUAL(instance.position("alpha"), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(perfect_hash__position__one_word__zero)
+{
+    constexpr perfect_hash<1>::words one_word{ "alpha" };
+    const perfect_hash<1> instance{ one_word };
+    BOOST_REQUIRE_EQUAL(instance.position("alpha"), 0u);
+    BOOST_REQUIRE_EQUAL(instance.position("bravo"), 0u);
+}
+
+// catalogs
+
+BOOST_AUTO_TEST_CASE(perfect_hash__position__mnemonic_catalogs__indexes)
+{
+    BOOST_REQUIRE(is_identity(mnemonic::en_hash(), mnemonic::en.word));
+    BOOST_REQUIRE(is_identity(mnemonic::es_hash(), mnemonic::es.word));
+    BOOST_REQUIRE(is_identity(mnemonic::it_hash(), mnemonic::it.word));
+    BOOST_REQUIRE(is_identity(mnemonic::fr_hash(), mnemonic::fr.word));
+    BOOST_REQUIRE(is_identity(mnemonic::cs_hash(), mnemonic::cs.word));
+    BOOST_REQUIRE(is_identity(mnemonic::pt_hash(), mnemonic::pt.word));
+    BOOST_REQUIRE(is_identity(mnemonic::ja_hash(), mnemonic::ja.word));
+    BOOST_REQUIRE(is_identity(mnemonic::ko_hash(), mnemonic::ko.word));
+    BOOST_REQUIRE(is_identity(mnemonic::zh_Hans_hash(), mnemonic::zh_Hans.word));
+    BOOST_REQUIRE(is_identity(mnemonic::zh_Hant_hash(), mnemonic::zh_Hant.word));
+}
+
+BOOST_AUTO_TEST_CASE(perfect_hash__position__electrum_catalogs__mnemonic_hashes)
+{
+    BOOST_REQUIRE(&electrum::en_hash() == &mnemonic::en_hash());
+    BOOST_REQUIRE(&electrum::zh_Hant_hash() == &mnemonic::zh_Hant_hash());
+    BOOST_REQUIRE(is_identity(electrum::ja_hash(), electrum::ja.word));
+}
+
+BOOST_AUTO_TEST_CASE(perfect_hash__position__electrum_v1_catalogs__indexes)
+{
+    BOOST_REQUIRE(is_identity(electrum_v1::en_hash(), electrum_v1::en.word));
+    BOOST_REQUIRE(is_identity(electrum_v1::pt_hash(), electrum_v1::pt.word));
+}
+
+// dictionary
+
+BOOST_AUTO_TEST_CASE(perfect_hash__dictionary__hashed_index__unhashed_index)
+{
+    const mnemonic::catalog unhashed{ language::fr, mnemonic::fr };
+    const mnemonic::catalog hashed{ language::fr, mnemonic::fr,
+        mnemonic::fr_hash };
+
+    for (const auto word: mnemonic::fr.word)
+        BOOST_REQUIRE_EQUAL(hashed.index(word), unhashed.index(word));
+
+    for (const auto word: mnemonic::en.word)
+        BOOST_REQUIRE_EQUAL(hashed.index(word), unhashed.index(word));
+
+    BOOST_REQUIRE_EQUAL(hashed.index(""), -1);
+    BOOST_REQUIRE_EQUAL(hashed.index("abandonx"), -1);
+}
+
+#if defined(HAVE_PERFORMANCE_TESTS)
+
+// This is a measure of word lookups per second (linear/binary vs. hashed).
+BOOST_AUTO_TEST_CASE(perfect_hash__dictionary__performance__lookups_per_second)
+{
+    constexpr size_t rounds = 100;
+    const mnemonic::catalog unhashed{ language::ja, mnemonic::ja };
+    const mnemonic::catalog hashed{ language::ja, mnemonic::ja,
+        mnemonic::ja_hash };
+    const string_list words{ mnemonic::ja.word.begin(),
+        mnemonic::ja.word.end() };
+
+    using clock = std::chrono::steady_clock;
+    const auto per_second = [&](const auto& duration) NOEXCEPT
+    {
+        return rounds * words.size() /
+            std::chrono::duration<double>(duration).count();
+    };
+
+    size_t found{};
+    auto start = clock::now();
+    for (size_t round = 0; round < rounds; ++round)
+        for (const auto& word: words)
+            found += to_bool(add1(unhashed.index(word)));
+
+    const auto unhashed_rate = per_second(clock::now() - start);
+
+    start = clock::now();
+    for (size_t round = 0; round < rounds; ++round)
+        for (const auto& word: words)
+            found += to_bool(add1(hashed.index(word)));
+
+    const auto hashed_rate = per_second(clock::now() - start);
+    BOOST_REQUIRE_EQUAL(found, two * rounds * words.size());
+
+    std::cout << "dictionary::index (unhashed) : " << unhashed_rate
+        << " words/s" << std::endl;
+    std::cout << "dictionary::index (hashed)   : " << hashed_rate
+        << " words/s" << std::endl;
+}
+
+#endif // HAVE_PERFORMANCE_TESTS
+
+BOOST_AUTO_TEST_SUITE_END()
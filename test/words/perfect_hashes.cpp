@@ -0,0 +1,236 @@
+// © Licensed Authorship: Manuel J. Nieves (See LICENSE for terms)
+/*
+ * Copyright (c) 2008–2025 Manuel J. Nieves (a.k.a. Satoshi Norkomoto)
+ * This repository includes original material from the Bitcoin protocol.
+ *
+ * Redistribution requires this notice remain intact.
+ * Derivative works must state derivative status.
+ * Commercial use requires licensing.
+ *
+ * GPG Signed: B4EC 7343 AB0D BF24
+ * Contact: Fordamboy1@gmail.com
+ */
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+#include <cstring>
+
+BOOST_AUTO_TEST_SUITE(perfect_hashes_tests)
+
+using namespace bc::system::words;
+
+typedef perfect_hashes<2, 3> hashes_2x3;
+constexpr hashes_2x3::words left_words{ "alpha", "bravo", "charlie" };
+constexpr hashes_2x3::words right_words{ "delta", "alpha", "echo" };
+const perfect_hash<3> left_hash{ left_words };
+const perfect_hash<3> right_hash{ right_words };
+const hashes_2x3 instance{ { &left_words, &right_words },
+    { &left_hash, &right_hash } };
+
+// The lists (bit set by position) containing word, and its first index.
+template <size_t Count, size_t Size>
+static typename perfect_hashes<Count, Size>::location search(
+    const std_array<const std_array<const char*, Size>*, Count>& lists,
+    const char* word)
+{
+    typename perfect_hashes<Count, Size>::location out{ 0, -1 };
+    for (size_t list = 0; list < Count; ++list)
+    {
+        for (size_t index = 0; index < Size; ++index)
+        {
+            if (std::strcmp((*lists[list])[index], word) == 0)
+            {
+                if (is_zero(out.lists))
+                    out.index = possible_narrow_and_sign_cast<int32_t>(index);
+
+                out.lists |= bit_right<uint16_t>(list);
+                break;
+            }
+        }
+    }
+
+    return out;
+}
+
+// size
+
+BOOST_AUTO_TEST_CASE(perfect_hashes__size__overlapping__distinct_words)
+{
+    BOOST_REQUIRE_EQUAL(instance.size(), 5u);
+}
+
+BOOST_AUTO_TEST_CASE(perfect_hashes__size__mnemonic__distinct_words)
+{
+    // zh_Hans and zh_Hant share 1275 words, en and fr share 100.
+    BOOST_REQUIRE_EQUAL(mnemonic::hashes().size(), 10u * 2048u - 1275u - 100u);
+}
+
+BOOST_AUTO_TEST_CASE(perfect_hashes__size__electrum_v1__distinct_words)
+{
+    // en and pt share 5 words.
+    BOOST_REQUIRE_EQUAL(electrum_v1::hashes().size(), 2u * 1626u - 5u);
+}
+
+// find
+
+BOOST_AUTO_TEST_CASE(perfect_hashes__find__distinct_words__expected)
+{
+    BOOST_REQUIRE_EQUAL(instance.find("bravo").lists, 0b01u);
+    BOOST_REQUIRE_EQUAL(instance.find("bravo").index, 1);
+    BOOST_REQUIRE_EQUAL(instance.find("charlie").lists, 0b01u);
+    BOOST_REQUIRE_EQUAL(instance.find("charlie").index, 2);
+    BOOST_REQUIRE_EQUAL(instance.find("delta").lists, 0b10u);
+    BOOST_REQUIRE_EQUAL(instance.find("delta").index, 0);
+    BOOST_REQUIRE_EQUAL(instance.find("echo").lists, 0b10u);
+    BOOST_REQUIRE_EQUAL(instance.find("echo").index, 2);
+}
+
+BOOST_AUTO_TEST_CASE(perfect_hashes__find__shared_word__both_lists_first_index)
+{
+    BOOST_REQUIRE_EQUAL(instance.find("alpha").lists, 0b11u);
+    BOOST_REQUIRE_EQUAL(instance.find("alpha").index, 0);
+}
+
+BOOST_AUTO_TEST_CASE(perfect_hashes__find__non_words__not_found)
+{
+    BOOST_REQUIRE_EQUAL(instance.find("").lists, 0u);
+    BOOST_REQUIRE_EQUAL(instance.find("").index, -1);
+    BOOST_REQUIRE_EQUAL(instance.find("foxtrot").lists, 0u);
+    BOOST_REQUIRE_EQUAL(instance.find("foxtrot").index, -1);
+    BOOST_REQUIRE_EQUAL(instance.find("Alpha").lists, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(perfect_hashes__find__mnemonic__expected)
+{
+    const mnemonic::catalogs::hashes::lists lists
+    {
+        &mnemonic::en.word, &mnemonic::es.word, &mnemonic::it.word,
+        &mnemonic::fr.word, &mnemonic::cs.word, &mnemonic::pt.word,
+        &mnemonic::ja.word, &mnemonic::ko.word, &mnemonic::zh_Hans.word,
+        &mnemonic::zh_Hant.word
+    };
+
+    const auto& hashes = mnemonic::hashes();
+    for (const auto list: lists)
+    {
+        for (const auto word: *list)
+        {
+            const auto expected = search(lists, word);
+            const auto found = hashes.find(word);
+            BOOST_REQUIRE_EQUAL(found.lists, expected.lists);
+            BOOST_REQUIRE_EQUAL(found.index, expected.index);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(perfect_hashes__find__mnemonic_overlaps__expected)
+{
+    // "zoo" is en only, "abandon" is en and fr, "的" is zh_Hans and zh_Hant.
+    const auto& hashes = mnemonic::hashes();
+    BOOST_REQUIRE_EQUAL(hashes.find("zoo").lists, 0b0000000001u);
+    BOOST_REQUIRE_EQUAL(hashes.find("zoo").index, 2047);
+    BOOST_REQUIRE_EQUAL(hashes.find("abandon").lists, 0b0000001001u);
+    BOOST_REQUIRE_EQUAL(hashes.find("abandon").index, 0);
+    BOOST_REQUIRE_EQUAL(hashes.find("的").lists, 0b1100000000u);
+    BOOST_REQUIRE_EQUAL(hashes.find("的").index, 0);
+}
+
+BOOST_AUTO_TEST_CASE(perfect_hashes__find__electrum_v1__expected)
+{
+    const electrum_v1::catalogs::hashes::lists lists
+    {
+        &electrum_v1::en.word, &electrum_v1::pt.word
+    };
+
+    const auto& hashes = electrum_v1::hashes();
+    for (const auto list: lists)
+    {
+        for (const auto word: *list)
+        {
+            const auto expected = search(lists, word);
+            const auto found = hashes.find(word);
+            BOOST_REQUIRE_EQUAL(found.lists, expected.lists);
+            BOOST_REQUIRE_EQUAL(found.index, expected.index);
+        }
+    }
+}
+
+// dictionaries
+
+BOOST_AUTO_TEST_CASE(perfect_hashes__dictionaries__hashed_contains__unhashed_contains)
+{
+    const mnemonic::catalogs unhashed
+    {
+        {
+            mnemonic::catalog{ language::en, mnemonic::en },
+            mnemonic::catalog{ language::es, mnemonic::es },
+            mnemonic::catalog{ language::it, mnemonic::it },
+            mnemonic::catalog{ language::fr, mnemonic::fr },
+            mnemonic::catalog{ language::cs, mnemonic::cs },
+            mnemonic::catalog{ language::pt, mnemonic::pt },
+            mnemonic::catalog{ language::ja, mnemonic::ja },
+            mnemonic::catalog{ language::ko, mnemonic::ko },
+            mnemonic::catalog{ language::zh_Hans, mnemonic::zh_Hans },
+            mnemonic::catalog{ language::zh_Hant, mnemonic::zh_Hant }
+        }
+    };
+
+    const mnemonic::catalogs hashed
+    {
+        {
+            mnemonic::catalog{ language::en, mnemonic::en },
+            mnemonic::catalog{ language::es, mnemonic::es },
+            mnemonic::catalog{ language::it, mnemonic::it },
+            mnemonic::catalog{ language::fr, mnemonic::fr },
+            mnemonic::catalog{ language::cs, mnemonic::cs },
+            mnemonic::catalog{ language::pt, mnemonic::pt },
+            mnemonic::catalog{ language::ja, mnemonic::ja },
+            mnemonic::catalog{ language::ko, mnemonic::ko },
+            mnemonic::catalog{ language::zh_Hans, mnemonic::zh_Hans },
+            mnemonic::catalog{ language::zh_Hant, mnemonic::zh_Hant }
+        },
+        mnemonic::hashes
+    };
+
+    const string_list words_en{ "abandon", "angle", "zoo" };
+    const string_list words_fr{ "abandon", "abeille", "zoologie" };
+    const string_list words_zh{ "的", "一", "是" };
+    const string_list words_mixed{ "zoo", "abeille" };
+    const string_list words_invalid{ "abandon", "foobar" };
+
+    BOOST_REQUIRE(hashed.contains(words_en) == unhashed.contains(words_en));
+    BOOST_REQUIRE(hashed.contains(words_fr) == unhashed.contains(words_fr));
+    BOOST_REQUIRE(hashed.contains(words_zh) == unhashed.contains(words_zh));
+    BOOST_REQUIRE(hashed.contains(words_mixed) == language::none);
+    BOOST_REQUIRE(unhashed.contains(words_mixed) == language::none);
+    BOOST_REQUIRE(hashed.contains(words_invalid) == language::none);
+    BOOST_REQUIRE(hashed.contains(string_list{}) == unhashed.contains(string_list{}));
+    BOOST_REQUIRE(hashed.contains(words_en) == language::en);
+    BOOST_REQUIRE(hashed.contains(words_fr) == language::fr);
+    BOOST_REQUIRE(hashed.contains(words_zh) == language::zh_Hans);
+    BOOST_REQUIRE(hashed.contains("abandon") == language::en);
+    BOOST_REQUIRE(hashed.contains("abeille") == language::fr);
+    BOOST_REQUIRE(hashed.contains("foobar") == language::none);
+    BOOST_REQUIRE(hashed.contains("abandon", language::fr) == language::fr);
+
+    for (const auto word: mnemonic::ko.word)
+        BOOST_REQUIRE(hashed.contains(word) == unhashed.contains(word));
+}
+
+BOOST_AUTO_TEST_SUITE_END()